@@ -233,6 +233,11 @@ config_threads(CONFIG *cfg, const char *config, size_t len)
 					goto err;
 				continue;
 			}
+			if (STRING_MATCH("read_only", k.str, k.len)) {
+				if ((workp->read_only = v.val) < 0)
+					goto err;
+				continue;
+			}
 			if (STRING_MATCH("read", k.str, k.len) ||
 			    STRING_MATCH("reads", k.str, k.len)) {
 				if ((workp->read = v.val) < 0)
@@ -259,6 +264,9 @@ config_threads(CONFIG *cfg, const char *config, size_t len)
 		if (workp->insert == 0 &&
 		    workp->read == 0 && workp->update == 0)
 			goto err;
+		if (workp->read_only != 0 &&
+		    (workp->insert != 0 || workp->update != 0))
+			goto err;
 		cfg->workers_cnt += (u_int)workp->threads;
 	}
 
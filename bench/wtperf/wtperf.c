@@ -387,6 +387,7 @@ worker(void *arg)
 	uint64_t next_val, usecs;
 	uint8_t *op, *op_end;
 	int measure_latency, ret;
+	const char *txn_config;
 	char *value_buf, *key_buf, *value;
 
 	thread = (CONFIG_THREAD *)arg;
@@ -395,6 +396,7 @@ worker(void *arg)
 	cursors = NULL;
 	ops = 0;
 	ops_per_txn = thread->workload->ops_per_txn;
+	txn_config = thread->workload->read_only ? "read_only=true" : NULL;
 	session = NULL;
 	trk = NULL;
 	throttle_ops = 0;
@@ -433,7 +435,7 @@ worker(void *arg)
 	op_end = op + sizeof(thread->workload->ops);
 
 	if (ops_per_txn != 0 &&
-		(ret = session->begin_transaction(session, NULL)) != 0) {
+		(ret = session->begin_transaction(session, txn_config)) != 0) {
 		lprintf(cfg, ret, 0, "First transaction begin failed");
 		goto err;
 	}
@@ -608,7 +610,7 @@ op_err:			lprintf(cfg, ret, 0,
 				goto err;
 			}
 			if ((ret = session->begin_transaction(
-			    session, NULL)) != 0) {
+			    session, txn_config)) != 0) {
 				lprintf(cfg, ret, 0,
 				    "Worker transaction commit failed");
 				goto err;
@@ -1403,6 +1405,8 @@ execute_workload(CONFIG *cfg)
 {
 	CONFIG_THREAD *threads;
 	WORKLOAD *workp;
+	WT_CONNECTION *conn;
+	WT_SESSION **sessions;
 	uint64_t last_ckpts, last_inserts, last_reads, last_updates;
 	uint32_t interval, run_ops, run_time;
 	u_int i;
@@ -1415,6 +1419,28 @@ execute_workload(CONFIG *cfg)
 	last_ckpts = last_inserts = last_reads = last_updates = 0;
 	ret = 0;
 
+	sessions = NULL;
+
+	/*
+	 * Open idle sessions: every session is reviewed when a page is checked
+	 * for hazard pointers, whether or not it's in use.
+	 */
+	if (cfg->session_count_idle > 0) {
+		if ((sessions = calloc((size_t)cfg->session_count_idle,
+		    sizeof(WT_SESSION *))) == NULL) {
+			ret = enomem(cfg);
+			goto err;
+		}
+		conn = cfg->conn;
+		for (i = 0; i < cfg->session_count_idle; ++i)
+			if ((ret = conn->open_session(conn,
+			    NULL, cfg->sess_config, &sessions[i])) != 0) {
+				lprintf(cfg, ret, 0,
+				    "execute_workload: idle open_session");
+				goto err;
+			}
+	}
+
 	if (cfg->warmup != 0)
 		cfg->in_warmup = 1;
 
@@ -1520,6 +1546,16 @@ err:	cfg->stop = 1;
 		if (ret == 0)
 			ret = WT_ERROR;
 	}
+
+	/* Close the idle sessions. */
+	if (sessions != NULL) {
+		for (i = 0; i < cfg->session_count_idle; ++i)
+			if (sessions[i] != NULL && (t_ret =
+			    sessions[i]->close(sessions[i], NULL)) != 0 &&
+			    ret == 0)
+				ret = t_ret;
+		free(sessions);
+	}
 	return (ret);
 }
 
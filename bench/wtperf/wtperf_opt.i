@@ -138,6 +138,9 @@ DEF_OPT_AS_UINT32(sample_rate, 50,
     "how often the latency of operations is measured. One for every operation,"
     "two for every second operation, three for every third operation etc.")
 DEF_OPT_AS_CONFIG_STRING(sess_config, "", "session configuration string")
+DEF_OPT_AS_UINT32(session_count_idle, 0,
+    "number of idle sessions to open during the workload phase; the "
+    "connection's session_max must allow for them")
 DEF_OPT_AS_CONFIG_STRING(table_config,
     "key_format=S,value_format=S,type=lsm,exclusive=true,"
     "allocation_size=4kb,internal_page_max=64kb,leaf_page_max=4kb,"
@@ -157,7 +160,9 @@ DEF_OPT_AS_STRING(threads, "", "workload configuration: each 'count' "
     "which would create 2 threads doing nothing but reads and 8 threads "
     "each doing 50% inserts and 25% reads and updates.  Allowed configuration "
     "values are 'count', 'throttle', 'reads', 'inserts', 'updates'. There are "
-    "also behavior modifiers, supported modifiers are 'ops_per_txn'")
+    "also behavior modifiers, supported modifiers are 'ops_per_txn' and "
+    "'read_only', which begins read-only transactions for workloads that "
+    "only read")
 DEF_OPT_AS_CONFIG_STRING(transaction_config, "",
     "transaction configuration string, relevant when populate_opts_per_txn "
     "is nonzero")
@@ -142,10 +142,23 @@ file_config = format_meta + [
         \c "bzip2", \c "snappy", \c "lz4" or \c "zlib" compression, these names
         are also available.  See @ref compression for more information''',
         func='__wt_compressor_confchk'),
+    Config('cache_priority', '0', r'''
+        the relative priority of the object's pages in the cache: when the
+        cache is full, pages of objects with a higher priority are kept in
+        the cache longer than pages of objects with a lower priority that
+        were used as recently; see @ref tuning_cache_priority for more
+        information''',
+        min='-100', max='100'),
     Config('cache_resident', 'false', r'''
         do not ever evict the object's pages; see @ref
         tuning_cache_resident for more information''',
         type='boolean'),
+    Config('cache_resident_max', '0', r'''
+        the maximum bytes of the cache the object's pages may use, pages
+        are evicted from an object using more, even if the cache is not
+        full; zero means no limit.  See @ref tuning_cache_priority for
+        more information''',
+        min='0'),
     Config('checksum', 'uncompressed', r'''
         configure block checksums; permitted values are <code>on</code>
         (checksum all blocks), <code>off</code> (checksum no blocks) and
@@ -324,6 +337,14 @@ connection_runtime_config = [
                 requests''',
                 min='1', max='20'), # !!! Must match WT_ASYNC_MAX_WORKERS
             ]),
+    Config('block_cache_size', '0', r'''
+        maximum heap memory to allocate for a second tier of cache holding
+        the on-disk images of blocks, in addition to the \c cache_size.
+        Blocks read from or written to disk are kept in their on-disk
+        format, compressed if block compression is configured, so reading
+        them back into the cache requires no I/O.  If zero, block images
+        are not kept''',
+        min='0', max='10TB'),
     Config('cache_size', '100MB', r'''
         maximum heap memory to allocate for the cache. A database should
         configure either \c cache_size or \c shared_cache but not both''',
@@ -359,7 +380,17 @@ connection_runtime_config = [
     Config('eviction_dirty_target', '80', r'''
         continue evicting until the cache has less dirty memory than the
         value, as a percentage of the total cache size. Dirty pages will
-        only be evicted if the cache is full enough to trigger eviction''',
+        only be evicted if the cache is full enough to trigger eviction.
+        If write-back threads are configured, they write dirty pages
+        whenever the cache has more dirty memory than the value.  Must be
+        less than \c eviction_dirty_trigger''',
+        min=10, max=99),
+    Config('eviction_dirty_trigger', '95', r'''
+        trigger eviction of dirty pages by application threads when the
+        cache has this much dirty memory, as a percentage of the total
+        cache size.  If write-back threads are configured, the eviction
+        threads leave dirty pages to the write-back threads until this
+        much of the cache is dirty''',
         min=10, max=99),
     Config('eviction_target', '80', r'''
         continue evicting until the cache has less total memory than the
@@ -397,6 +428,29 @@ connection_runtime_config = [
     Config('eviction', '', r'''
         eviction configuration options.''',
         type='category', subconfig=[
+            Config('app_pages_max', '0', r'''
+                maximum number of pages an application thread evicts in a
+                single operation when the cache is full, 0 for no limit
+                beyond the default.  Can be overridden per session with the
+                \c eviction_pages_max session configuration''',
+                min=0, max=1000),
+            Config('app_wait_max', '0', r'''
+                maximum time in microseconds an application thread spends
+                evicting pages or waiting for space in the cache in a single
+                operation, 0 for no limit.  Once the budget is used, the
+                operation proceeds even though the cache is full.  Can be
+                overridden per session with the \c eviction_wait_max session
+                configuration.  See @ref tuning_cache_app_budget for
+                details''',
+                min=0, max=10000000),
+            Config('policy', 'lru', r'''
+                the policy used to choose pages for eviction: \c "lru"
+                evicts the least-recently used pages, \c "clock" gives
+                pages accessed since the eviction walk last visited them a
+                second chance, and \c "2q" evicts pages accessed only once
+                ahead of pages accessed repeatedly, so scans don't flush
+                the working set from the cache''',
+                choices=['lru', 'clock', '2q']),
             Config('threads_max', '1', r'''
                 maximum number of threads WiredTiger will start to help evict
                 pages from cache. The number of threads started will vary
@@ -407,6 +461,20 @@ connection_runtime_config = [
                 pages from cache. The number of threads currently running will
                 vary depending on the current eviction load''',
                 min=1, max=20),
+            Config('write_throttle', 'false', r'''
+                throttle application threads writing to the cache when
+                dirty bytes grow faster than eviction cleans them: once the
+                cache has more dirty memory than \c eviction_dirty_target,
+                writes are admitted as eviction cleans pages, readers are
+                not affected''',
+                type='boolean'),
+            Config('writeback_threads', '0', r'''
+                number of threads WiredTiger will start to write dirty leaf
+                pages in the background when the cache has more dirty memory
+                than \c eviction_dirty_target, so clean pages are available
+                when eviction is triggered.  See @ref tuning_cache_writeback
+                for details''',
+                min=0, max=20),
             ]),
     Config('shared_cache', '', r'''
         shared cache configuration options. A database should configure
@@ -498,6 +566,16 @@ connection_runtime_config = [
 ]
 
 session_config = [
+    Config('eviction_pages_max', '0', r'''
+        maximum number of pages an operation in this session evicts when
+        the cache is full, 0 to use the connection's
+        \c eviction=(app_pages_max) setting''',
+        min=0, max=1000),
+    Config('eviction_wait_max', '0', r'''
+        maximum time in microseconds an operation in this session spends
+        evicting pages or waiting for space in the cache, 0 to use the
+        connection's \c eviction=(app_wait_max) setting''',
+        min=0, max=10000000),
     Config('isolation', 'read-committed', r'''
         the default isolation level for operations in this session''',
         choices=['read-uncommitted', 'read-committed', 'snapshot']),
@@ -510,6 +588,20 @@ common_wiredtiger_open = [
         should be used (4KB on Linux systems when direct I/O is configured,
         zero elsewhere)''',
         min='-1', max='1MB'),
+    Config('cache_warmup', '', r'''
+        save the list of pages in the cache at each checkpoint and when the
+        database is closed, and read those pages back into the cache in the
+        background when the database is next opened.  See
+        @ref tuning_cache_warmup for more information''',
+        type='category', subconfig=[
+        Config('enabled', 'false', r'''
+            save and restore the cache's contents''',
+            type='boolean'),
+        Config('threads', '2', r'''
+            the number of threads reading pages back into the cache when
+            the database is opened''',
+            min='1', max='20'),
+        ]),
     Config('checkpoint_sync', 'true', r'''
         flush files to stable storage when closing or writing
         checkpoints''',
@@ -561,6 +653,13 @@ common_wiredtiger_open = [
         Config('file_max', '100MB', r'''
             the maximum size of log files''',
             min='100KB', max='2GB'),
+        Config('format', 'full', r'''
+            the format of the operations in transaction log records.  The
+            \c "compact" format stores each row-store key as the length of
+            the prefix it shares with the previous key of the same file in
+            the record, followed by the rest of the key, see
+            @ref tune_durability_compact''',
+            choices=['compact', 'full']),
         Config('path', '', r'''
             the path to a directory into which the log files are written.
             If the value is not an absolute path name, the files are created
@@ -581,6 +680,19 @@ common_wiredtiger_open = [
         RPC server for primary processes and use RPC for secondary
         processes). <b>Not yet supported in WiredTiger</b>''',
         type='boolean'),
+    Config('numa', '', r'''
+        partition the cache between NUMA nodes.  See
+        @ref tuning_cache_numa for more information''',
+        type='category', subconfig=[
+        Config('enabled', 'false', r'''
+            track each node's share of the cache, and divide the eviction
+            queues and eviction worker threads between the nodes''',
+            type='boolean'),
+        Config('nodes', '0', r'''
+            the number of nodes to partition the cache between, with CPUs
+            assigned to nodes in turn; 0 to use the system's nodes''',
+            min='0', max='64', undoc=True),
+        ]),
     Config('session_max', '100', r'''
         maximum expected number of sessions (including server
         threads)''',
@@ -701,6 +813,13 @@ methods = {
         ignore the encodings for the key and value, manage data as if
         the formats were \c "u".  See @ref cursor_raw for details''',
         type='boolean'),
+    Config('read_once', 'false', r'''
+        pages read into the cache by this cursor are marked as the first
+        candidates for eviction, and pages already in the cache are not
+        made more recently used by this cursor's operations.  Intended
+        for large scans that should not displace the working set from
+        the cache.  See @ref tuning_cache_read_once for details''',
+        type='boolean'),
     Config('readonly', 'false', r'''
         only query operations are supported by this cursor. An error is
         returned if a modification is attempted using the cursor.  The
@@ -766,8 +885,16 @@ methods = {
         using the application's message handler, intended for debugging''',
         type='boolean')
 ]),
+'session.write_batch' : Method([]),
 
 'session.begin_transaction' : Method([
+    Config('conflict_timeout', '0', r'''
+        maximum time in milliseconds to wait for a conflicting transaction
+        to commit or roll back when updating data with snapshot isolation.
+        If the conflicting transaction rolls back, the update proceeds,
+        otherwise ::WT_ROLLBACK is returned.  Zero returns
+        ::WT_ROLLBACK without waiting''',
+        min='0'),
     Config('isolation', '', r'''
         the isolation level for this transaction; defaults to the
         session's isolation level''',
@@ -776,16 +903,62 @@ methods = {
         name of the transaction for tracing and debugging'''),
     Config('priority', 0, r'''
         priority of the transaction for resolving conflicts.
-        Transactions with higher values are less likely to abort''',
+        Transactions with higher values are less likely to abort: when
+        waiting on a conflict, a transaction with a higher priority, or
+        the same priority and started updating earlier, asks the
+        conflicting transaction to roll back''',
         min='-100', max='100'),
+    Config('read_only', 'false', r'''
+        the transaction only reads data: it never allocates a transaction
+        ID, takes its snapshot without joining the scans that move the
+        oldest transaction ID forward, and fails with \c EINVAL if it
+        updates data''',
+        type='boolean'),
+    Config('read_timestamp', '0', r'''
+        read as of a timestamp: updates committed with a later timestamp
+        are not visible.  Requires snapshot isolation, and the timestamp
+        may not be older than the oldest timestamp set with
+        WT_CONNECTION::set_timestamp.  Zero reads the most recent
+        committed updates''',
+        min='0'),
     Config('sync', '', r'''
         whether to sync log records when the transaction commits,
         inherited from ::wiredtiger_open \c transaction_sync''',
         type='boolean'),
 ]),
 
-'session.commit_transaction' : Method([]),
-'session.rollback_transaction' : Method([]),
+'session.prepare_transaction' : Method([
+    Config('prepare_id', '0', r'''
+        a non-zero identifier for the transaction, chosen by the
+        application and unique among prepared transactions.  A prepared
+        transaction recovered when the database is opened is resolved by
+        passing its identifier to WT_SESSION::commit_transaction or
+        WT_SESSION::rollback_transaction''',
+        min='0'),
+]),
+'session.commit_transaction' : Method([
+    Config('commit_timestamp', '0', r'''
+        set the commit timestamp of the transaction's updates, which must
+        be newer than the oldest timestamp set with
+        WT_CONNECTION::set_timestamp.  Zero commits without a timestamp,
+        the updates are visible to transactions reading at any
+        timestamp''',
+        min='0'),
+    Config('prepare_id', '0', r'''
+        commit the prepared transaction with this identifier recovered
+        when the database was opened, rather than the session's
+        transaction, returning ::WT_NOTFOUND if there is no such
+        transaction''',
+        min='0'),
+]),
+'session.rollback_transaction' : Method([
+    Config('prepare_id', '0', r'''
+        roll back the prepared transaction with this identifier recovered
+        when the database was opened, rather than the session's
+        transaction, returning ::WT_NOTFOUND if there is no such
+        transaction''',
+        min='0'),
+]),
 
 'session.checkpoint' : Method([
     Config('drop', '', r'''
@@ -841,6 +1014,15 @@ methods = {
         type='boolean'),
 ]),
 'connection.reconfigure' : Method(connection_runtime_config),
+'connection.set_timestamp' : Method([
+    Config('oldest_timestamp', '0', r'''
+        the oldest timestamp at which transactions may read.  Updates
+        with a later commit timestamp are kept in cache so older
+        versions can be read, updates at or before it can be discarded
+        once no running transaction reads at an older timestamp.  The
+        oldest timestamp may not move backwards''',
+        min='0'),
+]),
 
 'connection.load_extension' : Method([
     Config('config', '', r'''
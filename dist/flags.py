@@ -39,14 +39,17 @@ flags = {
         'READ_NO_EVICT',
         'READ_NO_GEN',
         'READ_NO_WAIT',
+        'READ_ONCE',
         'READ_PREV',
         'READ_SKIP_INTL',
         'READ_TRUNCATE',
+        'READ_WARMUP',
         'READ_WONT_NEED',
     ],
     'rec_write' : [
         'EVICTING',
         'SKIP_UPDATE_ERR',
+        'SKIP_UPDATE_LOOKASIDE',
         'SKIP_UPDATE_RESTORE',
     ],
     'txn_log_checkpoint' : [
@@ -300,13 +300,18 @@ for optype in log_data.optypes:
     if not optype.fields:
         continue
 
+    # Wrap the call if it doesn't fit on a line.
+    print_func = '__wt_logop_' + optype.name + '_print'
+    print_call = '%s(session, pp, end, out)' % print_func
+    if len(print_call) > 80 - 2 * 8 - len('WT_RET();'):
+        print_call = '%s(\n\t\t    session, pp, end, out)' % print_func
     tfile.write('''
 \tcase %(macro)s:
-\t\tWT_RET(%(print_func)s(session, pp, end, out));
+\t\tWT_RET(%(print_call)s);
 \t\tbreak;
 ''' % {
     'macro' : optype.macro_name(),
-    'print_func' : '__wt_logop_' + optype.name + '_print',
+    'print_call' : print_call,
 })
 
 tfile.write('''
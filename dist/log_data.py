@@ -35,6 +35,14 @@ rectypes = [
 
     # Debugging message in the log
     LogRecordType('message', 'message', [('string', 'message')]),
+
+    # A transaction prepared for a two-phase commit, followed by a list of
+    # log operations like a commit record, and the records resolving it.
+    LogRecordType('prepare', 'transaction prepare', [('uint64', 'prepare_id')]),
+    LogRecordType('prepare_commit', 'prepared transaction commit',
+        [('uint64', 'prepare_id')]),
+    LogRecordType('prepare_rollback', 'prepared transaction rollback',
+        [('uint64', 'prepare_id')]),
 ]
 
 class LogOperationType:
@@ -60,4 +68,13 @@ optypes = [
     LogOperationType('row_truncate', 'row truncate',
         [('uint32', 'fileid'), ('item', 'start'), ('item', 'stop'),
             ('uint32', 'mode')]),
+
+    # Row-store operations in compact log records: the key is the length of
+    # the prefix it shares with the previous key of the same file in the
+    # record, followed by the rest of the key.
+    LogOperationType('row_put_compact', 'row put, compact key',
+        [('uint32', 'fileid'), ('uint32', 'prefix'), ('item', 'suffix'),
+            ('item', 'value')]),
+    LogOperationType('row_remove_compact', 'row remove, compact key',
+        [('uint32', 'fileid'), ('uint32', 'prefix'), ('item', 'suffix')]),
 ]
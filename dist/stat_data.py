@@ -136,6 +136,12 @@ connection_stats = [
     BlockStat('block_byte_map_read', 'mapped bytes read'),
     BlockStat('block_byte_read', 'bytes read'),
     BlockStat('block_byte_write', 'bytes written'),
+    BlockStat('block_cache_bytes',
+        'block cache bytes currently in use', 'no_clear,no_scale'),
+    BlockStat('block_cache_evict', 'block cache blocks evicted'),
+    BlockStat('block_cache_hit', 'block cache hits'),
+    BlockStat('block_cache_insert', 'block cache blocks inserted'),
+    BlockStat('block_cache_miss', 'block cache misses'),
     BlockStat('block_map_read', 'mapped blocks read'),
     BlockStat('block_preload', 'blocks pre-loaded'),
     BlockStat('block_read', 'blocks read'),
@@ -156,12 +162,17 @@ connection_stats = [
         'no_clear,no_scale'),
     CacheStat('cache_bytes_max',
         'maximum bytes configured', 'no_clear,no_scale'),
+    CacheStat('cache_bytes_numa_max',
+        'bytes currently in the cache on the most used NUMA node',
+        'no_clear,no_scale'),
     CacheStat('cache_bytes_overflow',
         'tracked bytes belonging to overflow pages in the cache',
         'no_clear,no_scale'),
     CacheStat('cache_bytes_read', 'bytes read into cache'),
     CacheStat('cache_bytes_write', 'bytes written from cache'),
     CacheStat('cache_eviction_app', 'pages evicted by application threads'),
+    CacheStat('cache_eviction_app_budget',
+        'application eviction stopped by the eviction budget'),
     CacheStat('cache_eviction_clean', 'unmodified pages evicted'),
     CacheStat('cache_eviction_deepen',
         'page split during eviction deepened the tree'),
@@ -177,12 +188,28 @@ connection_stats = [
         'failed eviction of pages that exceeded the in-memory maximum'),
     CacheStat('cache_eviction_hazard', 'hazard pointer blocked page eviction'),
     CacheStat('cache_eviction_internal', 'internal pages evicted'),
+    CacheStat('cache_eviction_lookaside',
+        'pages evicted using the lookaside table'),
     CacheStat('cache_eviction_maximum_page_size',
         'maximum page size at eviction', 'max_aggregate,no_scale'),
+    CacheStat('cache_eviction_numa_remote',
+        'eviction candidates taken from another NUMA node'),
+    CacheStat('cache_eviction_numa_skip',
+        'pages skipped by eviction, NUMA node within its share'),
+    CacheStat('cache_eviction_queue_busy',
+        'eviction candidate queue busy'),
     CacheStat('cache_eviction_queue_empty',
         'eviction server candidate queue empty when topping up'),
     CacheStat('cache_eviction_queue_not_empty',
         'eviction server candidate queue not empty when topping up'),
+    CacheStat('cache_eviction_queue_other',
+        'eviction candidates taken from another queue'),
+    CacheStat('cache_eviction_queue_stall',
+        'eviction candidate queues empty when evicting'),
+    CacheStat('cache_eviction_quota',
+        'eviction passes for objects over their resident maximum'),
+    CacheStat('cache_eviction_second_chance',
+        'pages given a second chance by eviction'),
     CacheStat('cache_eviction_server_evicting',
         'eviction server evicting pages'),
     CacheStat('cache_eviction_server_not_evicting',
@@ -191,16 +218,38 @@ connection_stats = [
         'eviction server unable to reach eviction goal'),
     CacheStat('cache_eviction_split', 'pages split during eviction'),
     CacheStat('cache_eviction_walk', 'pages walked for eviction'),
+    CacheStat('cache_eviction_walk_score_skip',
+        'files skipped by eviction walks, low eviction score'),
     CacheStat('cache_eviction_worker_evicting',
         'eviction worker thread evicting pages'),
+    CacheStat('cache_eviction_worker_walk',
+        'eviction worker thread walking files'),
     CacheStat('cache_inmem_split', 'in-memory page splits'),
+    CacheStat('cache_lookaside_insert', 'lookaside table insert calls'),
+    CacheStat('cache_lookaside_remove', 'lookaside table remove calls'),
     CacheStat('cache_overhead', 'percentage overhead', 'no_clear,no_scale'),
     CacheStat('cache_pages_dirty',
         'tracked dirty pages in the cache', 'no_clear,no_scale'),
     CacheStat('cache_pages_inuse',
         'pages currently held in the cache', 'no_clear,no_scale'),
+    CacheStat('cache_pool_pressure',
+        'shared cache pressure (per mille)', 'no_clear,no_scale'),
+    CacheStat('cache_obsolete_pages',
+        'pages with obsolete updates discarded in the background'),
+    CacheStat('cache_obsolete_updates',
+        'obsolete updates discarded in the background'),
     CacheStat('cache_read', 'pages read into cache'),
+    CacheStat('cache_read_lookaside',
+        'pages read into cache requiring lookaside entries'),
+    CacheStat('cache_read_once',
+        'pages read into cache by read-once cursors'),
+    CacheStat('cache_warmup_read', 'pages read into cache by warm-up'),
+    CacheStat('cache_warmup_saved', 'pages listed for cache warm-up'),
     CacheStat('cache_write', 'pages written from cache'),
+    CacheStat('cache_write_throttle', 'application writes throttled'),
+    CacheStat('cache_write_throttle_time',
+        'application write throttle time (usecs)'),
+    CacheStat('cache_writeback', 'pages written by write-back threads'),
 
     ##########################################
     # Dhandle statistics
@@ -220,6 +269,8 @@ connection_stats = [
     LogStat('log_bytes_payload', 'log bytes of payload data'),
     LogStat('log_bytes_written', 'log bytes written'),
     LogStat('log_close_yields', 'yields waiting for previous log file close'),
+    LogStat('log_compact_saved',
+        'log bytes saved by compact operation format'),
     LogStat('log_compress_len', 'total size of compressed records'),
     LogStat('log_compress_mem', 'total in-memory size of compressed records'),
     LogStat('log_compress_small', 'log records too small to compress'),
@@ -231,25 +282,28 @@ connection_stats = [
         'number of pre-allocated log files to create', 'no_clear,no_scale'),
     LogStat('log_prealloc_used', 'pre-allocated log files used'),
     LogStat('log_reads', 'log read operations'),
+    LogStat('log_release_waits', 'log release waits for earlier writes'),
     LogStat('log_release_write_lsn', 'log release advances write LSN'),
     LogStat('log_scan_records', 'records processed by log scan'),
     LogStat('log_scan_rereads', 'log scan records requiring two reads'),
     LogStat('log_scans', 'log scan operations'),
     LogStat('log_sync', 'log sync operations'),
     LogStat('log_sync_dir', 'log sync_dir operations'),
+    LogStat('log_sync_requests', 'log sync requests'),
     LogStat('log_writes', 'log write operations'),
     LogStat('log_write_lsn', 'log server thread advances write LSN'),
+    LogStat('log_writer_writes', 'log writer thread writes'),
 
+    LogStat('log_slot_allocate_waits',
+        'consolidated slot joins waiting for log space allocation'),
     LogStat('log_slot_consolidated', 'logging bytes consolidated'),
     LogStat('log_slot_closes', 'consolidated slot closures'),
+    LogStat('log_slot_join_retries', 'consolidated slot join retries'),
     LogStat('log_slot_joins', 'consolidated slot joins'),
-    LogStat('log_slot_races', 'consolidated slot join races'),
-    LogStat('log_slot_switch_fails',
-        'slots selected for switching that were unavailable'),
-    LogStat('log_slot_toobig', 'record size exceeded maximum'),
+    LogStat('log_slot_switch_waits',
+        'consolidated slot switches waiting for a free slot'),
     LogStat('log_slot_toosmall',
         'failed to find a slot large enough for record'),
-    LogStat('log_slot_transitions', 'consolidated slot join transitions'),
 
     ##########################################
     # Reconciliation statistics
@@ -290,8 +344,29 @@ connection_stats = [
         'transaction range of IDs currently pinned',
         'no_aggregate,no_clear,no_scale'),
     TxnStat('txn_commit', 'transactions committed'),
+    TxnStat('txn_conflict_wait', 'update conflicts waited for'),
+    TxnStat('txn_conflict_wait_abort',
+        'update conflict waits ended by the conflicting transaction '
+        'rolling back'),
+    TxnStat('txn_conflict_wait_time',
+        'update conflict wait time (usecs)'),
+    TxnStat('txn_conflict_wait_timeout', 'update conflict waits timed out'),
+    TxnStat('txn_conflict_wound',
+        'conflicting transactions asked to roll back'),
     TxnStat('txn_fail_cache', 'transaction failures due to cache overflow'),
+    TxnStat('txn_id_batch',
+        'transaction ID batches allocated for racing threads'),
+    TxnStat('txn_prepare', 'transactions prepared'),
+    TxnStat('txn_prepare_commit', 'prepared transactions committed'),
+    TxnStat('txn_prepare_recover', 'prepared transactions recovered'),
+    TxnStat('txn_prepare_rollback', 'prepared transactions rolled back'),
+    TxnStat('txn_read_chain', 'update chains read'),
+    TxnStat('txn_readonly', 'read-only transactions'),
+    TxnStat('txn_readonly_update',
+        'read-only transaction update attempts'),
+    TxnStat('txn_read_chain_entries', 'update chain entries read'),
     TxnStat('txn_rollback', 'transactions rolled back'),
+    TxnStat('txn_update_conflict', 'update conflicts'),
 
     ##########################################
     # LSM statistics
@@ -330,6 +405,10 @@ connection_stats = [
     CursorStat('cursor_search', 'cursor search calls'),
     CursorStat('cursor_search_near', 'cursor search near calls'),
     CursorStat('cursor_update', 'cursor update calls'),
+    CursorStat('cursor_write_batch', 'write batch calls'),
+    CursorStat('cursor_write_batch_leaf',
+        'write batch operations applied without a tree search'),
+    CursorStat('cursor_write_batch_ops', 'write batch operations'),
 
     ##########################################
     # Yield statistics
@@ -443,6 +522,8 @@ dsrc_stats = [
     ##########################################
     # Cache and eviction statistics
     ##########################################
+    CacheStat('cache_bytes_inuse',
+        'bytes currently in the cache', 'no_clear,no_scale'),
     CacheStat('cache_bytes_read', 'bytes read into cache'),
     CacheStat('cache_bytes_write', 'bytes written from cache'),
     CacheStat('cache_eviction_checkpoint', 'checkpoint blocked page eviction'),
@@ -455,12 +536,17 @@ dsrc_stats = [
     CacheStat('cache_eviction_hazard', 'hazard pointer blocked page eviction'),
     CacheStat('cache_eviction_internal', 'internal pages evicted'),
     CacheStat('cache_eviction_split', 'pages split during eviction'),
+    CacheStat('cache_eviction_walk', 'pages walked for eviction'),
+    CacheStat('cache_eviction_walk_passes', 'eviction walk passes of a file'),
+    CacheStat('cache_eviction_walk_queued',
+        'pages queued for eviction by walks'),
     CacheStat('cache_inmem_split', 'in-memory page splits'),
     CacheStat('cache_overflow_value',
         'overflow values cached in memory', 'no_scale'),
     CacheStat('cache_read', 'pages read into cache'),
     CacheStat('cache_read_overflow', 'overflow pages read into cache'),
     CacheStat('cache_write', 'pages written from cache'),
+    CacheStat('cache_writeback', 'pages written by write-back threads'),
 
     ##########################################
     # Compression statistics
@@ -643,6 +643,20 @@ session_ops(WT_SESSION *session)
 	/*! [Create a cache-resident object] */
 	ret = session->drop(session, "table:mytable", NULL);
 
+	/*! [Create objects with cache priorities] */
+	/*
+	 * Keep the pages of an index in the cache in preference to the pages
+	 * of a log table, and limit the log table to 100MB of the cache.
+	 */
+	ret = session->create(session, "table:myindex",
+	    "key_format=S,value_format=S,cache_priority=50");
+	ret = session->create(session, "table:mylog",
+	    "key_format=r,value_format=S,"
+	    "cache_priority=-50,cache_resident_max=100MB");
+	/*! [Create objects with cache priorities] */
+	ret = session->drop(session, "table:myindex", NULL);
+	ret = session->drop(session, "table:mylog", NULL);
+
 	{
 	/* Create a table for the session operations. */
 	ret = session->create(
@@ -698,6 +712,39 @@ session_ops(WT_SESSION *session)
 	}
 	}
 
+	{
+	/*! [Apply a write batch] */
+	/*
+	 * Apply several operations in a single call and transaction.  Keys and
+	 * values are raw items: strings include their terminating nul bytes.
+	 */
+	WT_BATCH_OP ops[3];
+	WT_CURSOR *cursor;
+
+	ret = session->open_cursor(
+	    session, "table:mytable", NULL, NULL, &cursor);
+
+	memset(ops, 0, sizeof(ops));
+	ops[0].cursor = ops[1].cursor = ops[2].cursor = cursor;
+	ops[0].type = WT_BATCH_INSERT;
+	ops[0].key.data = "June15";
+	ops[0].key.size = sizeof("June15");
+	ops[0].value.data = "rain";
+	ops[0].value.size = sizeof("rain");
+	ops[1].type = WT_BATCH_UPDATE;
+	ops[1].key.data = "June01";
+	ops[1].key.size = sizeof("June01");
+	ops[1].value.data = "sun";
+	ops[1].value.size = sizeof("sun");
+	ops[2].type = WT_BATCH_REMOVE;
+	ops[2].key.data = "June30";
+	ops[2].key.size = sizeof("June30");
+
+	ret = session->write_batch(session, ops, 3, NULL);
+	/*! [Apply a write batch] */
+	ret = cursor->close(cursor);
+	}
+
 	/*! [Upgrade a table] */
 	ret = session->upgrade(session, "table:mytable", NULL);
 	/*! [Upgrade a table] */
@@ -770,6 +817,60 @@ transaction_ops(WT_CONNECTION *conn, WT_SESSION *session)
 	ret = session->commit_transaction(session, NULL);
 	/*! [transaction isolation] */
 
+	/*! [transaction read-only] */
+	/* Read in a read-only transaction. */
+	ret = session->begin_transaction(
+	    session, "isolation=snapshot,read_only=true");
+	cursor->set_key(cursor, "some-key");
+	ret = cursor->search(cursor);
+	ret = session->commit_transaction(session, NULL);
+	/*! [transaction read-only] */
+
+	/*! [transaction conflict wait] */
+	/*
+	 * Wait up to 50 milliseconds for a conflicting transaction to resolve
+	 * before failing with WT_ROLLBACK.
+	 */
+	ret = session->begin_transaction(
+	    session, "isolation=snapshot,conflict_timeout=50,priority=10");
+	cursor->set_key(cursor, "some-key");
+	cursor->set_value(cursor, "some-value");
+	ret = cursor->update(cursor);
+	ret = session->commit_transaction(session, NULL);
+	/*! [transaction conflict wait] */
+
+	/*! [transaction prepare] */
+	/*
+	 * Prepare a transaction, then commit it: if the database is not closed
+	 * cleanly before the commit, the prepared transaction is recovered, and
+	 * can be committed by its identifier.
+	 */
+	ret = session->begin_transaction(session, NULL);
+	cursor->set_key(cursor, "some-key");
+	cursor->set_value(cursor, "some-value");
+	ret = cursor->update(cursor);
+	ret = session->prepare_transaction(session, "prepare_id=1");
+	ret = session->commit_transaction(session, NULL);
+
+	/* Commit a prepared transaction recovered when opening the database. */
+	ret = session->commit_transaction(session, "prepare_id=1");
+	/*! [transaction prepare] */
+
+	/*! [transaction timestamps] */
+	/* Commit an update at a timestamp, then read as of that timestamp. */
+	ret = session->begin_transaction(session, NULL);
+	cursor->set_key(cursor, "some-key");
+	cursor->set_value(cursor, "some-value");
+	ret = cursor->update(cursor);
+	ret = session->commit_transaction(session, "commit_timestamp=20");
+
+	ret = session->begin_transaction(
+	    session, "isolation=snapshot,read_timestamp=20");
+	cursor->set_key(cursor, "some-key");
+	ret = cursor->search(cursor);
+	ret = session->commit_transaction(session, NULL);
+	/*! [transaction timestamps] */
+
 	/*! [session isolation configuration] */
 	/* Open a session configured for read-uncommitted isolation. */
 	ret = conn->open_session(
@@ -892,6 +993,10 @@ connection_ops(WT_CONNECTION *conn)
 	}
 	/*! [Check if the database is newly created] */
 
+	/*! [Set the oldest timestamp] */
+	ret = conn->set_timestamp(conn, "oldest_timestamp=10");
+	/*! [Set the oldest timestamp] */
+
 	{
 	/*! [Open a session] */
 	WT_SESSION *session;
@@ -1104,6 +1209,53 @@ main(void)
 	if (ret == 0)
 		(void)conn->close(conn, NULL);
 
+	/*! [Eviction write-back configuration] */
+	/*
+	 * Configure two threads to write dirty pages once the cache is 40%
+	 * dirty, application threads help once the cache is 60% dirty.
+	 */
+	ret = wiredtiger_open(home, NULL,
+	    "create,eviction_dirty_target=40,eviction_dirty_trigger=60,"
+	    "eviction=(writeback_threads=2)", &conn);
+	/*! [Eviction write-back configuration] */
+	if (ret == 0)
+		(void)conn->close(conn, NULL);
+
+	/*! [Eviction budget configuration] */
+	/*
+	 * Limit application threads to 2 milliseconds of eviction per
+	 * operation, and throttle writers dirtying the cache faster than
+	 * eviction can clean it.
+	 */
+	ret = wiredtiger_open(home, NULL,
+	    "create,eviction=(app_wait_max=2000,write_throttle=true)", &conn);
+	/*! [Eviction budget configuration] */
+	if (ret == 0)
+		(void)conn->close(conn, NULL);
+
+	/*! [Block cache configuration] */
+	/*
+	 * Keep up to 1GB of on-disk block images in memory, in addition to the
+	 * 500MB cache.
+	 */
+	ret = wiredtiger_open(home, NULL,
+	    "create,cache_size=500M,block_cache_size=1GB", &conn);
+	/*! [Block cache configuration] */
+	if (ret == 0)
+		(void)conn->close(conn, NULL);
+
+	/*! [Cache warm-up configuration] */
+	/*
+	 * List the pages in the cache at each checkpoint, and read them back
+	 * into the cache using 4 threads when the database is next opened.
+	 */
+	ret = wiredtiger_open(home, NULL,
+	    "create,cache_size=500M,cache_warmup=(enabled=true,threads=4)",
+	    &conn);
+	/*! [Cache warm-up configuration] */
+	if (ret == 0)
+		(void)conn->close(conn, NULL);
+
 	/*! [Statistics configuration] */
 	ret = wiredtiger_open(home, NULL, "create,statistics=(all)", &conn);
 	/*! [Statistics configuration] */
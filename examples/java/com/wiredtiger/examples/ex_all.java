@@ -585,6 +585,20 @@ session_ops(Session session)
     /*! [Create a cache-resident object] */
     ret = session.drop("table:mytable", null);
 
+    /*! [Create objects with cache priorities] */
+    /*
+     * Keep the pages of an index in the cache in preference to the pages
+     * of a log table, and limit the log table to 100MB of the cache.
+     */
+    ret = session.create("table:myindex",
+        "key_format=S,value_format=S,cache_priority=50");
+    ret = session.create("table:mylog",
+        "key_format=r,value_format=S," +
+        "cache_priority=-50,cache_resident_max=100MB");
+    /*! [Create objects with cache priorities] */
+    ret = session.drop("table:myindex", null);
+    ret = session.drop("table:mylog", null);
+
     {
     /* Create a table for the session operations. */
     ret = session.create(
@@ -707,6 +721,20 @@ transaction_ops(Connection conn, Session session)
     ret = session.commit_transaction(null);
     /*! [transaction isolation] */
 
+    /*! [transaction timestamps] */
+    /* Commit an update at a timestamp, then read as of that timestamp. */
+    ret = session.begin_transaction(null);
+    cursor.putKeyString("some-key");
+    cursor.putValueString("some-value");
+    ret = cursor.update();
+    ret = session.commit_transaction("commit_timestamp=20");
+
+    ret = session.begin_transaction("isolation=snapshot,read_timestamp=20");
+    cursor.putKeyString("some-key");
+    ret = cursor.search();
+    ret = session.commit_transaction(null);
+    /*! [transaction timestamps] */
+
     /*! [session isolation configuration] */
     /* Open a session configured for read-uncommitted isolation. */
     session = conn.open_session(
@@ -759,6 +787,10 @@ connection_ops(Connection conn)
     }
     /*! [Check if the database is newly created] */
 
+    /*! [Set the oldest timestamp] */
+    ret = conn.set_timestamp("oldest_timestamp=10");
+    /*! [Set the oldest timestamp] */
+
     {
     /*! [Open a session] */
     Session session;
@@ -962,6 +994,48 @@ allExample()
     /*! [Eviction worker configuration] */
     conn.close(null);
 
+    /*! [Eviction write-back configuration] */
+    /*
+     * Configure two threads to write dirty pages once the cache is 40%
+     * dirty, application threads help once the cache is 60% dirty.
+     */
+    conn = wiredtiger.open(home,
+        "create,eviction_dirty_target=40,eviction_dirty_trigger=60," +
+        "eviction=(writeback_threads=2)");
+    /*! [Eviction write-back configuration] */
+    conn.close(null);
+
+    /*! [Eviction budget configuration] */
+    /*
+     * Limit application threads to 2 milliseconds of eviction per
+     * operation, and throttle writers dirtying the cache faster than
+     * eviction can clean it.
+     */
+    conn = wiredtiger.open(home,
+        "create,eviction=(app_wait_max=2000,write_throttle=true)");
+    /*! [Eviction budget configuration] */
+    conn.close(null);
+
+    /*! [Block cache configuration] */
+    /*
+     * Keep up to 1GB of on-disk block images in memory, in addition to the
+     * 500MB cache.
+     */
+    conn = wiredtiger.open(home,
+        "create,cache_size=500M,block_cache_size=1GB");
+    /*! [Block cache configuration] */
+    conn.close(null);
+
+    /*! [Cache warm-up configuration] */
+    /*
+     * List the pages in the cache at each checkpoint, and read them back
+     * into the cache using 4 threads when the database is next opened.
+     */
+    conn = wiredtiger.open(home,
+        "create,cache_size=500M,cache_warmup=(enabled=true,threads=4)");
+    /*! [Cache warm-up configuration] */
+    conn.close(null);
+
     /*! [Statistics configuration] */
     conn = wiredtiger.open(home, "create,statistics=(all)");
     /*! [Statistics configuration] */
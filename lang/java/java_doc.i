@@ -37,9 +37,11 @@ COPYDOC(__wt_session, WT_SESSION, log_printf)
 COPYDOC(__wt_session, WT_SESSION, rename)
 COPYDOC(__wt_session, WT_SESSION, salvage)
 COPYDOC(__wt_session, WT_SESSION, truncate)
+COPYDOC(__wt_session, WT_SESSION, write_batch)
 COPYDOC(__wt_session, WT_SESSION, upgrade)
 COPYDOC(__wt_session, WT_SESSION, verify)
 COPYDOC(__wt_session, WT_SESSION, begin_transaction)
+COPYDOC(__wt_session, WT_SESSION, prepare_transaction)
 COPYDOC(__wt_session, WT_SESSION, commit_transaction)
 COPYDOC(__wt_session, WT_SESSION, rollback_transaction)
 COPYDOC(__wt_session, WT_SESSION, checkpoint)
@@ -50,6 +52,7 @@ COPYDOC(__wt_connection, WT_CONNECTION, close)
 COPYDOC(__wt_connection, WT_CONNECTION, reconfigure)
 COPYDOC(__wt_connection, WT_CONNECTION, configure_method)
 COPYDOC(__wt_connection, WT_CONNECTION, is_new)
+COPYDOC(__wt_connection, WT_CONNECTION, set_timestamp)
 COPYDOC(__wt_connection, WT_CONNECTION, open_session)
 COPYDOC(__wt_connection, WT_CONNECTION, load_extension)
 COPYDOC(__wt_connection, WT_CONNECTION, add_data_source)
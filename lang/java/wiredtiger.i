@@ -1737,6 +1737,7 @@ WT_ASYNC_CALLBACK javaApiAsyncHandler = {javaAsyncHandler};
 %immutable __wt_cursor::value_format;
 %immutable __wt_session::connection;
 
+%ignore __wt_batch_op;
 %ignore __wt_collator;
 %ignore __wt_connection::add_collator;
 %ignore __wt_compressor;
@@ -1749,6 +1750,7 @@ WT_ASYNC_CALLBACK javaApiAsyncHandler = {javaAsyncHandler};
 %ignore __wt_item;
 %ignore __wt_lsn;
 %ignore __wt_session::msg_printf;
+%ignore __wt_session::write_batch;
 
 %ignore wiredtiger_struct_pack;
 %ignore wiredtiger_struct_size;
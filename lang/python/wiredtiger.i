@@ -902,6 +902,7 @@ int verbose_build();
 %ignore __wt_async_callback;
 %ignore __wt_collator;
 %ignore __wt_compressor;
+%ignore __wt_batch_op;
 %ignore __wt_config_item;
 %ignore __wt_data_source;
 %ignore __wt_event_handler;
@@ -915,6 +916,7 @@ int verbose_build();
 %ignore __wt_connection::add_extractor;
 %ignore __wt_connection::get_extension_api;
 %ignore __wt_session::log_printf;
+%ignore __wt_session::write_batch;
 
 OVERRIDE_METHOD(__wt_session, WT_SESSION, log_printf, (self, msg))
 
@@ -0,0 +1,253 @@
+/*-
+ * Copyright (c) 2014-2015 MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * The block cache is a second tier of cache below the page cache: it holds
+ * the on-disk images of blocks that have been read or written, keyed by the
+ * file and the block's address, so when an evicted page is read back in, the
+ * block can be copied from memory rather than read from the file.  Images
+ * are held in their on-disk format, that is, compressed if the file has
+ * block compression configured, which lets the same memory hold many more
+ * pages than the page cache could.  Images are discarded in LRU order when
+ * the cache is full, and whenever a block is freed, since its address can
+ * be reused.
+ */
+
+#define	WT_BLOCK_CACHE_BUCKET(block, offset)				\
+	(((block)->name_hash +						\
+	    (uint64_t)(offset) / (block)->allocsize) % WT_BLOCK_CACHE_HASH_SIZE)
+
+/*
+ * __block_cache_discard --
+ *	Discard a block image, the cache must be locked.
+ */
+static void
+__block_cache_discard(WT_SESSION_IMPL *session, WT_BLOCK_CACHE_ITEM *item)
+{
+	WT_BLOCK_CACHE *cache;
+
+	cache = &S2C(session)->block_cache;
+
+	TAILQ_REMOVE(&cache->hash[
+	    WT_BLOCK_CACHE_BUCKET(item->block, item->offset)], item, hashq);
+	TAILQ_REMOVE(&cache->lru, item, q);
+	cache->bytes_inuse -= item->size;
+	__wt_free(session, item);
+}
+
+/*
+ * __block_cache_trim --
+ *	Discard the least recently used block images until the cache fits in
+ *	its configured size, the cache must be locked.
+ */
+static void
+__block_cache_trim(WT_SESSION_IMPL *session)
+{
+	WT_BLOCK_CACHE *cache;
+	u_int evicted;
+
+	cache = &S2C(session)->block_cache;
+
+	for (evicted = 0; cache->bytes_inuse > cache->bytes_max; ++evicted)
+		__block_cache_discard(
+		    session, TAILQ_LAST(&cache->lru, __wt_block_cache_lru));
+	WT_STAT_FAST_CONN_INCRV(session, block_cache_evict, evicted);
+}
+
+/*
+ * __wt_block_cache_config --
+ *	Configure or reconfigure the block cache.
+ */
+int
+__wt_block_cache_config(WT_SESSION_IMPL *session, const char *cfg[])
+{
+	WT_BLOCK_CACHE *cache;
+	WT_CONFIG_ITEM cval;
+	u_int i;
+
+	cache = &S2C(session)->block_cache;
+
+	WT_RET(__wt_config_gets(session, cfg, "block_cache_size", &cval));
+
+	/*
+	 * The hash table is allocated the first time the cache is configured
+	 * and never discarded until the connection closes, so threads can test
+	 * for it without locking.
+	 */
+	if (cval.val != 0 && cache->hash == NULL) {
+		WT_RET(__wt_calloc_def(
+		    session, WT_BLOCK_CACHE_HASH_SIZE, &cache->hash));
+		for (i = 0; i < WT_BLOCK_CACHE_HASH_SIZE; ++i)
+			TAILQ_INIT(&cache->hash[i]);
+	}
+
+	__wt_spin_lock(session, &cache->lock);
+	cache->bytes_max = (uint64_t)cval.val;
+	if (cache->hash != NULL)
+		__block_cache_trim(session);
+	__wt_spin_unlock(session, &cache->lock);
+
+	return (0);
+}
+
+/*
+ * __wt_block_cache_destroy --
+ *	Discard the block cache.
+ */
+void
+__wt_block_cache_destroy(WT_SESSION_IMPL *session)
+{
+	WT_BLOCK_CACHE *cache;
+	WT_BLOCK_CACHE_ITEM *item;
+
+	cache = &S2C(session)->block_cache;
+
+	if (cache->hash == NULL)
+		return;
+
+	while ((item = TAILQ_FIRST(&cache->lru)) != NULL)
+		__block_cache_discard(session, item);
+	__wt_free(session, cache->hash);
+	cache->bytes_max = 0;
+}
+
+/*
+ * __wt_block_cache_read --
+ *	Copy a block's image from the block cache, if it's there.
+ */
+int
+__wt_block_cache_read(WT_SESSION_IMPL *session, WT_BLOCK *block,
+    WT_ITEM *buf, wt_off_t offset, uint32_t size, uint32_t cksum, int *foundp)
+{
+	WT_BLOCK_CACHE *cache;
+	WT_BLOCK_CACHE_ITEM *item;
+	uint64_t bucket;
+
+	*foundp = 0;
+
+	cache = &S2C(session)->block_cache;
+	if (cache->bytes_max == 0)
+		return (0);
+
+	/* Size the buffer first, we don't want to allocate while locked. */
+	WT_RET(__wt_buf_init(session, buf, size));
+
+	bucket = WT_BLOCK_CACHE_BUCKET(block, offset);
+	__wt_spin_lock(session, &cache->lock);
+	TAILQ_FOREACH(item, &cache->hash[bucket], hashq)
+		if (item->block == block && item->offset == offset &&
+		    item->size == size && item->cksum == cksum) {
+			memcpy(buf->mem, WT_BLOCK_CACHE_DATA(item), size);
+			buf->size = size;
+
+			TAILQ_REMOVE(&cache->lru, item, q);
+			TAILQ_INSERT_HEAD(&cache->lru, item, q);
+			*foundp = 1;
+			break;
+		}
+	__wt_spin_unlock(session, &cache->lock);
+
+	if (*foundp)
+		WT_STAT_FAST_CONN_INCR(session, block_cache_hit);
+	else
+		WT_STAT_FAST_CONN_INCR(session, block_cache_miss);
+	return (0);
+}
+
+/*
+ * __wt_block_cache_insert --
+ *	Add a block's image to the block cache, replacing any previous image
+ *	at the same address.
+ */
+int
+__wt_block_cache_insert(WT_SESSION_IMPL *session, WT_BLOCK *block,
+    const void *image, wt_off_t offset, uint32_t size, uint32_t cksum)
+{
+	WT_BLOCK_CACHE *cache;
+	WT_BLOCK_CACHE_ITEM *item, *old;
+	uint64_t bucket;
+
+	cache = &S2C(session)->block_cache;
+	if (cache->bytes_max == 0 || size > cache->bytes_max)
+		return (0);
+
+	WT_RET(__wt_calloc(
+	    session, 1, sizeof(WT_BLOCK_CACHE_ITEM) + size, &item));
+	item->block = block;
+	item->offset = offset;
+	item->size = size;
+	item->cksum = cksum;
+	memcpy(WT_BLOCK_CACHE_DATA(item), image, size);
+
+	bucket = WT_BLOCK_CACHE_BUCKET(block, offset);
+	__wt_spin_lock(session, &cache->lock);
+	TAILQ_FOREACH(old, &cache->hash[bucket], hashq)
+		if (old->block == block && old->offset == offset) {
+			__block_cache_discard(session, old);
+			break;
+		}
+	TAILQ_INSERT_HEAD(&cache->hash[bucket], item, hashq);
+	TAILQ_INSERT_HEAD(&cache->lru, item, q);
+	cache->bytes_inuse += size;
+	__block_cache_trim(session);
+	__wt_spin_unlock(session, &cache->lock);
+
+	WT_STAT_FAST_CONN_INCR(session, block_cache_insert);
+	return (0);
+}
+
+/*
+ * __wt_block_cache_remove --
+ *	Discard the image of a block being freed.
+ */
+void
+__wt_block_cache_remove(
+    WT_SESSION_IMPL *session, WT_BLOCK *block, wt_off_t offset)
+{
+	WT_BLOCK_CACHE *cache;
+	WT_BLOCK_CACHE_ITEM *item;
+	uint64_t bucket;
+
+	cache = &S2C(session)->block_cache;
+	if (cache->hash == NULL)
+		return;
+
+	bucket = WT_BLOCK_CACHE_BUCKET(block, offset);
+	__wt_spin_lock(session, &cache->lock);
+	TAILQ_FOREACH(item, &cache->hash[bucket], hashq)
+		if (item->block == block && item->offset == offset) {
+			__block_cache_discard(session, item);
+			break;
+		}
+	__wt_spin_unlock(session, &cache->lock);
+}
+
+/*
+ * __wt_block_cache_discard --
+ *	Discard all of a file's block images.
+ */
+void
+__wt_block_cache_discard(WT_SESSION_IMPL *session, WT_BLOCK *block)
+{
+	WT_BLOCK_CACHE *cache;
+	WT_BLOCK_CACHE_ITEM *item, *next;
+
+	cache = &S2C(session)->block_cache;
+	if (cache->hash == NULL)
+		return;
+
+	__wt_spin_lock(session, &cache->lock);
+	for (item = TAILQ_FIRST(&cache->lru); item != NULL; item = next) {
+		next = TAILQ_NEXT(item, q);
+		if (item->block == block)
+			__block_cache_discard(session, item);
+	}
+	__wt_spin_unlock(session, &cache->lock);
+}
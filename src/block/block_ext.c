@@ -589,6 +589,9 @@ __wt_block_free(WT_SESSION_IMPL *session,
 #ifdef HAVE_DIAGNOSTIC
 	WT_RET(__wt_block_misplaced(session, block, "free", offset, size, 1));
 #endif
+	/* The address can be reused, discard any cached image. */
+	__wt_block_cache_remove(session, block, offset);
+
 	WT_RET(__wt_block_ext_prealloc(session, 5));
 	__wt_spin_lock(session, &block->live_lock);
 	ret = __wt_block_off_free(session, block, offset, (wt_off_t)size);
@@ -101,6 +101,8 @@ __block_destroy(WT_SESSION_IMPL *session, WT_BLOCK *block)
 	bucket = block->name_hash % WT_HASH_ARRAY_SIZE;
 	WT_CONN_BLOCK_REMOVE(conn, block, bucket);
 
+	__wt_block_cache_discard(session, block);
+
 	if (block->name != NULL)
 		__wt_free(session, block->name);
 
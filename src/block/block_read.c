@@ -63,7 +63,7 @@ __wt_bm_read(WT_BM *bm, WT_SESSION_IMPL *session,
     WT_ITEM *buf, const uint8_t *addr, size_t addr_size)
 {
 	WT_BLOCK *block;
-	int mapped;
+	int found, mapped;
 	wt_off_t offset;
 	uint32_t cksum, size;
 
@@ -95,8 +95,22 @@ __wt_bm_read(WT_BM *bm, WT_SESSION_IMPL *session,
 	WT_RET(__wt_block_misplaced(
 	    session, block, "read", offset, size, bm->is_live));
 #endif
+	/*
+	 * Check the block cache, unless we're verifying the file: verify
+	 * checks what's on disk.
+	 */
+	if (!block->verify) {
+		WT_RET(__wt_block_cache_read(
+		    session, block, buf, offset, size, cksum, &found));
+		if (found)
+			return (0);
+	}
+
 	/* Read the block. */
 	WT_RET(__wt_block_read_off(session, block, buf, offset, size, cksum));
+	if (!block->verify)
+		WT_RET(__wt_block_cache_insert(
+		    session, block, buf->mem, offset, size, cksum));
 
 #ifdef HAVE_POSIX_FADVISE
 	/* Optionally discard blocks from the system's buffer cache. */
@@ -20,6 +20,9 @@ __wt_block_salvage_start(WT_SESSION_IMPL *session, WT_BLOCK *block)
 
 	allocsize = block->allocsize;
 
+	/* Salvage rewrites the file, discard any cached block images. */
+	__wt_block_cache_discard(session, block);
+
 	/* Reset the description information in the first block. */
 	WT_RET(__wt_desc_init(session, block->fh, allocsize));
 
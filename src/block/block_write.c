@@ -60,6 +60,10 @@ __wt_block_write(WT_SESSION_IMPL *session, WT_BLOCK *block,
 	WT_RET(__wt_block_write_off(
 	    session, block, buf, &offset, &size, &cksum, data_cksum, 0));
 
+	/* The block is likely to be read again when its page is evicted. */
+	WT_RET(__wt_block_cache_insert(
+	    session, block, buf->mem, offset, size, cksum));
+
 	endp = addr;
 	WT_RET(__wt_block_addr_to_buffer(block, &endp, offset, size, cksum));
 	*addr_sizep = WT_PTRDIFF(endp, addr);
@@ -411,6 +411,8 @@ __wt_btcur_next(WT_CURSOR_BTREE *cbt, int truncating)
 	flags = WT_READ_SKIP_INTL;			/* Tree walk flags. */
 	if (truncating)
 		LF_SET(WT_READ_TRUNCATE);
+	if (F_ISSET(cbt, WT_CBT_READ_ONCE))
+		LF_SET(WT_READ_ONCE);
 
 	WT_RET(__cursor_func_init(cbt, 0));
 
@@ -498,6 +498,8 @@ __wt_btcur_prev(WT_CURSOR_BTREE *cbt, int truncating)
 	flags = WT_READ_PREV | WT_READ_SKIP_INTL;	/* Tree walk flags. */
 	if (truncating)
 		LF_SET(WT_READ_TRUNCATE);
+	if (F_ISSET(cbt, WT_CBT_READ_ONCE))
+		LF_SET(WT_READ_ONCE);
 
 	WT_RET(__cursor_func_init(cbt, 0));
 
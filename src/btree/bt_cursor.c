@@ -755,6 +755,133 @@ err:	if (ret == WT_RESTART)
 	return (ret);
 }
 
+/*
+ * __cursor_batch_leaf --
+ *	Return if a write batch key belongs on the leaf page the cursor
+ *	references.  The batch is sorted, the key is no smaller than the last
+ *	key applied to the page, so only the page's upper bound is checked,
+ *	the starting key of the next page in the parent.
+ */
+static int
+__cursor_batch_leaf(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, int *leafp)
+{
+	WT_ITEM item;
+	WT_PAGE *home;
+	WT_PAGE_INDEX *pindex;
+	WT_REF *ref;
+	uint32_t slot;
+	int cmp;
+
+	*leafp = 0;
+
+	/*
+	 * Don't search for the page's slot, and give up if the page is the
+	 * last in its parent, its upper bound is in the grandparent.
+	 */
+	ref = cbt->ref;
+	home = ref->home;
+	pindex = WT_INTL_INDEX_COPY(home);
+	slot = ref->ref_hint;
+	if (slot + 1 >= pindex->entries || pindex->index[slot] != ref)
+		return (0);
+
+	__wt_ref_key(home, pindex->index[slot + 1], &item.data, &item.size);
+	WT_RET(__wt_compare(session, cbt->btree->collator,
+	    &cbt->iface.key, &item, &cmp));
+	*leafp = cmp < 0 ? 1 : 0;
+	return (0);
+}
+
+/*
+ * __wt_btcur_batch --
+ *	Apply a write batch operation to a row-store tree.  The cursor stays
+ *	positioned after a successful operation, if the batch's next key is on
+ *	the same leaf page, only that page is searched.
+ */
+int
+__wt_btcur_batch(WT_CURSOR_BTREE *cbt, WT_BATCH_OPTYPE type)
+{
+	WT_BTREE *btree;
+	WT_CURSOR *cursor;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+	int insert, leaf;
+
+	btree = cbt->btree;
+	cursor = &cbt->iface;
+	session = (WT_SESSION_IMPL *)cursor->session;
+	insert = type == WT_BATCH_REMOVE ? 0 : 1;
+	leaf = 0;
+
+	WT_ASSERT(session, btree->type == BTREE_ROW);
+
+	WT_RET(__cursor_size_chk(session, &cursor->key));
+	if (insert) {
+		WT_RET(__cursor_size_chk(session, &cursor->value));
+
+		/*
+		 * The tree is no longer empty: eviction should pay attention
+		 * to it, and it's no longer possible to bulk-load into it.
+		 */
+		if (btree->bulk_load_ok) {
+			btree->bulk_load_ok = 0;
+			__wt_btree_evictable(session, 1);
+		}
+	}
+
+	if (cbt->ref != NULL)
+		WT_WITH_PAGE_INDEX(session,
+		    ret = __cursor_batch_leaf(session, cbt, &leaf));
+	WT_ERR(ret);
+
+retry:	if (leaf) {
+		WT_STAT_FAST_CONN_INCR(session, cursor_write_batch_leaf);
+
+		/* A failed single-page search releases the page. */
+		if ((ret = __wt_row_search(
+		    session, &cursor->key, cbt->ref, cbt, insert)) != 0) {
+			cbt->ref = NULL;
+			WT_ERR(ret);
+		}
+	} else {
+		WT_ERR(__cursor_func_init(cbt, 1));
+		WT_ERR(__cursor_row_search(session, cbt, insert));
+	}
+
+	switch (type) {
+	case WT_BATCH_INSERT:
+		if (!F_ISSET(cursor, WT_CURSTD_OVERWRITE) &&
+		    cbt->compare == 0 && __cursor_valid(cbt, NULL))
+			WT_ERR(WT_DUPLICATE_KEY);
+		ret = __cursor_row_modify(session, cbt, 0);
+		break;
+	case WT_BATCH_REMOVE:
+		WT_ERR(__curfile_update_check(cbt));
+		if (cbt->compare == 0 && __cursor_valid(cbt, NULL))
+			ret = __cursor_row_modify(session, cbt, 1);
+		else if (!F_ISSET(cursor, WT_CURSTD_OVERWRITE))
+			ret = WT_NOTFOUND;
+		break;
+	case WT_BATCH_UPDATE:
+		if (!F_ISSET(cursor, WT_CURSTD_OVERWRITE)) {
+			WT_ERR(__curfile_update_check(cbt));
+			if (cbt->compare != 0 || !__cursor_valid(cbt, NULL))
+				WT_ERR(WT_NOTFOUND);
+		}
+		ret = __cursor_row_modify(session, cbt, 0);
+		break;
+	WT_ILLEGAL_VALUE_ERR(session);
+	}
+
+err:	if (ret == WT_RESTART) {
+		leaf = 0;
+		goto retry;
+	}
+	if (ret != 0)
+		WT_TRET(__cursor_reset(cbt));
+	return (ret);
+}
+
 /*
  * __wt_btcur_next_random --
  *	Move to a random record in the tree.
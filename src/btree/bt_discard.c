@@ -415,7 +415,7 @@ __free_update_list(WT_SESSION_IMPL *session, WT_UPDATE *upd)
 		WT_ASSERT(session,
 		    F_ISSET(session, WT_SESSION_DISCARD_FORCE) ||
 		    upd->txnid == WT_TXN_ABORTED ||
-		    __wt_txn_visible_all(session, upd->txnid));
+		    __wt_txn_upd_visible_all(session, upd));
 
 		next = upd->next;
 		__wt_free(session, upd);
@@ -263,6 +263,12 @@ __btree_conf(WT_SESSION_IMPL *session, WT_CKPT *ckpt)
 			F_CLR(btree, WT_BTREE_NO_EVICTION);
 	}
 
+	/* Eviction priority and maximum cache usage. */
+	WT_RET(__wt_config_gets(session, cfg, "cache_priority", &cval));
+	btree->cache_priority = (int)cval.val;
+	WT_RET(__wt_config_gets(session, cfg, "cache_resident_max", &cval));
+	btree->cache_resident_max = (uint64_t)cval.val;
+
 	/* Checksums */
 	WT_RET(__wt_config_gets(session, cfg, "checksum", &cval));
 	if (WT_STRING_MATCH("on", cval.str, cval.len))
@@ -317,6 +323,9 @@ __btree_conf(WT_SESSION_IMPL *session, WT_CKPT *ckpt)
 	btree->write_gen = ckpt->write_gen;		/* Write generation */
 	btree->modified = 0;				/* Clean */
 
+	/* Blocks read may have lookaside records once the table is written. */
+	btree->lookaside = S2C(session)->las_written;
+
 	return (0);
 }
 
@@ -53,6 +53,23 @@ __evict_force_check(WT_SESSION_IMPL *session, WT_PAGE *page, uint32_t flags)
 	return (__wt_page_can_evict(session, page, 1));
 }
 
+/*
+ * __page_access --
+ *	Count an access to a page for the clock and 2Q eviction policies.
+ */
+static inline void
+__page_access(WT_PAGE *page, int newgen)
+{
+	/*
+	 * Only write the page when the count changes, most accesses to hot
+	 * pages find it already set.
+	 */
+	if (newgen && page->access_count < WT_PAGE_ACCESS_MAX)
+		++page->access_count;
+	else if (page->access_count == 0)
+		page->access_count = 1;
+}
+
 /*
  * __wt_page_in_func --
  *	Acquire a hazard pointer to a page; if the page is not in-memory,
@@ -68,9 +85,9 @@ __wt_page_in_func(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t flags
 	WT_DECL_RET;
 	WT_PAGE *page;
 	u_int sleep_cnt, wait_cnt;
-	int busy, force_attempts, oldgen;
+	int busy, force_attempts, newgen, oldgen, readonce;
 
-	for (force_attempts = oldgen = 0, wait_cnt = 0;;) {
+	for (force_attempts = oldgen = readonce = 0, wait_cnt = 0;;) {
 		switch (ref->state) {
 		case WT_REF_DISK:
 		case WT_REF_DELETED:
@@ -83,8 +100,12 @@ __wt_page_in_func(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t flags
 			 */
 			WT_RET(__wt_cache_full_check(session));
 			WT_RET(__wt_cache_read(session, ref));
+			if (F_ISSET(S2C(session), WT_CONN_CACHE_POOL) &&
+			    !LF_ISSET(WT_READ_NO_GEN))
+				__wt_cache_pool_count(session, 1);
 			oldgen = LF_ISSET(WT_READ_WONT_NEED) ||
 			    F_ISSET(session, WT_SESSION_NO_CACHE);
+			readonce = LF_ISSET(WT_READ_ONCE) ? 1 : 0;
 			continue;
 		case WT_REF_READING:
 			if (LF_ISSET(WT_READ_CACHE))
@@ -160,16 +181,38 @@ __wt_page_in_func(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t flags
 			 * trash the cache, set the oldest read generation so
 			 * the page is forcibly evicted as soon as possible.
 			 *
+			 * Read-once cursors don't update the read generation
+			 * of leaf pages: if we read the page, make it one of
+			 * the first candidates for eviction, without forcing
+			 * its eviction.
+			 *
 			 * Otherwise, update the page's read generation.
 			 */
 			if (oldgen && page->read_gen == WT_READGEN_NOTSET)
 				__wt_page_evict_soon(page);
-			else if (!LF_ISSET(WT_READ_NO_GEN) &&
-			    page->read_gen != WT_READGEN_OLDEST &&
-			    page->read_gen < __wt_cache_read_gen(session))
-				page->read_gen =
-				    __wt_cache_read_gen_set(session);
+			else if (LF_ISSET(WT_READ_ONCE) &&
+			    !WT_PAGE_IS_INTERNAL(page)) {
+				if (readonce &&
+				    page->read_gen == WT_READGEN_NOTSET) {
+					page->read_gen = WT_READGEN_ONCE;
+					WT_STAT_FAST_CONN_INCR(
+					    session, cache_read_once);
+				}
+			} else if (!LF_ISSET(WT_READ_NO_GEN)) {
+				newgen = page->read_gen != WT_READGEN_OLDEST &&
+				    page->read_gen <
+				    __wt_cache_read_gen(session);
+				if (newgen)
+					page->read_gen =
+					    __wt_cache_read_gen_set(session);
+				if (S2C(session)->cache->evict_policy !=
+				    EVICT_POLICY_LRU)
+					__page_access(page, newgen);
+			}
 
+			if (F_ISSET(S2C(session), WT_CONN_CACHE_POOL) &&
+			    !LF_ISSET(WT_READ_NO_GEN))
+				__wt_cache_pool_count(session, 0);
 			return (0);
 		WT_ILLEGAL_VALUE(session);
 		}
@@ -239,6 +282,13 @@ __wt_page_alloc(WT_SESSION_IMPL *session, uint8_t type,
 	page->type = type;
 	page->read_gen = WT_READGEN_NOTSET;
 
+	/*
+	 * The page's memory is allocated and first written by this thread, so
+	 * it's local to this thread's NUMA node.
+	 */
+	if (cache->numa_nodes != 0)
+		page->numa_node = (uint8_t)__wt_numa_node(session);
+
 	switch (type) {
 	case WT_PAGE_COL_FIX:
 		page->pg_fix_recno = recno;
@@ -294,6 +344,9 @@ err:			if ((pindex = WT_INTL_INDEX_COPY(page)) != NULL) {
 	__wt_cache_page_inmem_incr(session, page, size);
 	(void)WT_ATOMIC_ADD8(cache->bytes_read, size);
 	(void)WT_ATOMIC_ADD8(cache->pages_inmem, 1);
+	if (cache->numa_nodes != 0)
+		(void)WT_ATOMIC_ADD8(
+		    cache->numa[page->numa_node].pages_inmem, 1);
 
 	*pagep = page;
 	return (0);
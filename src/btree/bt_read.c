@@ -8,6 +8,160 @@
 
 #include "wt_internal.h"
 
+/*
+ * __las_page_apply --
+ *	Apply a key's list of updates from the lookaside table to a page.
+ */
+static int
+__las_page_apply(WT_SESSION_IMPL *session,
+    WT_REF *ref, WT_CURSOR_BTREE *cbt, WT_ITEM *key, WT_UPDATE *upd)
+{
+	uint64_t recno;
+	const uint8_t *p;
+
+	switch (ref->page->type) {
+	case WT_PAGE_COL_VAR:
+		p = key->data;
+		WT_RET(__wt_vunpack_uint(&p, 0, &recno));
+		WT_RET(__wt_col_search(session, recno, ref, cbt));
+		WT_RET(__wt_col_modify(session, cbt, recno, NULL, upd, 0));
+		break;
+	case WT_PAGE_ROW_LEAF:
+		WT_RET(__wt_row_search(session, key, ref, cbt, 1));
+		WT_RET(__wt_row_modify(session, cbt, key, NULL, upd, 0));
+		break;
+	WT_ILLEGAL_VALUE(session);
+	}
+	return (0);
+}
+
+/*
+ * __las_page_instantiate --
+ *	Instantiate the lookaside table's updates for a block read into memory,
+ *	then remove them from the table.
+ */
+static int
+__las_page_instantiate(WT_SESSION_IMPL *session,
+    WT_REF *ref, const uint8_t *addr, size_t addr_size)
+{
+	WT_BTREE *btree;
+	WT_CURSOR *cursor;
+	WT_CURSOR_BTREE cbt;
+	WT_DECL_ITEM(current_key);
+	WT_DECL_RET;
+	WT_ITEM las_addr, las_key, las_value;
+	WT_UPDATE *first_upd, *last_upd, *upd;
+	size_t notused;
+	uint64_t counter, counter_max, counter_min;
+	uint64_t las_counter, las_timestamp, las_txnid;
+	uint64_t onpage_timestamp, onpage_txnid;
+	uint32_t las_id;
+	uint8_t deleted;
+	int exact;
+
+	btree = S2BT(session);
+	first_upd = last_upd = NULL;
+	counter_max = counter_min = 0;
+
+	WT_CLEAR(cbt);
+	cbt.iface.session = &session->iface;
+	cbt.btree = btree;
+
+	WT_CLEAR(las_addr);
+	las_addr.data = addr;
+	las_addr.size = addr_size;
+
+	WT_RET(__wt_scr_alloc(session, 0, &current_key));
+
+	__wt_las_cursor(session, &cursor);
+	if (cursor == NULL)
+		goto err;
+
+	/*
+	 * The block's records are contiguous, in the order they were written:
+	 * each key's updates, newest first.  Build each key's list of updates
+	 * in that order, then apply it to the page.
+	 */
+	cursor->set_key(cursor, btree->id, &las_addr, (uint64_t)0);
+	if ((ret = cursor->search_near(cursor, &exact)) == 0 && exact < 0)
+		ret = cursor->next(cursor);
+	for (; ret == 0; ret = cursor->next(cursor)) {
+		WT_ERR(cursor->get_key(
+		    cursor, &las_id, &las_key, &las_counter));
+		if (las_id != btree->id || las_key.size != addr_size ||
+		    memcmp(las_key.data, addr, addr_size) != 0)
+			break;
+		if (counter_min == 0)
+			counter_min = las_counter;
+		counter_max = las_counter;
+
+		WT_ERR(cursor->get_value(cursor,
+		    &onpage_txnid, &onpage_timestamp, &las_txnid,
+		    &las_timestamp, &deleted, &las_key, &las_value));
+
+		/* A new key: apply the previous key's updates. */
+		if (first_upd != NULL && (las_key.size != current_key->size ||
+		    memcmp(las_key.data,
+		    current_key->data, current_key->size) != 0)) {
+			upd = first_upd;
+			first_upd = NULL;
+			WT_ERR(__las_page_apply(
+			    session, ref, &cbt, current_key, upd));
+		}
+		if (first_upd == NULL)
+			WT_ERR(__wt_buf_set(session,
+			    current_key, las_key.data, las_key.size));
+
+		WT_ERR(__wt_update_alloc(session,
+		    deleted ? NULL : &las_value, &upd, &notused));
+		upd->txnid = las_txnid;
+		upd->timestamp = las_timestamp;
+		if (first_upd == NULL)
+			first_upd = upd;
+		else
+			last_upd->next = upd;
+		last_upd = upd;
+	}
+	WT_ERR_NOTFOUND_OK(ret);
+	if (first_upd != NULL) {
+		upd = first_upd;
+		first_upd = NULL;
+		WT_ERR(__las_page_apply(session, ref, &cbt, current_key, upd));
+	}
+	if (counter_min == 0)
+		goto err;
+
+	/*
+	 * The updates we installed are older than the transaction that dirtied
+	 * the page, set the first dirty transaction to an impossibly old value
+	 * so the page is never skipped by a checkpoint.
+	 */
+	ref->page->modify->first_dirty_txn = WT_TXN_FIRST;
+	WT_STAT_FAST_CONN_INCR(session, cache_read_lookaside);
+
+	/* The updates are in memory, remove them from the table. */
+	for (counter = counter_min; counter <= counter_max; ++counter) {
+		cursor->set_key(cursor, btree->id, &las_addr, counter);
+		WT_ERR_NOTFOUND_OK(cursor->remove(cursor));
+		WT_STAT_FAST_CONN_INCR(session, cache_lookaside_remove);
+	}
+
+err:	WT_TRET(__wt_las_cursor_close(session, &cursor));
+
+	/*
+	 * The page is being read, we don't hold a hazard pointer on it: clear
+	 * the cursor's reference before closing it.
+	 */
+	cbt.ref = NULL;
+	WT_TRET(__wt_btcur_close(&cbt));
+	for (; first_upd != NULL; first_upd = upd) {
+		upd = first_upd->next;
+		__wt_free(session, first_upd);
+	}
+	__wt_scr_free(session, &current_key);
+	return (ret);
+}
+
 /*
  * __wt_cache_read --
  *	Read a page from the file.
@@ -66,6 +220,15 @@ __wt_cache_read(WT_SESSION_IMPL *session, WT_REF *ref)
 		    WT_PAGE_DISK_ALLOC : WT_PAGE_DISK_MAPPED, &page));
 		tmp.mem = NULL;
 
+		/*
+		 * If the block was written by eviction using the lookaside
+		 * table, instantiate the updates still needed by readers.
+		 */
+		if (S2BT(session)->lookaside && (page->type ==
+		    WT_PAGE_ROW_LEAF || page->type == WT_PAGE_COL_VAR))
+			WT_ERR(__las_page_instantiate(
+			    session, ref, addr, addr_size));
+
 		/* If the page was deleted, instantiate that information. */
 		if (previous_state == WT_REF_DELETED)
 			WT_ERR(__wt_delete_page_instantiate(session, ref));
@@ -82,8 +245,14 @@ err:	/*
 	 * it discarded the page, but not the disk image.  Discard the page
 	 * and separately discard the disk image in all cases.
 	 */
-	if (ref->page != NULL)
+	if (ref->page != NULL) {
+		/* Instantiating lookaside updates may have dirtied the page. */
+		if (__wt_page_is_modified(ref->page)) {
+			ref->page->modify->write_gen = 0;
+			__wt_cache_dirty_decr(session, ref->page);
+		}
 		__wt_ref_out(session, ref);
+	}
 	WT_PUBLISH(ref->state, previous_state);
 
 	__wt_buf_free(session, &tmp);
@@ -39,6 +39,7 @@ __wt_btree_stat_init(WT_SESSION_IMPL *session, WT_CURSOR_STAT *cst)
 	WT_STAT_SET(stats, btree_maxleafpage, btree->maxleafpage);
 	WT_STAT_SET(stats, btree_maxleafkey, btree->maxleafkey);
 	WT_STAT_SET(stats, btree_maxleafvalue, btree->maxleafvalue);
+	WT_STAT_SET(stats, cache_bytes_inuse, btree->bytes_inmem);
 
 	/* Everything else is really, really expensive. */
 	if (!F_ISSET(cst, WT_CONN_STAT_ALL))
@@ -50,12 +50,13 @@ __wt_tree_walk(WT_SESSION_IMPL *session,
 	 * (2) writing just dirty leaves or internal nodes (checkpoint);
 	 * (3) discarding pages (close);
 	 * (4) truncating pages in a range (fast truncate);
-	 * (5) skipping pages based on outside information (compaction);
+	 * (5) skipping pages based on outside information (compaction and
+	 *     cache warm-up);
 	 * (6) cursor scans (applications).
 	 *
-	 * Except for cursor scans and compaction, the walk is limited to the
-	 * cache, no pages are read.  In all cases, hazard pointers protect the
-	 * walked pages from eviction.
+	 * Except for cursor scans, compaction and cache warm-up, the walk is
+	 * limited to the cache, no pages are read.  In all cases, hazard
+	 * pointers protect the walked pages from eviction.
 	 *
 	 * Walks use hazard-pointer coupling through the tree and that's OK
 	 * (hazard pointers can't deadlock, so there's none of the usual
@@ -204,6 +205,20 @@ ascend:	/*
 					if (skip)
 						break;
 				}
+			} else if (LF_ISSET(WT_READ_WARMUP)) {
+				/*
+				 * Skip deleted pages, and don't read pages
+				 * that weren't in the cache when it was last
+				 * listed.
+				 */
+				if (ref->state == WT_REF_DELETED)
+					break;
+				if (ref->state == WT_REF_DISK) {
+					WT_ERR(__wt_cache_warmup_skip(
+					    session, ref, &skip));
+					if (skip)
+						break;
+				}
 			} else {
 				/*
 				 * Try to skip deleted pages visible to us.
@@ -24,10 +24,11 @@ __wt_col_search(WT_SESSION_IMPL *session,
 	WT_PAGE *page;
 	WT_PAGE_INDEX *pindex;
 	WT_REF *current, *descent;
-	uint32_t base, indx, limit;
+	uint32_t base, indx, limit, read_flags;
 	int depth;
 
 	btree = S2BT(session);
+	read_flags = F_ISSET(cbt, WT_CBT_READ_ONCE) ? WT_READ_ONCE : 0;
 
 	__cursor_pos_clear(cbt);
 
@@ -94,7 +95,8 @@ descend:	/*
 		 * page; otherwise return on error, the swap call ensures we're
 		 * holding nothing on failure.
 		 */
-		switch (ret = __wt_page_swap(session, current, descent, 0)) {
+		switch (ret = __wt_page_swap(
+		    session, current, descent, read_flags)) {
 		case 0:
 			current = descent;
 			break;
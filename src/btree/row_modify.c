@@ -300,7 +300,7 @@ __wt_update_obsolete_check(WT_SESSION_IMPL *session, WT_UPDATE *upd)
 	 * Walk the list of updates, looking for obsolete updates at the end.
 	 */
 	for (first = NULL; upd != NULL; upd = upd->next)
-		if (__wt_txn_visible_all(session, upd->txnid)) {
+		if (__wt_txn_upd_visible_all(session, upd)) {
 			if (first == NULL)
 				first = upd;
 		} else if (upd->txnid != WT_TXN_ABORTED)
@@ -340,3 +340,117 @@ __wt_update_obsolete_free(
 	if (size != 0)
 		__wt_cache_page_inmem_decr(session, page, size);
 }
+
+/*
+ * __update_obsolete_trim --
+ *	Discard obsolete updates from an update list, returning the number of
+ *	updates discarded.
+ */
+static uint64_t
+__update_obsolete_trim(WT_SESSION_IMPL *session, WT_PAGE *page, WT_UPDATE *upd)
+{
+	WT_UPDATE *obsolete;
+	uint64_t count;
+
+	if (upd == NULL || upd->next == NULL ||
+	    (obsolete = __wt_update_obsolete_check(session, upd)) == NULL)
+		return (0);
+
+	for (count = 0, upd = obsolete; upd != NULL; upd = upd->next)
+		++count;
+	__wt_update_obsolete_free(session, page, obsolete);
+	return (count);
+}
+
+/*
+ * __update_obsolete_trim_skip --
+ *	Discard obsolete updates from the update lists of a skiplist.
+ */
+static uint64_t
+__update_obsolete_trim_skip(
+    WT_SESSION_IMPL *session, WT_PAGE *page, WT_INSERT_HEAD *ins_head)
+{
+	WT_INSERT *ins;
+	uint64_t count;
+
+	count = 0;
+	if (ins_head != NULL)
+		WT_SKIP_FOREACH(ins, ins_head)
+			count +=
+			    __update_obsolete_trim(session, page, ins->upd);
+	return (count);
+}
+
+/*
+ * __wt_update_obsolete_page --
+ *	Discard obsolete updates from all of a leaf page's update lists,
+ *	returning the number of updates discarded.
+ */
+uint64_t
+__wt_update_obsolete_page(WT_SESSION_IMPL *session, WT_PAGE *page)
+{
+	WT_DECL_RET;
+	WT_INSERT_HEAD **ins_head;
+	WT_PAGE_MODIFY *mod;
+	WT_TXN_GLOBAL *txn_global;
+	WT_UPDATE **upd_array;
+	uint64_t count, oldest_id, pinned_timestamp;
+	uint32_t entries, i;
+
+	/*
+	 * Nothing can have become obsolete if the oldest ID and the pinned
+	 * timestamp haven't moved since the page was last checked (updates
+	 * since then did their own check, see __wt_update_serial).
+	 */
+	mod = page->modify;
+	txn_global = &S2C(session)->txn_global;
+	oldest_id = txn_global->oldest_id;
+	pinned_timestamp = txn_global->pinned_timestamp;
+	if (mod->obsolete_check_txn == oldest_id &&
+	    mod->obsolete_check_timestamp == pinned_timestamp)
+		return (0);
+
+	/*
+	 * The same serialization as the update path: one thread checks for
+	 * obsolete updates at a time, and the updates can't disappear under
+	 * reconciliation.  If the page is busy, skip it, we'll try again.
+	 * Unlike the update path, obsolete updates are freed as they're
+	 * found, while holding the flag: there may be many lists to free.
+	 */
+	F_CAS_ATOMIC(page, WT_PAGE_SCANNING, ret);
+	if (ret != 0)
+		return (0);
+
+	count = 0;
+	switch (page->type) {
+	case WT_PAGE_COL_FIX:
+	case WT_PAGE_COL_VAR:
+		count += __update_obsolete_trim_skip(
+		    session, page, WT_COL_APPEND(page));
+		if ((ins_head = mod->mod_update) != NULL) {
+			entries = page->type ==
+			    WT_PAGE_COL_FIX ? 1 : page->pg_var_entries;
+			for (i = 0; i < entries; ++i)
+				count += __update_obsolete_trim_skip(
+				    session, page, ins_head[i]);
+		}
+		break;
+	case WT_PAGE_ROW_LEAF:
+		entries = page->pg_row_entries;
+		if ((ins_head = page->pg_row_ins) != NULL)
+			for (i = 0; i < entries + 1; ++i)
+				count += __update_obsolete_trim_skip(
+				    session, page, ins_head[i]);
+		if ((upd_array = page->pg_row_upd) != NULL)
+			for (i = 0; i < entries; ++i)
+				count += __update_obsolete_trim(
+				    session, page, upd_array[i]);
+		break;
+	}
+
+	mod->obsolete_check_txn = oldest_id;
+	mod->obsolete_check_timestamp = pinned_timestamp;
+	F_CLR_ATOMIC(page, WT_PAGE_SCANNING);
+
+	return (count);
+}
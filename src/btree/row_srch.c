@@ -148,12 +148,13 @@ __wt_row_search(WT_SESSION_IMPL *session,
 	WT_REF *current, *descent;
 	WT_ROW *rip;
 	size_t match, skiphigh, skiplow;
-	uint32_t base, indx, limit;
+	uint32_t base, indx, limit, read_flags;
 	int append_check, cmp, depth, descend_right, done;
 
 	btree = S2BT(session);
 	collator = btree->collator;
 	item = &cbt->search_key;
+	read_flags = F_ISSET(cbt, WT_CBT_READ_ONCE) ? WT_READ_ONCE : 0;
 
 	__cursor_pos_clear(cbt);
 
@@ -294,7 +295,8 @@ descend:	/*
 		 * page; otherwise return on error, the swap call ensures we're
 		 * holding nothing on failure.
 		 */
-		switch (ret = __wt_page_swap(session, current, descent, 0)) {
+		switch (ret = __wt_page_swap(
+		    session, current, descent, read_flags)) {
 		case 0:
 			current = descent;
 			break;
@@ -32,6 +32,10 @@ static const WT_CONFIG_CHECK confchk_connection_load_extension[] = {
 };
 
 static const WT_CONFIG_CHECK confchk_connection_open_session[] = {
+	{ "eviction_pages_max", "int", NULL, "min=0,max=1000", NULL },
+	{ "eviction_wait_max", "int",
+	    NULL, "min=0,max=10000000",
+	    NULL },
 	{ "isolation", "string",
 	    NULL, "choices=[\"read-uncommitted\",\"read-committed\","
 	    "\"snapshot\"]",
@@ -54,8 +58,15 @@ static const WT_CONFIG_CHECK confchk_checkpoint_subconfigs[] = {
 };
 
 static const WT_CONFIG_CHECK confchk_eviction_subconfigs[] = {
+	{ "app_pages_max", "int", NULL, "min=0,max=1000", NULL },
+	{ "app_wait_max", "int", NULL, "min=0,max=10000000", NULL },
+	{ "policy", "string",
+	    NULL, "choices=[\"lru\",\"clock\",\"2q\"]",
+	    NULL },
 	{ "threads_max", "int", NULL, "min=1,max=20", NULL },
 	{ "threads_min", "int", NULL, "min=1,max=20", NULL },
+	{ "write_throttle", "boolean", NULL, NULL, NULL },
+	{ "writeback_threads", "int", NULL, "min=0,max=20", NULL },
 	{ NULL, NULL, NULL, NULL, NULL }
 };
 
@@ -90,6 +101,7 @@ static const WT_CONFIG_CHECK confchk_statistics_log_subconfigs[] = {
 
 static const WT_CONFIG_CHECK confchk_connection_reconfigure[] = {
 	{ "async", "category", NULL, NULL, confchk_async_subconfigs },
+	{ "block_cache_size", "int", NULL, "min=0,max=10TB", NULL },
 	{ "cache_overhead", "int", NULL, "min=0,max=30", NULL },
 	{ "cache_size", "int", NULL, "min=1MB,max=10TB", NULL },
 	{ "checkpoint", "category",
@@ -102,6 +114,9 @@ static const WT_CONFIG_CHECK confchk_connection_reconfigure[] = {
 	{ "eviction_dirty_target", "int",
 	    NULL, "min=10,max=99",
 	    NULL },
+	{ "eviction_dirty_trigger", "int",
+	    NULL, "min=10,max=99",
+	    NULL },
 	{ "eviction_target", "int", NULL, "min=10,max=99", NULL },
 	{ "eviction_trigger", "int", NULL, "min=10,max=99", NULL },
 	{ "file_manager", "category",
@@ -130,6 +145,11 @@ static const WT_CONFIG_CHECK confchk_connection_reconfigure[] = {
 	{ NULL, NULL, NULL, NULL, NULL }
 };
 
+static const WT_CONFIG_CHECK confchk_connection_set_timestamp[] = {
+	{ "oldest_timestamp", "int", NULL, "min=0", NULL },
+	{ NULL, NULL, NULL, NULL, NULL }
+};
+
 static const WT_CONFIG_CHECK confchk_cursor_reconfigure[] = {
 	{ "append", "boolean", NULL, NULL, NULL },
 	{ "overwrite", "boolean", NULL, NULL, NULL },
@@ -145,7 +165,9 @@ static const WT_CONFIG_CHECK confchk_file_meta[] = {
 	{ "block_compressor", "string",
 	    __wt_compressor_confchk, NULL,
 	    NULL },
+	{ "cache_priority", "int", NULL, "min=-100,max=100", NULL },
 	{ "cache_resident", "boolean", NULL, NULL, NULL },
+	{ "cache_resident_max", "int", NULL, "min=0", NULL },
 	{ "checkpoint", "string", NULL, NULL, NULL },
 	{ "checkpoint_lsn", "string", NULL, NULL, NULL },
 	{ "checksum", "string",
@@ -200,12 +222,15 @@ static const WT_CONFIG_CHECK confchk_index_meta[] = {
 };
 
 static const WT_CONFIG_CHECK confchk_session_begin_transaction[] = {
+	{ "conflict_timeout", "int", NULL, "min=0", NULL },
 	{ "isolation", "string",
 	    NULL, "choices=[\"read-uncommitted\",\"read-committed\","
 	    "\"snapshot\"]",
 	    NULL },
 	{ "name", "string", NULL, NULL, NULL },
 	{ "priority", "int", NULL, "min=-100,max=100", NULL },
+	{ "read_only", "boolean", NULL, NULL, NULL },
+	{ "read_timestamp", "int", NULL, "min=0", NULL },
 	{ "sync", "boolean", NULL, NULL, NULL },
 	{ NULL, NULL, NULL, NULL, NULL }
 };
@@ -218,6 +243,12 @@ static const WT_CONFIG_CHECK confchk_session_checkpoint[] = {
 	{ NULL, NULL, NULL, NULL, NULL }
 };
 
+static const WT_CONFIG_CHECK confchk_session_commit_transaction[] = {
+	{ "commit_timestamp", "int", NULL, "min=0", NULL },
+	{ "prepare_id", "int", NULL, "min=0", NULL },
+	{ NULL, NULL, NULL, NULL, NULL }
+};
+
 static const WT_CONFIG_CHECK confchk_session_compact[] = {
 	{ "timeout", "int", NULL, NULL, NULL },
 	{ NULL, NULL, NULL, NULL, NULL }
@@ -247,7 +278,9 @@ static const WT_CONFIG_CHECK confchk_session_create[] = {
 	{ "block_compressor", "string",
 	    __wt_compressor_confchk, NULL,
 	    NULL },
+	{ "cache_priority", "int", NULL, "min=-100,max=100", NULL },
 	{ "cache_resident", "boolean", NULL, NULL, NULL },
+	{ "cache_resident_max", "int", NULL, "min=0", NULL },
 	{ "checksum", "string",
 	    NULL, "choices=[\"on\",\"off\",\"uncompressed\"]",
 	    NULL },
@@ -306,6 +339,7 @@ static const WT_CONFIG_CHECK confchk_session_open_cursor[] = {
 	{ "next_random", "boolean", NULL, NULL, NULL },
 	{ "overwrite", "boolean", NULL, NULL, NULL },
 	{ "raw", "boolean", NULL, NULL, NULL },
+	{ "read_once", "boolean", NULL, NULL, NULL },
 	{ "readonly", "boolean", NULL, NULL, NULL },
 	{ "skip_sort_check", "boolean", NULL, NULL, NULL },
 	{ "statistics", "list",
@@ -315,7 +349,16 @@ static const WT_CONFIG_CHECK confchk_session_open_cursor[] = {
 	{ NULL, NULL, NULL, NULL, NULL }
 };
 
+static const WT_CONFIG_CHECK confchk_session_prepare_transaction[] = {
+	{ "prepare_id", "int", NULL, "min=0", NULL },
+	{ NULL, NULL, NULL, NULL, NULL }
+};
+
 static const WT_CONFIG_CHECK confchk_session_reconfigure[] = {
+	{ "eviction_pages_max", "int", NULL, "min=0,max=1000", NULL },
+	{ "eviction_wait_max", "int",
+	    NULL, "min=0,max=10000000",
+	    NULL },
 	{ "isolation", "string",
 	    NULL, "choices=[\"read-uncommitted\",\"read-committed\","
 	    "\"snapshot\"]",
@@ -323,6 +366,11 @@ static const WT_CONFIG_CHECK confchk_session_reconfigure[] = {
 	{ NULL, NULL, NULL, NULL, NULL }
 };
 
+static const WT_CONFIG_CHECK confchk_session_rollback_transaction[] = {
+	{ "prepare_id", "int", NULL, "min=0", NULL },
+	{ NULL, NULL, NULL, NULL, NULL }
+};
+
 static const WT_CONFIG_CHECK confchk_session_salvage[] = {
 	{ "force", "boolean", NULL, NULL, NULL },
 	{ NULL, NULL, NULL, NULL, NULL }
@@ -347,11 +395,20 @@ static const WT_CONFIG_CHECK confchk_table_meta[] = {
 	{ NULL, NULL, NULL, NULL, NULL }
 };
 
+static const WT_CONFIG_CHECK confchk_cache_warmup_subconfigs[] = {
+	{ "enabled", "boolean", NULL, NULL, NULL },
+	{ "threads", "int", NULL, "min=1,max=20", NULL },
+	{ NULL, NULL, NULL, NULL, NULL }
+};
+
 static const WT_CONFIG_CHECK confchk_log_subconfigs[] = {
 	{ "archive", "boolean", NULL, NULL, NULL },
 	{ "compressor", "string", NULL, NULL, NULL },
 	{ "enabled", "boolean", NULL, NULL, NULL },
 	{ "file_max", "int", NULL, "min=100KB,max=2GB", NULL },
+	{ "format", "string",
+	    NULL, "choices=[\"compact\",\"full\"]",
+	    NULL },
 	{ "path", "string", NULL, NULL, NULL },
 	{ "prealloc", "boolean", NULL, NULL, NULL },
 	{ "recover", "string",
@@ -360,6 +417,12 @@ static const WT_CONFIG_CHECK confchk_log_subconfigs[] = {
 	{ NULL, NULL, NULL, NULL, NULL }
 };
 
+static const WT_CONFIG_CHECK confchk_numa_subconfigs[] = {
+	{ "enabled", "boolean", NULL, NULL, NULL },
+	{ "nodes", "int", NULL, "min=0,max=64", NULL },
+	{ NULL, NULL, NULL, NULL, NULL }
+};
+
 static const WT_CONFIG_CHECK confchk_transaction_sync_subconfigs[] = {
 	{ "enabled", "boolean", NULL, NULL, NULL },
 	{ "method", "string",
@@ -370,9 +433,13 @@ static const WT_CONFIG_CHECK confchk_transaction_sync_subconfigs[] = {
 
 static const WT_CONFIG_CHECK confchk_wiredtiger_open[] = {
 	{ "async", "category", NULL, NULL, confchk_async_subconfigs },
+	{ "block_cache_size", "int", NULL, "min=0,max=10TB", NULL },
 	{ "buffer_alignment", "int", NULL, "min=-1,max=1MB", NULL },
 	{ "cache_overhead", "int", NULL, "min=0,max=30", NULL },
 	{ "cache_size", "int", NULL, "min=1MB,max=10TB", NULL },
+	{ "cache_warmup", "category",
+	    NULL, NULL,
+	    confchk_cache_warmup_subconfigs },
 	{ "checkpoint", "category",
 	    NULL, NULL,
 	    confchk_checkpoint_subconfigs },
@@ -389,6 +456,9 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open[] = {
 	{ "eviction_dirty_target", "int",
 	    NULL, "min=10,max=99",
 	    NULL },
+	{ "eviction_dirty_trigger", "int",
+	    NULL, "min=10,max=99",
+	    NULL },
 	{ "eviction_target", "int", NULL, "min=10,max=99", NULL },
 	{ "eviction_trigger", "int", NULL, "min=10,max=99", NULL },
 	{ "exclusive", "boolean", NULL, NULL, NULL },
@@ -407,6 +477,7 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open[] = {
 	{ "lsm_merge", "boolean", NULL, NULL, NULL },
 	{ "mmap", "boolean", NULL, NULL, NULL },
 	{ "multiprocess", "boolean", NULL, NULL, NULL },
+	{ "numa", "category", NULL, NULL, confchk_numa_subconfigs },
 	{ "session_max", "int", NULL, "min=1", NULL },
 	{ "session_scratch_max", "int", NULL, NULL, NULL },
 	{ "shared_cache", "category",
@@ -434,9 +505,13 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open[] = {
 
 static const WT_CONFIG_CHECK confchk_wiredtiger_open_all[] = {
 	{ "async", "category", NULL, NULL, confchk_async_subconfigs },
+	{ "block_cache_size", "int", NULL, "min=0,max=10TB", NULL },
 	{ "buffer_alignment", "int", NULL, "min=-1,max=1MB", NULL },
 	{ "cache_overhead", "int", NULL, "min=0,max=30", NULL },
 	{ "cache_size", "int", NULL, "min=1MB,max=10TB", NULL },
+	{ "cache_warmup", "category",
+	    NULL, NULL,
+	    confchk_cache_warmup_subconfigs },
 	{ "checkpoint", "category",
 	    NULL, NULL,
 	    confchk_checkpoint_subconfigs },
@@ -453,6 +528,9 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_all[] = {
 	{ "eviction_dirty_target", "int",
 	    NULL, "min=10,max=99",
 	    NULL },
+	{ "eviction_dirty_trigger", "int",
+	    NULL, "min=10,max=99",
+	    NULL },
 	{ "eviction_target", "int", NULL, "min=10,max=99", NULL },
 	{ "eviction_trigger", "int", NULL, "min=10,max=99", NULL },
 	{ "exclusive", "boolean", NULL, NULL, NULL },
@@ -471,6 +549,7 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_all[] = {
 	{ "lsm_merge", "boolean", NULL, NULL, NULL },
 	{ "mmap", "boolean", NULL, NULL, NULL },
 	{ "multiprocess", "boolean", NULL, NULL, NULL },
+	{ "numa", "category", NULL, NULL, confchk_numa_subconfigs },
 	{ "session_max", "int", NULL, "min=1", NULL },
 	{ "session_scratch_max", "int", NULL, NULL, NULL },
 	{ "shared_cache", "category",
@@ -499,9 +578,13 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_all[] = {
 
 static const WT_CONFIG_CHECK confchk_wiredtiger_open_basecfg[] = {
 	{ "async", "category", NULL, NULL, confchk_async_subconfigs },
+	{ "block_cache_size", "int", NULL, "min=0,max=10TB", NULL },
 	{ "buffer_alignment", "int", NULL, "min=-1,max=1MB", NULL },
 	{ "cache_overhead", "int", NULL, "min=0,max=30", NULL },
 	{ "cache_size", "int", NULL, "min=1MB,max=10TB", NULL },
+	{ "cache_warmup", "category",
+	    NULL, NULL,
+	    confchk_cache_warmup_subconfigs },
 	{ "checkpoint", "category",
 	    NULL, NULL,
 	    confchk_checkpoint_subconfigs },
@@ -516,6 +599,9 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_basecfg[] = {
 	{ "eviction_dirty_target", "int",
 	    NULL, "min=10,max=99",
 	    NULL },
+	{ "eviction_dirty_trigger", "int",
+	    NULL, "min=10,max=99",
+	    NULL },
 	{ "eviction_target", "int", NULL, "min=10,max=99", NULL },
 	{ "eviction_trigger", "int", NULL, "min=10,max=99", NULL },
 	{ "extensions", "list", NULL, NULL, NULL },
@@ -533,6 +619,7 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_basecfg[] = {
 	{ "lsm_merge", "boolean", NULL, NULL, NULL },
 	{ "mmap", "boolean", NULL, NULL, NULL },
 	{ "multiprocess", "boolean", NULL, NULL, NULL },
+	{ "numa", "category", NULL, NULL, confchk_numa_subconfigs },
 	{ "session_max", "int", NULL, "min=1", NULL },
 	{ "session_scratch_max", "int", NULL, NULL, NULL },
 	{ "shared_cache", "category",
@@ -560,9 +647,13 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_basecfg[] = {
 
 static const WT_CONFIG_CHECK confchk_wiredtiger_open_usercfg[] = {
 	{ "async", "category", NULL, NULL, confchk_async_subconfigs },
+	{ "block_cache_size", "int", NULL, "min=0,max=10TB", NULL },
 	{ "buffer_alignment", "int", NULL, "min=-1,max=1MB", NULL },
 	{ "cache_overhead", "int", NULL, "min=0,max=30", NULL },
 	{ "cache_size", "int", NULL, "min=1MB,max=10TB", NULL },
+	{ "cache_warmup", "category",
+	    NULL, NULL,
+	    confchk_cache_warmup_subconfigs },
 	{ "checkpoint", "category",
 	    NULL, NULL,
 	    confchk_checkpoint_subconfigs },
@@ -577,6 +668,9 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_usercfg[] = {
 	{ "eviction_dirty_target", "int",
 	    NULL, "min=10,max=99",
 	    NULL },
+	{ "eviction_dirty_trigger", "int",
+	    NULL, "min=10,max=99",
+	    NULL },
 	{ "eviction_target", "int", NULL, "min=10,max=99", NULL },
 	{ "eviction_trigger", "int", NULL, "min=10,max=99", NULL },
 	{ "extensions", "list", NULL, NULL, NULL },
@@ -594,6 +688,7 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_usercfg[] = {
 	{ "lsm_merge", "boolean", NULL, NULL, NULL },
 	{ "mmap", "boolean", NULL, NULL, NULL },
 	{ "multiprocess", "boolean", NULL, NULL, NULL },
+	{ "numa", "category", NULL, NULL, confchk_numa_subconfigs },
 	{ "session_max", "int", NULL, "min=1", NULL },
 	{ "session_scratch_max", "int", NULL, NULL, NULL },
 	{ "shared_cache", "category",
@@ -653,16 +748,19 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	  confchk_connection_load_extension
 	},
 	{ "connection.open_session",
+	  "eviction_pages_max=0,eviction_wait_max=0,"
 	  "isolation=read-committed",
 	  confchk_connection_open_session
 	},
 	{ "connection.reconfigure",
-	  "async=(enabled=0,ops_max=1024,threads=2),cache_overhead=8,"
-	  "cache_size=100MB,checkpoint=(log_size=0,"
+	  "async=(enabled=0,ops_max=1024,threads=2),block_cache_size=0,"
+	  "cache_overhead=8,cache_size=100MB,checkpoint=(log_size=0,"
 	  "name=\"WiredTigerCheckpoint\",wait=0),error_prefix=,"
-	  "eviction=(threads_max=1,threads_min=1),eviction_dirty_target=80,"
-	  "eviction_target=80,eviction_trigger=95,"
-	  "file_manager=(close_idle_time=30,close_scan_interval=10),"
+	  "eviction=(app_pages_max=0,app_wait_max=0,policy=lru,"
+	  "threads_max=1,threads_min=1,write_throttle=0,"
+	  "writeback_threads=0),eviction_dirty_target=80,"
+	  "eviction_dirty_trigger=95,eviction_target=80,eviction_trigger=95"
+	  ",file_manager=(close_idle_time=30,close_scan_interval=10),"
 	  "lsm_manager=(merge=,worker_thread_max=4),lsm_merge=,"
 	  "shared_cache=(chunk=10MB,name=,reserve=0,size=500MB),"
 	  "statistics=none,statistics_log=(on_close=0,"
@@ -670,6 +768,10 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	  "timestamp=\"%b %d %H:%M:%S\",wait=0),verbose=",
 	  confchk_connection_reconfigure
 	},
+	{ "connection.set_timestamp",
+	  "oldest_timestamp=0",
+	  confchk_connection_set_timestamp
+	},
 	{ "cursor.close",
 	  "",
 	  NULL
@@ -680,7 +782,8 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	},
 	{ "file.meta",
 	  "allocation_size=4KB,app_metadata=,block_allocation=best,"
-	  "block_compressor=,cache_resident=0,checkpoint=,checkpoint_lsn=,"
+	  "block_compressor=,cache_priority=0,cache_resident=0,"
+	  "cache_resident_max=0,checkpoint=,checkpoint_lsn=,"
 	  "checksum=uncompressed,collator=,columns=,dictionary=0,"
 	  "format=btree,huffman_key=,huffman_value=,id=,internal_item_max=0"
 	  ",internal_key_max=0,internal_key_truncate=,internal_page_max=4KB"
@@ -698,7 +801,8 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	  confchk_index_meta
 	},
 	{ "session.begin_transaction",
-	  "isolation=,name=,priority=0,sync=",
+	  "conflict_timeout=0,isolation=,name=,priority=0,read_only=0,"
+	  "read_timestamp=0,sync=",
 	  confchk_session_begin_transaction
 	},
 	{ "session.checkpoint",
@@ -710,8 +814,8 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	  NULL
 	},
 	{ "session.commit_transaction",
-	  "",
-	  NULL
+	  "commit_timestamp=0,prepare_id=0",
+	  confchk_session_commit_transaction
 	},
 	{ "session.compact",
 	  "timeout=1200",
@@ -719,19 +823,19 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	},
 	{ "session.create",
 	  "allocation_size=4KB,app_metadata=,block_allocation=best,"
-	  "block_compressor=,cache_resident=0,checksum=uncompressed,"
-	  "colgroups=,collator=,columns=,dictionary=0,exclusive=0,"
-	  "extractor=,format=btree,huffman_key=,huffman_value=,immutable=0,"
-	  "internal_item_max=0,internal_key_max=0,internal_key_truncate=,"
-	  "internal_page_max=4KB,key_format=u,key_gap=10,leaf_item_max=0,"
-	  "leaf_key_max=0,leaf_page_max=32KB,leaf_value_max=0,"
-	  "lsm=(auto_throttle=,bloom=,bloom_bit_count=16,bloom_config=,"
-	  "bloom_hash_count=8,bloom_oldest=0,chunk_count_limit=0,"
-	  "chunk_max=5GB,chunk_size=10MB,merge_max=15,merge_min=0),"
-	  "memory_page_max=5MB,os_cache_dirty_max=0,os_cache_max=0,"
-	  "prefix_compression=0,prefix_compression_min=4,source=,"
-	  "split_deepen_min_child=0,split_deepen_per_child=0,split_pct=75,"
-	  "type=file,value_format=u",
+	  "block_compressor=,cache_priority=0,cache_resident=0,"
+	  "cache_resident_max=0,checksum=uncompressed,colgroups=,collator=,"
+	  "columns=,dictionary=0,exclusive=0,extractor=,format=btree,"
+	  "huffman_key=,huffman_value=,immutable=0,internal_item_max=0,"
+	  "internal_key_max=0,internal_key_truncate=,internal_page_max=4KB,"
+	  "key_format=u,key_gap=10,leaf_item_max=0,leaf_key_max=0,"
+	  "leaf_page_max=32KB,leaf_value_max=0,lsm=(auto_throttle=,bloom=,"
+	  "bloom_bit_count=16,bloom_config=,bloom_hash_count=8,"
+	  "bloom_oldest=0,chunk_count_limit=0,chunk_max=5GB,chunk_size=10MB"
+	  ",merge_max=15,merge_min=0),memory_page_max=5MB,"
+	  "os_cache_dirty_max=0,os_cache_max=0,prefix_compression=0,"
+	  "prefix_compression_min=4,source=,split_deepen_min_child=0,"
+	  "split_deepen_per_child=0,split_pct=75,type=file,value_format=u",
 	  confchk_session_create
 	},
 	{ "session.drop",
@@ -744,10 +848,15 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	},
 	{ "session.open_cursor",
 	  "append=0,bulk=0,checkpoint=,dump=,next_random=0,overwrite=,raw=0"
-	  ",readonly=0,skip_sort_check=0,statistics=,target=",
+	  ",read_once=0,readonly=0,skip_sort_check=0,statistics=,target=",
 	  confchk_session_open_cursor
 	},
+	{ "session.prepare_transaction",
+	  "prepare_id=0",
+	  confchk_session_prepare_transaction
+	},
 	{ "session.reconfigure",
+	  "eviction_pages_max=0,eviction_wait_max=0,"
 	  "isolation=read-committed",
 	  confchk_session_reconfigure
 	},
@@ -756,8 +865,8 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	  NULL
 	},
 	{ "session.rollback_transaction",
-	  "",
-	  NULL
+	  "prepare_id=0",
+	  confchk_session_rollback_transaction
 	},
 	{ "session.salvage",
 	  "force=0",
@@ -780,44 +889,56 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	  "dump_shape=0",
 	  confchk_session_verify
 	},
+	{ "session.write_batch",
+	  "",
+	  NULL
+	},
 	{ "table.meta",
 	  "app_metadata=,colgroups=,collator=,columns=,key_format=u,"
 	  "value_format=u",
 	  confchk_table_meta
 	},
 	{ "wiredtiger_open",
-	  "async=(enabled=0,ops_max=1024,threads=2),buffer_alignment=-1,"
-	  "cache_overhead=8,cache_size=100MB,checkpoint=(log_size=0,"
+	  "async=(enabled=0,ops_max=1024,threads=2),block_cache_size=0,"
+	  "buffer_alignment=-1,cache_overhead=8,cache_size=100MB,"
+	  "cache_warmup=(enabled=0,threads=2),checkpoint=(log_size=0,"
 	  "name=\"WiredTigerCheckpoint\",wait=0),checkpoint_sync=,"
 	  "config_base=,create=0,direct_io=,error_prefix=,"
-	  "eviction=(threads_max=1,threads_min=1),eviction_dirty_target=80,"
-	  "eviction_target=80,eviction_trigger=95,exclusive=0,extensions=,"
-	  "file_extend=,file_manager=(close_idle_time=30,"
-	  "close_scan_interval=10),hazard_max=1000,log=(archive=,"
-	  "compressor=,enabled=0,file_max=100MB,path=,prealloc=,recover=on)"
-	  ",lsm_manager=(merge=,worker_thread_max=4),lsm_merge=,mmap=,"
-	  "multiprocess=0,session_max=100,session_scratch_max=2MB,"
-	  "shared_cache=(chunk=10MB,name=,reserve=0,size=500MB),"
-	  "statistics=none,statistics_log=(on_close=0,"
+	  "eviction=(app_pages_max=0,app_wait_max=0,policy=lru,"
+	  "threads_max=1,threads_min=1,write_throttle=0,"
+	  "writeback_threads=0),eviction_dirty_target=80,"
+	  "eviction_dirty_trigger=95,eviction_target=80,eviction_trigger=95"
+	  ",exclusive=0,extensions=,file_extend=,"
+	  "file_manager=(close_idle_time=30,close_scan_interval=10),"
+	  "hazard_max=1000,log=(archive=,compressor=,enabled=0,"
+	  "file_max=100MB,format=full,path=,prealloc=,recover=on),"
+	  "lsm_manager=(merge=,worker_thread_max=4),lsm_merge=,mmap=,"
+	  "multiprocess=0,numa=(enabled=0,nodes=0),session_max=100,"
+	  "session_scratch_max=2MB,shared_cache=(chunk=10MB,name=,reserve=0"
+	  ",size=500MB),statistics=none,statistics_log=(on_close=0,"
 	  "path=\"WiredTigerStat.%d.%H\",sources=,"
 	  "timestamp=\"%b %d %H:%M:%S\",wait=0),transaction_sync=(enabled=0"
 	  ",method=fsync),use_environment_priv=0,verbose=",
 	  confchk_wiredtiger_open
 	},
 	{ "wiredtiger_open_all",
-	  "async=(enabled=0,ops_max=1024,threads=2),buffer_alignment=-1,"
-	  "cache_overhead=8,cache_size=100MB,checkpoint=(log_size=0,"
+	  "async=(enabled=0,ops_max=1024,threads=2),block_cache_size=0,"
+	  "buffer_alignment=-1,cache_overhead=8,cache_size=100MB,"
+	  "cache_warmup=(enabled=0,threads=2),checkpoint=(log_size=0,"
 	  "name=\"WiredTigerCheckpoint\",wait=0),checkpoint_sync=,"
 	  "config_base=,create=0,direct_io=,error_prefix=,"
-	  "eviction=(threads_max=1,threads_min=1),eviction_dirty_target=80,"
-	  "eviction_target=80,eviction_trigger=95,exclusive=0,extensions=,"
-	  "file_extend=,file_manager=(close_idle_time=30,"
-	  "close_scan_interval=10),hazard_max=1000,log=(archive=,"
-	  "compressor=,enabled=0,file_max=100MB,path=,prealloc=,recover=on)"
-	  ",lsm_manager=(merge=,worker_thread_max=4),lsm_merge=,mmap=,"
-	  "multiprocess=0,session_max=100,session_scratch_max=2MB,"
-	  "shared_cache=(chunk=10MB,name=,reserve=0,size=500MB),"
-	  "statistics=none,statistics_log=(on_close=0,"
+	  "eviction=(app_pages_max=0,app_wait_max=0,policy=lru,"
+	  "threads_max=1,threads_min=1,write_throttle=0,"
+	  "writeback_threads=0),eviction_dirty_target=80,"
+	  "eviction_dirty_trigger=95,eviction_target=80,eviction_trigger=95"
+	  ",exclusive=0,extensions=,file_extend=,"
+	  "file_manager=(close_idle_time=30,close_scan_interval=10),"
+	  "hazard_max=1000,log=(archive=,compressor=,enabled=0,"
+	  "file_max=100MB,format=full,path=,prealloc=,recover=on),"
+	  "lsm_manager=(merge=,worker_thread_max=4),lsm_merge=,mmap=,"
+	  "multiprocess=0,numa=(enabled=0,nodes=0),session_max=100,"
+	  "session_scratch_max=2MB,shared_cache=(chunk=10MB,name=,reserve=0"
+	  ",size=500MB),statistics=none,statistics_log=(on_close=0,"
 	  "path=\"WiredTigerStat.%d.%H\",sources=,"
 	  "timestamp=\"%b %d %H:%M:%S\",wait=0),transaction_sync=(enabled=0"
 	  ",method=fsync),use_environment_priv=0,verbose=,version=(major=0,"
@@ -825,36 +946,42 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	  confchk_wiredtiger_open_all
 	},
 	{ "wiredtiger_open_basecfg",
-	  "async=(enabled=0,ops_max=1024,threads=2),buffer_alignment=-1,"
-	  "cache_overhead=8,cache_size=100MB,checkpoint=(log_size=0,"
+	  "async=(enabled=0,ops_max=1024,threads=2),block_cache_size=0,"
+	  "buffer_alignment=-1,cache_overhead=8,cache_size=100MB,"
+	  "cache_warmup=(enabled=0,threads=2),checkpoint=(log_size=0,"
 	  "name=\"WiredTigerCheckpoint\",wait=0),checkpoint_sync=,"
-	  "direct_io=,error_prefix=,eviction=(threads_max=1,threads_min=1),"
-	  "eviction_dirty_target=80,eviction_target=80,eviction_trigger=95,"
-	  "extensions=,file_extend=,file_manager=(close_idle_time=30,"
+	  "direct_io=,error_prefix=,eviction=(app_pages_max=0,"
+	  "app_wait_max=0,policy=lru,threads_max=1,threads_min=1,"
+	  "write_throttle=0,writeback_threads=0),eviction_dirty_target=80,"
+	  "eviction_dirty_trigger=95,eviction_target=80,eviction_trigger=95"
+	  ",extensions=,file_extend=,file_manager=(close_idle_time=30,"
 	  "close_scan_interval=10),hazard_max=1000,log=(archive=,"
-	  "compressor=,enabled=0,file_max=100MB,path=,prealloc=,recover=on)"
-	  ",lsm_manager=(merge=,worker_thread_max=4),lsm_merge=,mmap=,"
-	  "multiprocess=0,session_max=100,session_scratch_max=2MB,"
-	  "shared_cache=(chunk=10MB,name=,reserve=0,size=500MB),"
-	  "statistics=none,statistics_log=(on_close=0,"
+	  "compressor=,enabled=0,file_max=100MB,format=full,path=,prealloc="
+	  ",recover=on),lsm_manager=(merge=,worker_thread_max=4),lsm_merge="
+	  ",mmap=,multiprocess=0,numa=(enabled=0,nodes=0),session_max=100,"
+	  "session_scratch_max=2MB,shared_cache=(chunk=10MB,name=,reserve=0"
+	  ",size=500MB),statistics=none,statistics_log=(on_close=0,"
 	  "path=\"WiredTigerStat.%d.%H\",sources=,"
 	  "timestamp=\"%b %d %H:%M:%S\",wait=0),transaction_sync=(enabled=0"
 	  ",method=fsync),verbose=,version=(major=0,minor=0)",
 	  confchk_wiredtiger_open_basecfg
 	},
 	{ "wiredtiger_open_usercfg",
-	  "async=(enabled=0,ops_max=1024,threads=2),buffer_alignment=-1,"
-	  "cache_overhead=8,cache_size=100MB,checkpoint=(log_size=0,"
+	  "async=(enabled=0,ops_max=1024,threads=2),block_cache_size=0,"
+	  "buffer_alignment=-1,cache_overhead=8,cache_size=100MB,"
+	  "cache_warmup=(enabled=0,threads=2),checkpoint=(log_size=0,"
 	  "name=\"WiredTigerCheckpoint\",wait=0),checkpoint_sync=,"
-	  "direct_io=,error_prefix=,eviction=(threads_max=1,threads_min=1),"
-	  "eviction_dirty_target=80,eviction_target=80,eviction_trigger=95,"
-	  "extensions=,file_extend=,file_manager=(close_idle_time=30,"
+	  "direct_io=,error_prefix=,eviction=(app_pages_max=0,"
+	  "app_wait_max=0,policy=lru,threads_max=1,threads_min=1,"
+	  "write_throttle=0,writeback_threads=0),eviction_dirty_target=80,"
+	  "eviction_dirty_trigger=95,eviction_target=80,eviction_trigger=95"
+	  ",extensions=,file_extend=,file_manager=(close_idle_time=30,"
 	  "close_scan_interval=10),hazard_max=1000,log=(archive=,"
-	  "compressor=,enabled=0,file_max=100MB,path=,prealloc=,recover=on)"
-	  ",lsm_manager=(merge=,worker_thread_max=4),lsm_merge=,mmap=,"
-	  "multiprocess=0,session_max=100,session_scratch_max=2MB,"
-	  "shared_cache=(chunk=10MB,name=,reserve=0,size=500MB),"
-	  "statistics=none,statistics_log=(on_close=0,"
+	  "compressor=,enabled=0,file_max=100MB,format=full,path=,prealloc="
+	  ",recover=on),lsm_manager=(merge=,worker_thread_max=4),lsm_merge="
+	  ",mmap=,multiprocess=0,numa=(enabled=0,nodes=0),session_max=100,"
+	  "session_scratch_max=2MB,shared_cache=(chunk=10MB,name=,reserve=0"
+	  ",size=500MB),statistics=none,statistics_log=(on_close=0,"
 	  "path=\"WiredTigerStat.%d.%H\",sources=,"
 	  "timestamp=\"%b %d %H:%M:%S\",wait=0),transaction_sync=(enabled=0"
 	  ",method=fsync),verbose=",
@@ -811,10 +811,14 @@ err:	/*
 	 * We do this as a separate pass because an active transaction in one
 	 * session could cause trouble when closing a file, even if that
 	 * session never referenced that file.
+	 *
+	 * Prepared transactions aren't resolved, they are detached from their
+	 * sessions first, and recovered when the database is next opened.
 	 */
 	for (s = conn->sessions, i = 0; i < conn->session_cnt; ++s, ++i)
 		if (s->active && !F_ISSET(s, WT_SESSION_INTERNAL) &&
 		    F_ISSET(&s->txn, TXN_RUNNING)) {
+			__wt_txn_prepare_detach(s);
 			wt_session = &s->iface;
 			WT_TRET(wt_session->rollback_transaction(
 			    wt_session, NULL));
@@ -877,6 +881,7 @@ __conn_reconfigure(WT_CONNECTION *wt_conn, const char *config)
 	WT_ERR(__conn_statistics_config(session, config_cfg));
 	WT_ERR(__wt_async_reconfig(session, config_cfg));
 	WT_ERR(__wt_cache_config(session, 1, config_cfg));
+	WT_ERR(__wt_evict_writeback_create(session, config_cfg));
 	WT_ERR(__wt_checkpoint_server_create(session, config_cfg));
 	WT_ERR(__wt_lsm_manager_reconfig(session, config_cfg));
 	WT_ERR(__wt_statlog_create(session, config_cfg));
@@ -892,6 +897,24 @@ err:	__wt_spin_unlock(session, &conn->reconfig_lock);
 	API_END_RET(session, ret);
 }
 
+/*
+ * __conn_set_timestamp --
+ *	WT_CONNECTION->set_timestamp method.
+ */
+static int
+__conn_set_timestamp(WT_CONNECTION *wt_conn, const char *config)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+
+	conn = (WT_CONNECTION_IMPL *)wt_conn;
+
+	CONNECTION_API_CALL(conn, session, set_timestamp, config, cfg);
+	ret = __wt_txn_global_set_timestamp(session, cfg);
+err:	API_END_RET(session, ret);
+}
+
 /*
  * __conn_open_session --
  *	WT_CONNECTION->open_session method.
@@ -1575,6 +1598,7 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler,
 		__conn_get_home,
 		__conn_configure_method,
 		__conn_is_new,
+		__conn_set_timestamp,
 		__conn_open_session,
 		__conn_load_extension,
 		__conn_add_data_source,
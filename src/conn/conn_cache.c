@@ -45,6 +45,9 @@ __cache_config_local(WT_SESSION_IMPL *session, int shared, const char *cfg[])
 	WT_RET(__wt_config_gets(session, cfg, "eviction_dirty_target", &cval));
 	cache->eviction_dirty_target = (u_int)cval.val;
 
+	WT_RET(__wt_config_gets(session, cfg, "eviction_dirty_trigger", &cval));
+	cache->eviction_dirty_trigger = (u_int)cval.val;
+
 	/*
 	 * The eviction thread configuration options include the main eviction
 	 * thread and workers. Our implementation splits them out. Adjust for
@@ -65,6 +68,33 @@ __cache_config_local(WT_SESSION_IMPL *session, int shared, const char *cfg[])
 	conn->evict_workers_max = evict_workers_max;
 	conn->evict_workers_min = evict_workers_min;
 
+	/*
+	 * Spread eviction candidates across one queue per eviction thread, so
+	 * the threads (and application threads helping out), don't contend on
+	 * a single queue.
+	 */
+	cache->evict_queue_count = WT_MIN(
+	    evict_workers_max + 1, WT_EVICT_QUEUE_MAX);
+
+	WT_RET(__wt_config_gets(session, cfg, "eviction.app_wait_max", &cval));
+	cache->app_wait_max = (uint64_t)cval.val;
+
+	WT_RET(
+	    __wt_config_gets(session, cfg, "eviction.app_pages_max", &cval));
+	cache->app_pages_max = (u_int)cval.val;
+
+	WT_RET(
+	    __wt_config_gets(session, cfg, "eviction.write_throttle", &cval));
+	cache->write_throttle = cval.val != 0;
+
+	WT_RET(__wt_config_gets(session, cfg, "eviction.policy", &cval));
+	if (WT_STRING_MATCH("clock", cval.str, cval.len))
+		cache->evict_policy = EVICT_POLICY_CLOCK;
+	else if (WT_STRING_MATCH("2q", cval.str, cval.len))
+		cache->evict_policy = EVICT_POLICY_2Q;
+	else
+		cache->evict_policy = EVICT_POLICY_LRU;
+
 	return (0);
 }
 
@@ -104,6 +134,7 @@ __wt_cache_config(WT_SESSION_IMPL *session, int reconfigure, const char *cfg[])
 	 * participating in a shared cache.
 	 */
 	WT_RET(__cache_config_local(session, now_shared, cfg));
+	WT_RET(__wt_block_cache_config(session, cfg));
 	if (now_shared) {
 		WT_RET(__wt_cache_pool_config(session, cfg));
 		WT_ASSERT(session, F_ISSET(conn, WT_CONN_CACHE_POOL));
@@ -122,8 +153,10 @@ int
 __wt_cache_create(WT_SESSION_IMPL *session, const char *cfg[])
 {
 	WT_CACHE *cache;
+	WT_CONFIG_ITEM cval;
 	WT_CONNECTION_IMPL *conn;
 	WT_DECL_RET;
+	u_int i, nodes;
 
 	conn = S2C(session);
 
@@ -143,18 +176,48 @@ __wt_cache_create(WT_SESSION_IMPL *session, const char *cfg[])
 	if (cache->eviction_target >= cache->eviction_trigger)
 		WT_ERR_MSG(session, EINVAL,
 		    "eviction target must be lower than the eviction trigger");
+	if (cache->eviction_dirty_target >= cache->eviction_dirty_trigger)
+		WT_ERR_MSG(session, EINVAL,
+		    "eviction dirty target must be lower than the eviction "
+		    "dirty trigger");
 
 	WT_ERR(__wt_cond_alloc(session,
 	    "cache eviction server", 0, &cache->evict_cond));
 	WT_ERR(__wt_cond_alloc(session,
 	    "eviction waiters", 0, &cache->evict_waiter_cond));
 	WT_ERR(__wt_spin_init(session, &cache->evict_lock, "cache eviction"));
-	WT_ERR(__wt_spin_init(session, &cache->evict_walk_lock, "cache walk"));
 
 	/* Allocate the LRU eviction queue. */
 	cache->evict_slots = WT_EVICT_WALK_BASE + WT_EVICT_WALK_INCR;
 	WT_ERR(__wt_calloc_def(session, cache->evict_slots, &cache->evict));
 
+	/*
+	 * Allocate the eviction candidate queues; the queue entries are
+	 * allocated by the eviction server when a queue is first used.
+	 */
+	WT_ERR(__wt_calloc_def(
+	    session, WT_EVICT_QUEUE_MAX, &cache->evict_queues));
+	for (i = 0; i < WT_EVICT_QUEUE_MAX; ++i)
+		WT_ERR(__wt_spin_init(session,
+		    &cache->evict_queues[i].evict_lock, "eviction queue"));
+
+	/*
+	 * Partition the cache between NUMA nodes: there's nothing to do unless
+	 * there are several nodes.
+	 */
+	WT_ERR(__wt_config_gets(session, cfg, "numa.enabled", &cval));
+	if (cval.val != 0) {
+		WT_ERR(__wt_config_gets(session, cfg, "numa.nodes", &cval));
+		WT_ERR(__wt_numa_topology(session, (u_int)cval.val,
+		    &cache->numa_cpu_node, &cache->numa_cpus, &nodes));
+		if (nodes > 1) {
+			WT_ERR(__wt_calloc_def(session, nodes, &cache->numa));
+			cache->numa_nodes = nodes;
+		}
+		WT_ERR(__wt_verbose(session, WT_VERB_EVICTSERVER,
+		    "cache partitioned between %u NUMA nodes", nodes));
+	}
+
 	/*
 	 * We get/set some values in the cache statistics (rather than have
 	 * two copies), configure them.
@@ -176,6 +239,8 @@ __wt_cache_stats_update(WT_SESSION_IMPL *session)
 	WT_CACHE *cache;
 	WT_CONNECTION_IMPL *conn;
 	WT_CONNECTION_STATS *stats;
+	uint64_t bytes_numa;
+	u_int i;
 
 	conn = S2C(session);
 	cache = conn->cache;
@@ -190,12 +255,19 @@ __wt_cache_stats_update(WT_SESSION_IMPL *session)
 	WT_STAT_SET(stats,
 	    cache_eviction_maximum_page_size, cache->evict_max_page_size);
 	WT_STAT_SET(stats, cache_pages_dirty, cache->pages_dirty);
+	WT_STAT_SET(stats, cache_pool_pressure, cache->cp_pressure);
+	WT_STAT_SET(stats, block_cache_bytes, conn->block_cache.bytes_inuse);
 
 	/* Figure out internal, leaf and overflow stats */
 	WT_STAT_SET(stats, cache_bytes_internal, cache->bytes_internal);
 	WT_STAT_SET(stats, cache_bytes_leaf,
 	    conn->cache_size - (cache->bytes_internal + cache->bytes_overflow));
 	WT_STAT_SET(stats, cache_bytes_overflow, cache->bytes_overflow);
+
+	/* Report the most used NUMA node's share of the cache. */
+	for (bytes_numa = 0, i = 0; i < cache->numa_nodes; ++i)
+		bytes_numa = WT_MAX(bytes_numa, cache->numa[i].bytes_inmem);
+	WT_STAT_SET(stats, cache_bytes_numa_max, bytes_numa);
 }
 
 /*
@@ -208,6 +280,7 @@ __wt_cache_destroy(WT_SESSION_IMPL *session)
 	WT_CACHE *cache;
 	WT_CONNECTION_IMPL *conn;
 	WT_DECL_RET;
+	u_int i;
 
 	conn = S2C(session);
 	cache = conn->cache;
@@ -218,9 +291,20 @@ __wt_cache_destroy(WT_SESSION_IMPL *session)
 	WT_TRET(__wt_cond_destroy(session, &cache->evict_cond));
 	WT_TRET(__wt_cond_destroy(session, &cache->evict_waiter_cond));
 	__wt_spin_destroy(session, &cache->evict_lock);
-	__wt_spin_destroy(session, &cache->evict_walk_lock);
+
+	if (cache->evict_queues != NULL)
+		for (i = 0; i < WT_EVICT_QUEUE_MAX; ++i) {
+			__wt_spin_destroy(
+			    session, &cache->evict_queues[i].evict_lock);
+			__wt_free(session, cache->evict_queues[i].evict_queue);
+		}
 
 	__wt_free(session, cache->evict);
+	__wt_free(session, cache->evict_queues);
+	__wt_free(session, cache->numa);
+	__wt_free(session, cache->numa_cpu_node);
 	__wt_free(session, conn->cache);
+
+	__wt_block_cache_destroy(session);
 	return (ret);
 }
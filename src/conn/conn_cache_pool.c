@@ -9,16 +9,25 @@
 #include "wt_internal.h"
 
 /*
- * Tuning constants.
+ * Tuning constants: a connection's cache pressure is measured per mille, as
+ * the larger of its miss ratio and the share of time its application threads
+ * spend evicting pages.  Connections between the two thresholds keep their
+ * allocation, so allocations don't oscillate.
  */
-/* Threshold when a connection is allocated more cache */
-#define	WT_CACHE_POOL_BUMP_THRESHOLD	6
-/* Threshold when a connection is allocated less cache */
-#define	WT_CACHE_POOL_REDUCE_THRESHOLD	2
+/* Pressure above which a connection is allocated more cache */
+#define	WT_CACHE_POOL_BUMP_THRESHOLD	100
+/* Pressure below which a connection is allocated less cache */
+#define	WT_CACHE_POOL_REDUCE_THRESHOLD	20
+/* Most chunks allocated to a connection in a single pass */
+#define	WT_CACHE_POOL_BUMP_CHUNKS	4
+/* Misses in a pass below which a connection's miss ratio is ignored */
+#define	WT_CACHE_POOL_MISS_MIN		10
 /* Balancing passes after a bump before a connection is a candidate. */
-#define	WT_CACHE_POOL_BUMP_SKIPS	10
+#define	WT_CACHE_POOL_BUMP_SKIPS	4
 /* Balancing passes after a reduction before a connection is a candidate. */
-#define	WT_CACHE_POOL_REDUCE_SKIPS	5
+#define	WT_CACHE_POOL_REDUCE_SKIPS	2
+/* Time between balancing passes, in microseconds */
+#define	WT_CACHE_POOL_PASS_USECS	250000
 
 static int __cache_pool_adjust(WT_SESSION_IMPL *, uint64_t, uint64_t, int *);
 static int __cache_pool_assess(WT_SESSION_IMPL *, uint64_t *);
@@ -406,25 +415,28 @@ __cache_pool_balance(WT_SESSION_IMPL *session)
 		goto err;
 
 	WT_ERR(__cache_pool_assess(session, &highest));
-	bump_threshold = WT_CACHE_POOL_BUMP_THRESHOLD;
+
 	/*
 	 * Actively attempt to:
 	 * - Reduce the amount allocated, if we are over the budget
-	 * - Increase the amount used if there is capacity and any pressure.
+	 * - Increase the amount used if there is capacity and pressure,
+	 *   starting with the connections under the most pressure.
 	 */
-	for (bump_threshold = WT_CACHE_POOL_BUMP_THRESHOLD;
+	for (bump_threshold = WT_MAX(highest, WT_CACHE_POOL_BUMP_THRESHOLD);
 	    F_ISSET_ATOMIC(cp, WT_CACHE_POOL_ACTIVE) &&
 	    F_ISSET(S2C(session)->cache, WT_CACHE_POOL_RUN);) {
 		WT_ERR(__cache_pool_adjust(
 		    session, highest, bump_threshold, &adjusted));
 		/*
-		 * Stop if the amount of cache being used is stable, and we
-		 * aren't over capacity.
+		 * Stop if the amount of cache being used is stable: a
+		 * connection is adjusted at most once in a pass unless the
+		 * pool is over capacity.
 		 */
-		if (cp->currently_used <= cp->size && !adjusted)
+		if (!adjusted &&
+		    bump_threshold == WT_CACHE_POOL_BUMP_THRESHOLD)
 			break;
-		if (bump_threshold > 0)
-			--bump_threshold;
+		bump_threshold =
+		    WT_MAX(bump_threshold / 2, WT_CACHE_POOL_BUMP_THRESHOLD);
 	}
 
 err:	__wt_spin_unlock(NULL, &cp->cache_pool_lock);
@@ -433,42 +445,78 @@ err:	__wt_spin_unlock(NULL, &cp->cache_pool_lock);
 
 /*
  * __cache_pool_assess --
- *	Assess the usage of the cache pool.
+ *	Assess the cache pressure of each connection in the cache pool.
  */
 static int
 __cache_pool_assess(WT_SESSION_IMPL *session, uint64_t *phighest)
 {
+	struct timespec now;
 	WT_CACHE_POOL *cp;
 	WT_CACHE *cache;
 	WT_CONNECTION_IMPL *entry;
-	uint64_t entries, highest, new;
+	uint64_t app_time, entries, evict_pressure, highest, interval;
+	uint64_t miss_pressure, misses, pressure, requests;
 
 	cp = __wt_process.cache_pool;
 	entries = highest = 0;
 
-	/* Generate read pressure information. */
+	WT_RET(__wt_epoch(session, &now));
+	interval = WT_TIMEDIFF(now, cp->assess_time) / 1000;
+	cp->assess_time = now;
+
+	/* Generate cache pressure information. */
 	TAILQ_FOREACH(entry, &cp->cache_pool_qh, cpq) {
 		if (entry->cache_size == 0 ||
 		    entry->cache == NULL)
 			continue;
 		cache = entry->cache;
 		++entries;
-		new = cache->bytes_read;
-		/* Handle wrapping of eviction requests. */
-		if (new >= cache->cp_saved_read)
-			cache->cp_current_read = new - cache->cp_saved_read;
-		else
-			cache->cp_current_read = new;
-		cache->cp_saved_read = new;
-		if (cache->cp_current_read > highest)
-			highest = cache->cp_current_read;
+
+		/* Allow to stabilize after changes. */
+		if (cache->cp_skip_count > 0)
+			--cache->cp_skip_count;
+
+		requests = cache->pages_requested - cache->cp_saved_requests;
+		cache->cp_saved_requests = cache->pages_requested;
+		misses = cache->pages_missed - cache->cp_saved_misses;
+		cache->cp_saved_misses = cache->pages_missed;
+		app_time = cache->app_evict_time - cache->cp_saved_app_time;
+		cache->cp_saved_app_time = cache->app_evict_time;
+
+		/*
+		 * A connection with a small working set that fits in its
+		 * cache has few misses, don't let a handful of misses look
+		 * like a high miss ratio.  Requests are counted in batches,
+		 * they can lag behind the misses.
+		 */
+		miss_pressure = misses < WT_CACHE_POOL_MISS_MIN ? 0 :
+		    (misses * 1000) / WT_MAX(requests, misses);
+
+		/*
+		 * The time application threads spent evicting, summed across
+		 * the threads, as a share of the time since the last pass.
+		 */
+		evict_pressure = interval == 0 ? 0 :
+		    WT_MIN(1000, (app_time * 1000) / interval);
+
+		/*
+		 * Smooth the pressure across passes: a single busy or idle
+		 * pass only moves it half way.
+		 */
+		pressure = WT_MAX(miss_pressure, evict_pressure);
+		cache->cp_pressure = (cache->cp_pressure + pressure) / 2;
+		if (cache->cp_pressure > highest)
+			highest = cache->cp_pressure;
+
+		WT_RET(__wt_verbose(session, WT_VERB_SHARED_CACHE,
+		    "%s: requests %" PRIu64 ", misses %" PRIu64
+		    ", eviction usecs %" PRIu64 ", pressure %" PRIu64,
+		    entry->home, requests, misses, app_time,
+		    cache->cp_pressure));
 	}
 	WT_RET(__wt_verbose(session, WT_VERB_SHARED_CACHE,
-	    "Highest eviction count: %" PRIu64 ", entries: %" PRIu64,
+	    "Highest cache pressure: %" PRIu64 ", entries: %" PRIu64,
 	    highest, entries));
-	/* Normalize eviction information across connections. */
-	highest = highest / (entries + 1);
-	++highest; /* Avoid divide by zero. */
 
 	*phighest = highest;
 	return (0);
@@ -487,7 +535,7 @@ __cache_pool_adjust(WT_SESSION_IMPL *session,
 	WT_CACHE_POOL *cp;
 	WT_CACHE *cache;
 	WT_CONNECTION_IMPL *entry;
-	uint64_t adjusted, reserved, read_pressure;
+	uint64_t adjusted, chunks, pressure, reserved;
 	int force, grew;
 
 	*adjustedp = 0;
@@ -498,7 +546,7 @@ __cache_pool_adjust(WT_SESSION_IMPL *session,
 		WT_RET(__wt_verbose(session,
 		    WT_VERB_SHARED_CACHE, "Cache pool distribution: "));
 		WT_RET(__wt_verbose(session, WT_VERB_SHARED_CACHE,
-		    "\t" "cache_size, read_pressure, skips: "));
+		    "\t" "cache_size, pressure, skips: "));
 	}
 
 	TAILQ_FOREACH(entry, &cp->cache_pool_qh, cpq) {
@@ -506,13 +554,16 @@ __cache_pool_adjust(WT_SESSION_IMPL *session,
 		reserved = cache->cp_reserved;
 		adjusted = 0;
 
-		read_pressure = cache->cp_current_read / highest;
+		pressure = cache->cp_pressure;
 		WT_RET(__wt_verbose(session, WT_VERB_SHARED_CACHE,
 		    "\t%" PRIu64 ", %" PRIu64 ", %" PRIu32,
-		    entry->cache_size, read_pressure, cache->cp_skip_count));
+		    entry->cache_size, pressure, cache->cp_skip_count));
 
-		/* Allow to stabilize after changes. */
-		if (cache->cp_skip_count > 0 && --cache->cp_skip_count > 0)
+		/*
+		 * Allow to stabilize after changes, unless the pool is over
+		 * capacity.
+		 */
+		if (cache->cp_skip_count > 0 && !force)
 			continue;
 		/*
 		 * If the entry is currently allocated less than the reserved
@@ -528,14 +579,15 @@ __cache_pool_adjust(WT_SESSION_IMPL *session,
 		 * entry:
 		 *  - If we are forcing and this entry has more than the
 		 *    minimum amount of space in use.
-		 *  - If the read pressure in this entry is below the
-		 *    threshold, other entries need more cache, the entry has
-		 *    more than the minimum space and there is no available
-		 *    space in the pool.
+		 *  - If the pressure on this entry is below the threshold,
+		 *    another entry needs more cache, the entry has more than
+		 *    the minimum space and there is no available space in the
+		 *    pool.
 		 */
 		} else if ((force && entry->cache_size > reserved) ||
-		    (read_pressure < WT_CACHE_POOL_REDUCE_THRESHOLD &&
-		     highest > 1 && entry->cache_size > reserved &&
+		    (pressure < WT_CACHE_POOL_REDUCE_THRESHOLD &&
+		     highest >= WT_CACHE_POOL_BUMP_THRESHOLD &&
+		     entry->cache_size > reserved &&
 		     cp->currently_used >= cp->size)) {
 			grew = 0;
 			/*
@@ -549,20 +601,23 @@ __cache_pool_adjust(WT_SESSION_IMPL *session,
 		/*
 		 * Conditions for increasing the amount of resources for an
 		 * entry:
-		 *  - There was some activity across the pool
+		 *  - The entry is under enough pressure
 		 *  - This entry is using less than the entire cache pool
 		 *  - The connection is using enough cache to require eviction
 		 *  - There is space available in the pool
-		 *  - Additional cache would benefit the connection
+		 *
+		 * Entries under more pressure are allocated several chunks at
+		 * once, so they converge faster.
 		 */
-		} else if (highest > 1 &&
+		} else if (pressure >= bump_threshold &&
 		    entry->cache_size < cp->size &&
 		     cache->bytes_inmem >=
 		     (entry->cache_size * cache->eviction_target) / 100 &&
-		     cp->currently_used < cp->size &&
-		     read_pressure > bump_threshold) {
+		     cp->currently_used < cp->size) {
 			grew = 1;
-			adjusted = WT_MIN(cp->chunk,
+			chunks = WT_MIN(WT_CACHE_POOL_BUMP_CHUNKS,
+			    pressure / WT_CACHE_POOL_BUMP_THRESHOLD);
+			adjusted = WT_MIN(cp->chunk * chunks,
 			    cp->size - cp->currently_used);
 		}
 		if (adjusted > 0) {
@@ -613,7 +668,7 @@ __wt_cache_pool_server(void *arg)
 	    F_ISSET(cache, WT_CACHE_POOL_RUN)) {
 		if (cp->currently_used <= cp->size)
 			WT_ERR(__wt_cond_wait(session,
-			    cp->cache_pool_cond, 1000000));
+			    cp->cache_pool_cond, WT_CACHE_POOL_PASS_USECS));
 
 		/*
 		 * Re-check pool run flag - since we want to avoid getting the
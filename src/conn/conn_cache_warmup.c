@@ -0,0 +1,781 @@
+/*-
+ * Copyright (c) 2014-2015 MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * Cache warm-up: at the end of each database checkpoint, including the one
+ * taken when the database is closed, the addresses of the leaf pages in the
+ * cache are written to a file, most recently used pages first.  When the
+ * database is next opened, threads walk each listed file, reading the
+ * internal pages and the listed leaf pages and skipping the rest, until the
+ * listed pages are read or the cache reaches its eviction target.
+ *
+ * The list is only a hint: a listed address is only read if a page in the
+ * tree currently references it, so a list that no longer matches the files
+ * costs some wasted reads, it can't return the wrong data.
+ *
+ * The list file has one line per file:
+ *	F <uri>
+ * followed by one line per page, in read-generation order:
+ *	P <file number> <memory footprint> <hex address>
+ */
+
+/* Listed pages the warm-up threads pre-load at a time. */
+#define	WT_CACHE_WARMUP_PRELOAD	16
+
+/*
+ * WT_CACHE_WARMUP_PAGE --
+ *	A page being listed.
+ */
+typedef struct {
+	uint64_t read_gen;		/* Page read generation */
+	size_t	 footprint;		/* Page memory footprint */
+	size_t	 addr_offset;		/* Address offset in the buffer */
+	size_t	 addr_size;		/* Address length */
+	u_int	 file;			/* File number */
+} WT_CACHE_WARMUP_PAGE;
+
+/*
+ * WT_CACHE_WARMUP_LIST --
+ *	The pages being listed.
+ */
+typedef struct {
+	WT_CACHE_WARMUP_PAGE *pages;	/* Pages */
+	u_int	 page_cnt;
+	size_t	 page_alloc;
+
+	WT_ITEM	*addrs;			/* Page addresses */
+
+	char	**uris;			/* File URIs */
+	u_int	 uri_cnt;
+	size_t	 uri_alloc;
+} WT_CACHE_WARMUP_LIST;
+
+/*
+ * __warmup_addr_cmp --
+ *	Qsort/bsearch function for page addresses.
+ */
+static int
+__warmup_addr_cmp(const void *a, const void *b)
+{
+	const WT_ITEM *aitem, *bitem;
+	int cmp;
+
+	aitem = a;
+	bitem = b;
+	if ((cmp = memcmp(aitem->data, bitem->data,
+	    WT_MIN(aitem->size, bitem->size))) != 0)
+		return (cmp);
+	return (aitem->size < bitem->size ? -1 :
+	    (aitem->size == bitem->size ? 0 : 1));
+}
+
+/*
+ * __warmup_page_cmp --
+ *	Qsort function for listed pages: most recently used first.
+ */
+static int
+__warmup_page_cmp(const void *a, const void *b)
+{
+	const WT_CACHE_WARMUP_PAGE *apage, *bpage;
+
+	apage = a;
+	bpage = b;
+	return (apage->read_gen > bpage->read_gen ? -1 :
+	    (apage->read_gen == bpage->read_gen ? 0 : 1));
+}
+
+/*
+ * __warmup_listed --
+ *	Return if an address is in a file's warm-up list.
+ */
+static inline int
+__warmup_listed(
+    WT_CACHE_WARMUP_FILE *file, const uint8_t *addr, size_t addr_size)
+{
+	WT_ITEM key;
+
+	key.data = addr;
+	key.size = addr_size;
+	return (bsearch(&key, file->addr,
+	    file->addr_cnt, sizeof(WT_ITEM), __warmup_addr_cmp) != NULL);
+}
+
+/*
+ * __warmup_save_page --
+ *	Add a page to the list.
+ */
+static int
+__warmup_save_page(WT_SESSION_IMPL *session, WT_CACHE_WARMUP_LIST *list,
+    WT_PAGE *page, const uint8_t *addr, size_t addr_size, size_t footprint)
+{
+	WT_CACHE_WARMUP_PAGE *lp;
+
+	WT_RET(__wt_realloc_def(session,
+	    &list->page_alloc, list->page_cnt + 1, &list->pages));
+	WT_RET(__wt_buf_grow(
+	    session, list->addrs, list->addrs->size + addr_size));
+
+	lp = &list->pages[list->page_cnt++];
+	lp->read_gen = page->read_gen;
+	lp->footprint = footprint;
+	lp->addr_offset = list->addrs->size;
+	lp->addr_size = addr_size;
+	lp->file = list->uri_cnt;
+
+	memcpy(
+	    (uint8_t *)list->addrs->mem + list->addrs->size, addr, addr_size);
+	list->addrs->size += addr_size;
+	return (0);
+}
+
+/*
+ * __warmup_save_file --
+ *	List the pages of a single file.
+ */
+static int
+__warmup_save_file(WT_SESSION_IMPL *session, WT_CACHE_WARMUP_LIST *list)
+{
+	WT_BTREE *btree;
+	WT_DECL_RET;
+	WT_PAGE *page;
+	WT_MULTI *multi;
+	WT_PAGE_MODIFY *mod;
+	WT_REF *walk;
+	size_t addr_size;
+	uint32_t flags, i;
+	u_int saved;
+	const uint8_t *addr;
+
+	btree = S2BT(session);
+	walk = NULL;
+	saved = list->page_cnt;
+
+	/*
+	 * Only leaf pages are listed: the warm-up reads every internal page,
+	 * their addresses change whenever the tree's shape changes.
+	 */
+	flags = WT_READ_CACHE | WT_READ_NO_EVICT |
+	    WT_READ_NO_GEN | WT_READ_NO_WAIT | WT_READ_SKIP_INTL;
+	for (;;) {
+		WT_ERR(__wt_tree_walk(session, &walk, NULL, flags));
+		if (walk == NULL)
+			break;
+		if (F_ISSET(btree, WT_BTREE_NO_EVICTION))
+			break;
+
+		/*
+		 * List clean pages at their current address.  Pages that have
+		 * been written since they were read are listed at the address
+		 * of the blocks written, which the parent page references once
+		 * the checkpoint completes.
+		 */
+		page = walk->page;
+		mod = page->modify;
+		if (mod == NULL || F_ISSET(mod, WT_PM_REC_MASK) == 0) {
+			WT_ERR(__wt_ref_info(
+			    session, walk, &addr, &addr_size, NULL));
+			if (addr != NULL)
+				WT_ERR(__warmup_save_page(session, list, page,
+				    addr, addr_size, page->memory_footprint));
+			continue;
+		}
+
+		/*
+		 * The page's modification information can change underfoot if
+		 * the page is being reconciled, lock the page down.
+		 */
+		WT_PAGE_LOCK(session, page);
+		switch (F_ISSET(mod, WT_PM_REC_MASK)) {
+		case WT_PM_REC_MULTIBLOCK:
+			for (multi = mod->mod_multi,
+			    i = 0; i < mod->mod_multi_entries; ++multi, ++i)
+				if (multi->addr.addr != NULL && (ret =
+				    __warmup_save_page(session, list, page,
+				    multi->addr.addr, multi->addr.size,
+				    page->memory_footprint /
+				    mod->mod_multi_entries)) != 0)
+					break;
+			break;
+		case WT_PM_REC_REPLACE:
+			ret = __warmup_save_page(session, list, page,
+			    mod->mod_replace.addr, mod->mod_replace.size,
+			    page->memory_footprint);
+			break;
+		}
+		WT_PAGE_UNLOCK(session, page);
+		WT_ERR(ret);
+	}
+
+err:	/* On error, clear any left-over tree walk. */
+	if (walk != NULL)
+		WT_TRET(__wt_page_release(session, walk, flags));
+
+	/* Name the file if any of its pages were listed. */
+	if (ret == 0 && list->page_cnt > saved) {
+		WT_RET(__wt_realloc_def(session,
+		    &list->uri_alloc, list->uri_cnt + 1, &list->uris));
+		WT_RET(__wt_strdup(session,
+		    btree->dhandle->name, &list->uris[list->uri_cnt]));
+		++list->uri_cnt;
+	}
+	return (ret);
+}
+
+/*
+ * __warmup_save_tree --
+ *	List a single file's pages, unless a thread is writing the file or it's
+ *	being closed.
+ */
+static int
+__warmup_save_tree(WT_SESSION_IMPL *session,
+    WT_CACHE_WARMUP_LIST *list, WT_DATA_HANDLE *dhandle)
+{
+	WT_BTREE *btree;
+	WT_DECL_RET;
+
+	btree = dhandle->handle;
+
+	if (!WT_ATOMIC_CAS4(btree->walk_busy, 0, 1))
+		return (0);
+
+	/*
+	 * Re-check the "no eviction" flag, it is used to enforce exclusive
+	 * access when a handle is being closed.
+	 */
+	if (!F_ISSET(btree, WT_BTREE_NO_EVICTION))
+		WT_WITH_DHANDLE(session, dhandle,
+		    ret = __warmup_save_file(session, list));
+
+	WT_PUBLISH(btree->walk_busy, 0);
+	return (ret);
+}
+
+/*
+ * __warmup_save_write --
+ *	Write the list and rename it into place.
+ */
+static int
+__warmup_save_write(WT_SESSION_IMPL *session, WT_CACHE_WARMUP_LIST *list)
+{
+	FILE *fp;
+	WT_CACHE_WARMUP_PAGE *lp;
+	WT_DECL_ITEM(tmp);
+	WT_DECL_RET;
+	u_int i;
+
+	fp = NULL;
+
+	WT_RET(__wt_scr_alloc(session, 0, &tmp));
+	WT_ERR(__wt_fopen(session,
+	    WT_CACHE_RESIDENT_SET, WT_FHANDLE_WRITE, 0, &fp));
+
+	for (i = 0; i < list->uri_cnt; ++i)
+		WT_ERR(__wt_fprintf(session, fp, "F %s\n", list->uris[i]));
+
+	qsort(list->pages, list->page_cnt,
+	    sizeof(WT_CACHE_WARMUP_PAGE), __warmup_page_cmp);
+	for (i = 0, lp = list->pages; i < list->page_cnt; ++i, ++lp) {
+		WT_ERR(__wt_raw_to_hex(session,
+		    (uint8_t *)list->addrs->data + lp->addr_offset,
+		    lp->addr_size, tmp));
+		WT_ERR(__wt_fprintf(session, fp,
+		    "P %u %" WT_SIZET_FMT " %s\n",
+		    lp->file, lp->footprint, (const char *)tmp->data));
+	}
+
+	/* Flush the handle and rename the file into place. */
+	ret = __wt_sync_and_rename_fp(
+	    session, &fp, WT_CACHE_RESIDENT_SET, WT_CACHE_RESIDENT);
+
+	/* Close any file handle left open, remove any temporary file. */
+err:	if (fp != NULL) {
+		WT_TRET(__wt_fclose(session, &fp, WT_FHANDLE_WRITE));
+		WT_TRET(__wt_remove_if_exists(session, WT_CACHE_RESIDENT_SET));
+	}
+	__wt_scr_free(session, &tmp);
+	return (ret);
+}
+
+/*
+ * __wt_cache_warmup_save --
+ *	Write the list of pages in the cache.
+ */
+int
+__wt_cache_warmup_save(WT_SESSION_IMPL *session)
+{
+	WT_CACHE *cache;
+	WT_CACHE_WARMUP_LIST list;
+	WT_CONNECTION_IMPL *conn;
+	WT_DATA_HANDLE *dhandle;
+	WT_DECL_RET;
+	u_int i;
+	int incr;
+
+	conn = S2C(session);
+	cache = conn->cache;
+
+	/*
+	 * Don't replace the list until the warm-up is complete, the cache
+	 * may not yet hold the pages it lists.
+	 */
+	if (!cache->warmup || !cache->warmup_complete)
+		return (0);
+
+	WT_CLEAR(list);
+	incr = 0;
+
+	WT_RET(__wt_scr_alloc(session, 0, &list.addrs));
+
+	/*
+	 * Lock the dhandle list to find the next handle and bump its reference
+	 * count to keep it alive while we walk it.
+	 */
+	__wt_spin_lock(session, &conn->dhandle_lock);
+	for (dhandle = SLIST_FIRST(&conn->dhlh);
+	    dhandle != NULL; dhandle = SLIST_NEXT(dhandle, l)) {
+		if (incr) {
+			WT_ASSERT(session, dhandle->session_inuse > 0);
+			(void)WT_ATOMIC_SUB4(dhandle->session_inuse, 1);
+			incr = 0;
+		}
+
+		/*
+		 * Ignore non-file handles, checkpoint handles, handles that
+		 * aren't open and the metadata, which is always read.
+		 */
+		if (!WT_PREFIX_MATCH(dhandle->name, "file:") ||
+		    dhandle->checkpoint != NULL ||
+		    !F_ISSET(dhandle, WT_DHANDLE_OPEN) ||
+		    WT_IS_METADATA(dhandle) ||
+		    F_ISSET((WT_BTREE *)dhandle->handle, WT_BTREE_NO_EVICTION))
+			continue;
+
+		(void)WT_ATOMIC_ADD4(dhandle->session_inuse, 1);
+		incr = 1;
+		__wt_spin_unlock(session, &conn->dhandle_lock);
+
+		ret = __warmup_save_tree(session, &list, dhandle);
+
+		__wt_spin_lock(session, &conn->dhandle_lock);
+		if (ret != 0)
+			break;
+	}
+	if (incr) {
+		WT_ASSERT(session, dhandle->session_inuse > 0);
+		(void)WT_ATOMIC_SUB4(dhandle->session_inuse, 1);
+	}
+	__wt_spin_unlock(session, &conn->dhandle_lock);
+	WT_ERR(ret);
+
+	WT_ERR(__warmup_save_write(session, &list));
+	WT_STAT_FAST_CONN_SET(session, cache_warmup_saved, list.page_cnt);
+
+err:	for (i = 0; i < list.uri_cnt; ++i)
+		__wt_free(session, list.uris[i]);
+	__wt_free(session, list.uris);
+	__wt_free(session, list.pages);
+	__wt_scr_free(session, &list.addrs);
+	return (ret);
+}
+
+/*
+ * __warmup_load_file --
+ *	Add a file to the warm-up list.
+ */
+static int
+__warmup_load_file(WT_SESSION_IMPL *session, const char *uri)
+{
+	WT_CACHE *cache;
+
+	cache = S2C(session)->cache;
+
+	WT_RET(__wt_realloc_def(session, &cache->warmup_file_alloc,
+	    cache->warmup_file_cnt + 1, &cache->warmup_files));
+	WT_RET(__wt_strdup(session,
+	    uri, &cache->warmup_files[cache->warmup_file_cnt].uri));
+	++cache->warmup_file_cnt;
+	return (0);
+}
+
+/*
+ * __warmup_load_page --
+ *	Add a page address to a file's warm-up list.
+ */
+static int
+__warmup_load_page(
+    WT_SESSION_IMPL *session, WT_CACHE_WARMUP_FILE *file, WT_ITEM *addr)
+{
+	WT_RET(__wt_realloc_def(session,
+	    &file->addr_alloc, file->addr_cnt + 1, &file->addr));
+	WT_RET(__wt_buf_set(session,
+	    &file->addr[file->addr_cnt], addr->data, addr->size));
+	++file->addr_cnt;
+	return (0);
+}
+
+/*
+ * __warmup_discard --
+ *	Discard the warm-up list.
+ */
+static void
+__warmup_discard(WT_SESSION_IMPL *session)
+{
+	WT_CACHE *cache;
+	WT_CACHE_WARMUP_FILE *file;
+	u_int i, j;
+
+	cache = S2C(session)->cache;
+
+	for (i = 0, file = cache->warmup_files;
+	    i < cache->warmup_file_cnt; ++i, ++file) {
+		__wt_free(session, file->uri);
+		for (j = 0; j < file->addr_cnt; ++j)
+			__wt_buf_free(session, &file->addr[j]);
+		__wt_free(session, file->addr);
+	}
+	__wt_free(session, cache->warmup_files);
+	cache->warmup_file_cnt = 0;
+	cache->warmup_file_alloc = 0;
+}
+
+/*
+ * __warmup_load --
+ *	Read the list of pages to warm the cache, taking the most recently used
+ *	pages until they fill the cache to its eviction target.
+ */
+static int
+__warmup_load(WT_SESSION_IMPL *session)
+{
+	FILE *fp;
+	WT_CACHE *cache;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_ITEM(addr);
+	WT_DECL_ITEM(line);
+	WT_DECL_RET;
+	uint64_t footprint, loaded, target;
+	u_int i, fileno;
+	int exist, n;
+	const char *p;
+
+	conn = S2C(session);
+	cache = conn->cache;
+	fp = NULL;
+
+	WT_RET(__wt_exist(session, WT_CACHE_RESIDENT, &exist));
+	if (!exist)
+		return (0);
+
+	WT_RET(__wt_scr_alloc(session, 0, &addr));
+	WT_ERR(__wt_scr_alloc(session, 0, &line));
+	WT_ERR(__wt_fopen(session,
+	    WT_CACHE_RESIDENT, WT_FHANDLE_READ, 0, &fp));
+
+	target = (conn->cache_size * cache->eviction_target) / 100;
+	for (loaded = 0;;) {
+		WT_ERR(__wt_getline(session, line, fp));
+		if (line->size == 0)
+			break;
+
+		p = line->data;
+		if (p[0] == 'F' && p[1] == ' ')
+			WT_ERR(__warmup_load_file(session, p + 2));
+		else if (p[0] == 'P' && p[1] == ' ') {
+			if (sscanf(p + 2, "%u %" SCNu64 " %n",
+			    &fileno, &footprint, &n) != 2 ||
+			    fileno >= cache->warmup_file_cnt)
+				goto format;
+			if (loaded + footprint > target)
+				break;
+			loaded += footprint;
+
+			WT_ERR(__wt_hex_to_raw(session, p + 2 + n, addr));
+			WT_ERR(__warmup_load_page(session,
+			    &cache->warmup_files[fileno], addr));
+		} else
+			goto format;
+	}
+
+	/* Sort each file's addresses for searching. */
+	for (i = 0; i < cache->warmup_file_cnt; ++i)
+		qsort(cache->warmup_files[i].addr,
+		    cache->warmup_files[i].addr_cnt,
+		    sizeof(WT_ITEM), __warmup_addr_cmp);
+
+	if (0) {
+format:		__wt_errx(session,
+		    "%s: unexpected cache warm-up list entry: %s, ignoring "
+		    "the list", WT_CACHE_RESIDENT, (const char *)line->data);
+		__warmup_discard(session);
+	}
+
+err:	WT_TRET(__wt_fclose(session, &fp, WT_FHANDLE_READ));
+	__wt_scr_free(session, &addr);
+	__wt_scr_free(session, &line);
+	return (ret);
+}
+
+/*
+ * __wt_cache_warmup_skip --
+ *	Return if a tree walk warming the cache should skip a page.
+ */
+int
+__wt_cache_warmup_skip(WT_SESSION_IMPL *session, WT_REF *ref, int *skipp)
+{
+	WT_BM *bm;
+	WT_CACHE_WARMUP_FILE *file;
+	WT_PAGE_INDEX *pindex;
+	WT_REF *next;
+	size_t addr_size;
+	uint32_t slot;
+	u_int preloaded, type;
+	const uint8_t *addr;
+
+	*skipp = 1;
+	type = 0;
+
+	/* Internal pages are always read, they lead to the listed pages. */
+	file = S2BT(session)->warmup;
+	WT_RET(__wt_ref_info(session, ref, &addr, &addr_size, &type));
+	if (addr == NULL)
+		return (0);
+	if (type == WT_CELL_ADDR_INT) {
+		*skipp = 0;
+		return (0);
+	}
+	if (!__warmup_listed(file, addr, addr_size))
+		return (0);
+	*skipp = 0;
+
+	WT_STAT_FAST_CONN_INCR(session, cache_warmup_read);
+
+	/*
+	 * The walk reads pages one at a time: ask the block manager to pre-load
+	 * this page and the next listed pages on the same parent page, so the
+	 * reads are queued together.  Don't pre-load the same pages twice.
+	 */
+	__wt_page_refp(session, ref, &pindex, &slot);
+	if (file->preload_home == ref->home && slot < file->preload_slot)
+		return (0);
+
+	bm = S2BT(session)->bm;
+	for (preloaded = 0; slot < pindex->entries &&
+	    preloaded < WT_CACHE_WARMUP_PRELOAD; ++slot) {
+		next = pindex->index[slot];
+		if (next->state != WT_REF_DISK)
+			continue;
+		WT_RET(__wt_ref_info(session, next, &addr, &addr_size, NULL));
+		if (addr == NULL || !__warmup_listed(file, addr, addr_size))
+			continue;
+		WT_RET(bm->preload(bm, session, addr, addr_size));
+		++preloaded;
+	}
+	file->preload_home = ref->home;
+	file->preload_slot = slot;
+	return (0);
+}
+
+/*
+ * __warmup_tree --
+ *	Read a single file's listed pages into the cache.
+ */
+static int
+__warmup_tree(WT_SESSION_IMPL *session,
+    WT_EVICT_WORKER *worker, WT_CACHE_WARMUP_FILE *file)
+{
+	WT_BTREE *btree;
+	WT_CACHE *cache;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_REF *walk;
+	uint64_t target;
+	uint32_t flags;
+
+	conn = S2C(session);
+	cache = conn->cache;
+	walk = NULL;
+
+	/*
+	 * Files that have been dropped or are busy are skipped, the list is
+	 * only a hint.
+	 */
+	ret = __wt_session_get_btree(session, file->uri, NULL, NULL, 0);
+	if (ret == ENOENT || ret == EBUSY || ret == WT_NOTFOUND)
+		return (0);
+	WT_RET(ret);
+
+	btree = S2BT(session);
+	btree->warmup = file;
+
+	target = (conn->cache_size * cache->eviction_target) / 100;
+	flags = WT_READ_NO_EVICT | WT_READ_WARMUP;
+	for (;;) {
+		WT_ERR(__wt_tree_walk(session, &walk, NULL, flags));
+		if (walk == NULL)
+			break;
+
+		/*
+		 * Give up if the thread is being stopped or the cache has
+		 * filled up, applications are reading their own pages.
+		 */
+		if (!F_ISSET(worker, WT_EVICT_WORKER_RUN) ||
+		    __wt_cache_bytes_inuse(cache) >= target)
+			break;
+	}
+
+err:	/* On error, clear any left-over tree walk. */
+	if (walk != NULL)
+		WT_TRET(__wt_page_release(session, walk, flags));
+
+	btree->warmup = NULL;
+	WT_TRET(__wt_session_release_btree(session));
+	return (ret);
+}
+
+/*
+ * __warmup_server --
+ *	Thread to read listed pages into the cache.
+ */
+static WT_THREAD_RET
+__warmup_server(void *arg)
+{
+	WT_CACHE *cache;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_EVICT_WORKER *worker;
+	WT_SESSION_IMPL *session;
+	uint32_t next;
+
+	worker = arg;
+	session = worker->session;
+	conn = S2C(session);
+	cache = conn->cache;
+
+	/* Threads take the next file to read from the list, in turn. */
+	while (F_ISSET(conn, WT_CONN_SERVER_RUN) &&
+	    F_ISSET(worker, WT_EVICT_WORKER_RUN)) {
+		next = WT_ATOMIC_ADD4(cache->warmup_file_next, 1) - 1;
+		if (next >= cache->warmup_file_cnt)
+			break;
+		WT_ERR(__warmup_tree(
+		    session, worker, &cache->warmup_files[next]));
+	}
+
+	/*
+	 * Once the last thread finishes the list, new lists can be saved.
+	 * If the threads were stopped before finishing, leave the old list
+	 * in place.
+	 */
+	if (WT_ATOMIC_SUB4(cache->warmup_running, 1) == 0 &&
+	    cache->warmup_file_next >= cache->warmup_file_cnt)
+		cache->warmup_complete = 1;
+
+	WT_ERR(__wt_verbose(
+	    session, WT_VERB_EVICTSERVER, "cache warm-up thread exiting"));
+
+	if (0) {
+err:		WT_PANIC_MSG(session, ret, "cache warm-up thread error");
+	}
+	return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * __wt_cache_warmup_create --
+ *	Configure the cache warm-up and start the warm-up threads.
+ */
+int
+__wt_cache_warmup_create(WT_SESSION_IMPL *session, const char *cfg[])
+{
+	WT_CACHE *cache;
+	WT_CONFIG_ITEM cval;
+	WT_CONNECTION_IMPL *conn;
+	WT_EVICT_WORKER *workers;
+	uint32_t i, threads;
+
+	conn = S2C(session);
+	cache = conn->cache;
+
+	WT_RET(__wt_config_gets(session, cfg, "cache_warmup.enabled", &cval));
+	cache->warmup = cval.val != 0;
+	if (!cache->warmup)
+		return (0);
+
+	WT_RET(__warmup_load(session));
+	if (cache->warmup_file_cnt == 0) {
+		cache->warmup_complete = 1;
+		return (0);
+	}
+
+	/* There's no point starting more threads than there are files. */
+	WT_RET(__wt_config_gets(session, cfg, "cache_warmup.threads", &cval));
+	threads = WT_MIN((uint32_t)cval.val, cache->warmup_file_cnt);
+
+	WT_RET(__wt_calloc_def(session, threads, &cache->warmup_workers));
+	cache->warmup_alloc = threads;
+	workers = cache->warmup_workers;
+
+	/*
+	 * Warm-up threads have their own sessions, the running count is set
+	 * before any thread starts so the first thread to finish can't think
+	 * it's the last.
+	 */
+	cache->warmup_running = threads;
+	for (i = 0; i < threads; i++) {
+		WT_RET(__wt_open_internal_session(conn,
+		    "cache-warm-up", 0, 0, &workers[i].session));
+		workers[i].id = i;
+		F_SET(&workers[i], WT_EVICT_WORKER_RUN);
+		WT_RET(__wt_thread_create(workers[i].session,
+		    &workers[i].tid, __warmup_server, &workers[i]));
+		++cache->warmup_threads;
+	}
+
+	return (0);
+}
+
+/*
+ * __wt_cache_warmup_destroy --
+ *	Stop the warm-up threads and discard the list.
+ */
+int
+__wt_cache_warmup_destroy(WT_SESSION_IMPL *session)
+{
+	WT_CACHE *cache;
+	WT_DECL_RET;
+	WT_EVICT_WORKER *workers;
+	WT_SESSION *wt_session;
+	uint32_t i;
+
+	cache = S2C(session)->cache;
+	if (cache == NULL)
+		return (0);
+
+	if ((workers = cache->warmup_workers) != NULL) {
+		for (i = 0; i < cache->warmup_threads; i++)
+			F_CLR(&workers[i], WT_EVICT_WORKER_RUN);
+		for (i = 0; i < cache->warmup_threads; i++)
+			WT_TRET(__wt_thread_join(session, workers[i].tid));
+		cache->warmup_threads = 0;
+
+		/*
+		 * Close the threads' sessions, including any from a failed
+		 * start.
+		 */
+		for (i = 0; i < cache->warmup_alloc; i++)
+			if (workers[i].session != NULL) {
+				wt_session = &workers[i].session->iface;
+				WT_TRET(wt_session->close(wt_session, NULL));
+			}
+		__wt_free(session, cache->warmup_workers);
+		cache->warmup_alloc = 0;
+	}
+
+	__warmup_discard(session);
+	return (ret);
+}
@@ -782,6 +782,13 @@ __wt_conn_dhandle_discard(WT_SESSION_IMPL *session)
 
 	conn = S2C(session);
 
+	/*
+	 * Our default session may have cached handles of files it created on
+	 * the connection's behalf, for example the lookaside table: discard
+	 * them before the handles are freed.
+	 */
+	__wt_session_close_cache(session);
+
 	/*
 	 * Close open data handles: first, everything but the metadata file
 	 * (as closing a normal file may open and write the metadata file),
@@ -52,6 +52,7 @@ __wt_connection_init(WT_CONNECTION_IMPL *conn)
 	WT_RET(__wt_spin_init(session, &conn->dhandle_lock, "data handle"));
 	WT_RET(__wt_spin_init(session, &conn->fh_lock, "file list"));
 	WT_RET(__wt_spin_init(session, &conn->hot_backup_lock, "hot backup"));
+	WT_RET(__wt_spin_init(session, &conn->las_lock, "lookaside table"));
 	WT_RET(__wt_spin_init(session, &conn->reconfig_lock, "reconfigure"));
 	WT_RET(__wt_spin_init(session, &conn->schema_lock, "schema"));
 	WT_RET(__wt_spin_init(session, &conn->table_lock, "table creation"));
@@ -91,6 +92,11 @@ __wt_connection_init(WT_CONNECTION_IMPL *conn)
 		SLIST_INIT(&conn->blockhash[i]);/* Block handle hash lists */
 	SLIST_INIT(&conn->blocklh);		/* Block manager list */
 
+	/* Block image cache. */
+	WT_RET(__wt_spin_init(
+	    session, &conn->block_cache.lock, "block image cache"));
+	TAILQ_INIT(&conn->block_cache.lru);
+
 	return (0);
 }
 
@@ -130,10 +136,12 @@ __wt_connection_destroy(WT_CONNECTION_IMPL *conn)
 
 	__wt_spin_destroy(session, &conn->api_lock);
 	__wt_spin_destroy(session, &conn->block_lock);
+	__wt_spin_destroy(session, &conn->block_cache.lock);
 	__wt_spin_destroy(session, &conn->checkpoint_lock);
 	__wt_spin_destroy(session, &conn->dhandle_lock);
 	__wt_spin_destroy(session, &conn->fh_lock);
 	__wt_spin_destroy(session, &conn->hot_backup_lock);
+	__wt_spin_destroy(session, &conn->las_lock);
 	__wt_spin_destroy(session, &conn->reconfig_lock);
 	__wt_spin_destroy(session, &conn->schema_lock);
 	__wt_spin_destroy(session, &conn->table_lock);
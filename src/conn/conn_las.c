@@ -0,0 +1,200 @@
+/*-
+ * Copyright (c) 2014-2015 MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * The lookaside table: when eviction can't make progress because the pages
+ * it needs to evict have updates a running transaction may still read, the
+ * pages are written with their newest committed updates and the older
+ * updates are copied into the lookaside table, keyed by the address of the
+ * block written, so the pages can be discarded from the cache.  When one of
+ * the blocks is read back into the cache, its updates are instantiated from
+ * the table, and once no transaction can read them, they're removed by the
+ * sweep server.
+ *
+ * The table only holds updates for blocks written since the database was
+ * opened, it is discarded and re-created when the database is next opened.
+ * The table is shared by all threads, through a single cursor protected by
+ * a lock.
+ */
+
+/*
+ * __wt_las_create --
+ *	Create the lookaside table and open its cursor.
+ */
+int
+__wt_las_create(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_CURSOR *cursor;
+	WT_DECL_RET;
+	const char *drop_cfg[] = {
+	    WT_CONFIG_BASE(session, session_drop), "force=true", NULL };
+	const char *open_cursor_cfg[] = {
+	    WT_CONFIG_BASE(session, session_open_cursor), NULL };
+
+	conn = S2C(session);
+
+	/* Discard any table left by a previous run, then re-create it. */
+	WT_WITH_SCHEMA_LOCK(session,
+	    ret = __wt_schema_drop(session, WT_LAS_URI, drop_cfg));
+	WT_RET(ret);
+	WT_WITH_SCHEMA_LOCK(session,
+	    ret = __wt_schema_create(session, WT_LAS_URI, WT_LAS_FORMAT));
+	WT_RET(ret);
+
+	/*
+	 * The table is written on behalf of committed transactions, by threads
+	 * that may be evicting pages: the session doesn't log its updates or
+	 * block waiting for space in the cache, and never waits on another
+	 * transaction.
+	 */
+	WT_RET(__wt_open_internal_session(
+	    conn, "lookaside table", 1, 1, &conn->las_session));
+	F_SET(conn->las_session,
+	    WT_SESSION_NO_CACHE_CHECK | WT_SESSION_NO_LOGGING);
+	conn->las_session->isolation =
+	    conn->las_session->txn.isolation = TXN_ISO_READ_UNCOMMITTED;
+
+	WT_RET(__wt_open_cursor(conn->las_session,
+	    WT_LAS_URI, NULL, open_cursor_cfg, &cursor));
+	F_SET(((WT_CURSOR_BTREE *)cursor)->btree, WT_BTREE_LOOKASIDE);
+
+	__wt_spin_lock(session, &conn->las_lock);
+	conn->las_cursor = cursor;
+	__wt_spin_unlock(session, &conn->las_lock);
+
+	return (0);
+}
+
+/*
+ * __wt_las_destroy --
+ *	Close the lookaside table's cursor and session.
+ */
+int
+__wt_las_destroy(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_SESSION *wt_session;
+
+	conn = S2C(session);
+
+	if (conn->las_session == NULL)
+		return (0);
+
+	/* Closing the session closes the cursor. */
+	__wt_spin_lock(session, &conn->las_lock);
+	conn->las_cursor = NULL;
+	__wt_spin_unlock(session, &conn->las_lock);
+
+	wt_session = &conn->las_session->iface;
+	ret = wt_session->close(wt_session, NULL);
+	conn->las_session = NULL;
+
+	__wt_buf_free(session, &conn->las_sweep_key);
+	return (ret);
+}
+
+/*
+ * __wt_las_cursor --
+ *	Return the lookaside table's cursor, locked, or NULL if the table isn't
+ *	open.
+ */
+void
+__wt_las_cursor(WT_SESSION_IMPL *session, WT_CURSOR **cursorp)
+{
+	WT_CONNECTION_IMPL *conn;
+
+	conn = S2C(session);
+
+	__wt_spin_lock(session, &conn->las_lock);
+	if ((*cursorp = conn->las_cursor) == NULL)
+		__wt_spin_unlock(session, &conn->las_lock);
+}
+
+/*
+ * __wt_las_cursor_close --
+ *	Reset and release the lookaside table's cursor.
+ */
+int
+__wt_las_cursor_close(WT_SESSION_IMPL *session, WT_CURSOR **cursorp)
+{
+	WT_CURSOR *cursor;
+	WT_DECL_RET;
+
+	if ((cursor = *cursorp) == NULL)
+		return (0);
+	*cursorp = NULL;
+
+	ret = cursor->reset(cursor);
+	__wt_spin_unlock(session, &S2C(session)->las_lock);
+	return (ret);
+}
+
+/*
+ * __wt_las_sweep --
+ *	Remove lookaside records no transaction can read: a record can be read
+ *	until the update written in its place on the page is globally visible.
+ *	Each call reviews a limited number of records, continuing from where
+ *	the last call stopped.
+ */
+int
+__wt_las_sweep(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_CURSOR *cursor;
+	WT_DECL_RET;
+	WT_ITEM las_key, las_value, key;
+	uint64_t onpage_timestamp, onpage_txnid, timestamp, txnid;
+	u_int cnt;
+	uint8_t deleted;
+	int exact;
+
+	conn = S2C(session);
+
+	__wt_las_cursor(session, &cursor);
+	if (cursor == NULL)
+		return (0);
+
+	if (conn->las_sweep_key.size == 0)
+		ret = cursor->next(cursor);
+	else {
+		__wt_cursor_set_raw_key(cursor, &conn->las_sweep_key);
+		if ((ret = cursor->search_near(cursor, &exact)) == 0 &&
+		    exact < 0)
+			ret = cursor->next(cursor);
+	}
+	for (cnt = 0; ret == 0; ret = cursor->next(cursor)) {
+		/* Remember where to start the next call. */
+		if (++cnt > WT_LAS_SWEEP_ENTRIES) {
+			WT_ERR(__wt_cursor_get_raw_key(cursor, &las_key));
+			WT_ERR(__wt_buf_set(session,
+			    &conn->las_sweep_key, las_key.data, las_key.size));
+			break;
+		}
+
+		WT_ERR(cursor->get_value(cursor, &onpage_txnid,
+		    &onpage_timestamp, &txnid, &timestamp, &deleted,
+		    &key, &las_value));
+		if (!__wt_txn_visible_all(session, onpage_txnid) ||
+		    !__wt_txn_timestamp_visible_all(session, onpage_timestamp))
+			continue;
+
+		WT_ERR(cursor->remove(cursor));
+		WT_STAT_FAST_CONN_INCR(session, cache_lookaside_remove);
+	}
+	if (ret == WT_NOTFOUND) {
+		conn->las_sweep_key.size = 0;
+		ret = 0;
+	}
+
+err:	WT_TRET(__wt_las_cursor_close(session, &cursor));
+	return (ret);
+}
@@ -78,6 +78,10 @@ __logmgr_config(WT_SESSION_IMPL *session, const char **cfg, int *runp)
 	conn->log_file_max = (wt_off_t)cval.val;
 	WT_STAT_FAST_CONN_SET(session, log_max_filesize, conn->log_file_max);
 
+	WT_RET(__wt_config_gets(session, cfg, "log.format", &cval));
+	if (WT_STRING_MATCH("compact", cval.str, cval.len))
+		FLD_SET(conn->log_flags, WT_CONN_LOG_COMPACT);
+
 	WT_RET(__wt_config_gets(session, cfg, "log.prealloc", &cval));
 	/*
 	 * If pre-allocation is configured, set the initial number to one.
@@ -321,6 +325,10 @@ __log_close_server(void *arg)
 			WT_ERR(__wt_cond_signal(session, log->log_sync_cond));
 			locked = 0;
 			__wt_spin_unlock(session, &log->log_sync_lock);
+			/*
+			 * The flush thread can sync the next log file now.
+			 */
+			WT_ERR(__wt_cond_signal(session, conn->log_flush_cond));
 		} else
 			/* Wait until the next event. */
 			WT_ERR(__wt_cond_wait(session,
@@ -328,7 +336,8 @@ __log_close_server(void *arg)
 	}
 
 	if (0) {
-err:		__wt_err(session, ret, "log close server error");
+err:		__wt_log_error(session, ret);
+		__wt_err(session, ret, "log close server error");
 	}
 	if (locked)
 		__wt_spin_unlock(session, &log->log_sync_lock);
@@ -358,84 +367,133 @@ __log_wrlsn_cmp(const void *a, const void *b)
 }
 
 /*
- * __log_wrlsn_server --
- *	The log wrlsn server thread.
+ * __log_wrlsn_once --
+ *	Write the slots threads have finished filling, and process the
+ *	written slots in LSN order.
  */
-static WT_THREAD_RET
-__log_wrlsn_server(void *arg)
+static int
+__log_wrlsn_once(WT_SESSION_IMPL *session, int *yieldp)
 {
 	WT_CONNECTION_IMPL *conn;
 	WT_DECL_RET;
 	WT_LOG *log;
 	WT_LOG_WRLSN_ENTRY written[SLOT_POOL];
 	WT_LOGSLOT *slot;
-	WT_SESSION_IMPL *session;
-	size_t written_i;
-	uint32_t i, save_i;
-	int yield;
+	size_t write_size, written_i;
+	uint32_t i;
 
-	session = arg;
 	conn = S2C(session);
 	log = conn->log;
-	yield = 0;
-	while (F_ISSET(conn, WT_CONN_LOG_SERVER_RUN)) {
-		/*
-		 * No need to use the log_slot_lock because the slot pool
-		 * is statically allocated and any slot in the
-		 * WT_LOG_SLOT_WRITTEN state is exclusively ours for now.
-		 */
-		i = 0;
-		written_i = 0;
-		/*
-		 * Walk the array once saving any slots that are in the
-		 * WT_LOG_SLOT_WRITTEN state.
-		 */
-		while (i < SLOT_POOL) {
-			save_i = i;
-			slot = &log->slot_pool[i++];
-			if (slot->slot_state != WT_LOG_SLOT_WRITTEN)
-				continue;
-			written[written_i].slot_index = save_i;
-			written[written_i++].lsn = slot->slot_release_lsn;
-		}
-		/*
-		 * If we found any written slots process them.  We sort them
-		 * based on the release LSN, and then look for them in order.
-		 */
-		if (written_i > 0) {
-			yield = 0;
-			qsort(written, written_i, sizeof(WT_LOG_WRLSN_ENTRY),
-			    __log_wrlsn_cmp);
+
+	/*
+	 * No need to use the log_slot_lock because the slot pool is
+	 * statically allocated and any slot in the WT_LOG_SLOT_READY or
+	 * WT_LOG_SLOT_WRITTEN state is exclusively ours for now.
+	 *
+	 * Walk the array once, writing any slots that are in the
+	 * WT_LOG_SLOT_READY state as we find them: the order of the writes
+	 * doesn't matter, the write LSN only moves past a slot once the slots
+	 * before it are written.  Save any slots that are in the
+	 * WT_LOG_SLOT_WRITTEN state.
+	 */
+	written_i = 0;
+	for (i = 0; i < SLOT_POOL; i++) {
+		slot = &log->slot_pool[i];
+		if (slot->slot_state == WT_LOG_SLOT_READY) {
+			WT_READ_BARRIER();
 			/*
-			 * We know the written array is sorted by LSN.  Go
-			 * through them either advancing write_lsn or stop
-			 * as soon as one is not in order.
+			 * Write the buffered records, unless log space couldn't
+			 * be allocated for them, or an earlier write or sync of
+			 * the log failed.  If the write fails, the slot is
+			 * still processed, so threads waiting for it see the
+			 * error.
 			 */
-			for (i = 0; i < written_i; i++) {
-				if (LOG_CMP(&log->write_lsn,
-				    &written[i].lsn) != 0)
-					break;
-				/*
-				 * If we get here we have a slot to process.
-				 * Advance the LSN and process the slot.
-				 */
-				slot = &log->slot_pool[written[i].slot_index];
-				WT_ASSERT(session, LOG_CMP(&written[i].lsn,
-				    &slot->slot_release_lsn) == 0);
-				log->write_lsn = slot->slot_end_lsn;
-				WT_ERR(__wt_cond_signal(session,
-				    log->log_write_cond));
-				WT_STAT_FAST_CONN_INCR(session, log_write_lsn);
-
-				/*
-				 * Signal the close thread if needed.
-				 */
-				if (F_ISSET(slot, SLOT_CLOSEFH))
-					WT_ERR(__wt_cond_signal(session,
-					    conn->log_close_cond));
-				WT_ERR(__wt_log_slot_free(session, slot));
+			write_size = (size_t)(slot->slot_end_lsn.offset -
+			    slot->slot_start_offset);
+			if (slot->slot_error == 0)
+				slot->slot_error = log->log_error;
+			if (slot->slot_error == 0) {
+				if ((ret = __wt_write(session, slot->slot_fh,
+				    slot->slot_start_offset, write_size,
+				    slot->slot_buf.mem)) == 0)
+					WT_STAT_FAST_CONN_INCR(
+					    session, log_writer_writes);
+				else {
+					slot->slot_error = ret;
+					__wt_log_error(session, ret);
+					ret = 0;
+				}
 			}
+			slot->slot_state = WT_LOG_SLOT_WRITTEN;
 		}
+		if (slot->slot_state != WT_LOG_SLOT_WRITTEN)
+			continue;
+		written[written_i].slot_index = i;
+		written[written_i++].lsn = slot->slot_release_lsn;
+	}
+	/*
+	 * If we found any written slots process them.  We sort them
+	 * based on the release LSN, and then look for them in order.
+	 */
+	if (written_i == 0)
+		return (0);
+	*yieldp = 0;
+	qsort(written, written_i, sizeof(WT_LOG_WRLSN_ENTRY), __log_wrlsn_cmp);
+	/*
+	 * We know the written array is sorted by LSN.  Go through them either
+	 * advancing write_lsn or stop as soon as one is not in order.
+	 */
+	for (i = 0; i < written_i; i++) {
+		if (LOG_CMP(&log->write_lsn, &written[i].lsn) != 0)
+			break;
+		/*
+		 * If we get here we have a slot to process.  Advance the LSN
+		 * and process the slot.
+		 */
+		slot = &log->slot_pool[written[i].slot_index];
+		WT_ASSERT(session,
+		    LOG_CMP(&written[i].lsn, &slot->slot_release_lsn) == 0);
+		__wt_spin_lock(session, &log->log_lock);
+		log->write_lsn = slot->slot_end_lsn;
+		__wt_spin_unlock(session, &log->log_lock);
+		WT_RET(__wt_cond_signal(session, log->log_write_cond));
+		WT_STAT_FAST_CONN_INCR(session, log_write_lsn);
+
+		/*
+		 * Signal the close thread if needed.
+		 */
+		if (F_ISSET_ATOMIC(slot, SLOT_CLOSEFH))
+			WT_RET(__wt_cond_signal(session, conn->log_close_cond));
+		WT_RET(__wt_log_slot_free(session, slot));
+	}
+
+	/*
+	 * Signal the flush thread if threads are waiting for a sync of the log
+	 * we may have just written.
+	 */
+	if (i > 0 && LOG_CMP(&log->sync_req_lsn, &log->sync_lsn) > 0)
+		WT_RET(__wt_cond_signal(session, conn->log_flush_cond));
+	return (0);
+}
+
+/*
+ * __log_wrlsn_server --
+ *	The log writer thread: writes the consolidated slots, and advances
+ *	the write LSN.
+ */
+static WT_THREAD_RET
+__log_wrlsn_server(void *arg)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+	int yield;
+
+	session = arg;
+	conn = S2C(session);
+	yield = 0;
+	while (F_ISSET(conn, WT_CONN_LOG_SERVER_RUN)) {
+		WT_ERR(__log_wrlsn_once(session, &yield));
 		/*
 		 * If we saw a later write, we always want to yield because
 		 * we know something is in progress.
@@ -448,8 +506,46 @@ __log_wrlsn_server(void *arg)
 			    conn->log_wrlsn_cond, 100000));
 	}
 
-	if (0)
-err:		__wt_err(session, ret, "log wrlsn server error");
+	/*
+	 * Write any slots released before the connection stopped the thread,
+	 * there are no threads left to fill slots.
+	 */
+	WT_ERR(__log_wrlsn_once(session, &yield));
+
+	if (0) {
+err:		__wt_log_error(session, ret);
+		__wt_err(session, ret, "log wrlsn server error");
+	}
+	return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * __log_flush_server --
+ *	The log flush thread: syncs the log for threads waiting for their
+ *	records to be durable, so their requests share syncs.
+ */
+static WT_THREAD_RET
+__log_flush_server(void *arg)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+	int synced;
+
+	session = arg;
+	conn = S2C(session);
+	while (F_ISSET(conn, WT_CONN_LOG_SERVER_RUN)) {
+		WT_ERR(__wt_log_flush_once(session, &synced));
+		if (!synced)
+			/* Wait until the next event. */
+			WT_ERR(__wt_cond_wait(session,
+			    conn->log_flush_cond, 100000));
+	}
+
+	if (0) {
+err:		__wt_log_error(session, ret);
+		__wt_err(session, ret, "log flush server error");
+	}
 	return (WT_THREAD_RET_VALUE);
 }
 
@@ -545,11 +641,13 @@ __wt_logmgr_create(WT_SESSION_IMPL *session, const char *cfg[])
 	WT_INIT_LSN(&log->ckpt_lsn);
 	WT_INIT_LSN(&log->first_lsn);
 	WT_INIT_LSN(&log->sync_lsn);
+	WT_INIT_LSN(&log->sync_req_lsn);
 	/*
 	 * We only use file numbers for directory sync, so this needs to
 	 * initialized to zero.
 	 */
 	WT_ZERO_LSN(&log->sync_dir_lsn);
+	WT_ZERO_LSN(&log->sync_dir_req_lsn);
 	WT_INIT_LSN(&log->trunc_lsn);
 	WT_INIT_LSN(&log->write_lsn);
 	log->fileid = 0;
@@ -604,6 +702,18 @@ __wt_logmgr_open(WT_SESSION_IMPL *session)
 	    &conn->log_wrlsn_tid, __log_wrlsn_server, conn->log_wrlsn_session));
 	conn->log_wrlsn_tid_set = 1;
 
+	/*
+	 * Start the log flush thread.  It is not configurable.
+	 * If logging is enabled, this thread runs.
+	 */
+	WT_RET(__wt_open_internal_session(
+	    conn, "log-flush-server", 0, 0, &conn->log_flush_session));
+	WT_RET(__wt_cond_alloc(conn->log_flush_session,
+	    "log flush server", 0, &conn->log_flush_cond));
+	WT_RET(__wt_thread_create(conn->log_flush_session,
+	    &conn->log_flush_tid, __log_flush_server, conn->log_flush_session));
+	conn->log_flush_tid_set = 1;
+
 	/* If no log thread services are configured, we're done. */ 
 	if (!FLD_ISSET(conn->log_flags,
 	    (WT_CONN_LOG_ARCHIVE | WT_CONN_LOG_PREALLOC)))
@@ -687,6 +797,17 @@ __wt_logmgr_destroy(WT_SESSION_IMPL *session)
 		WT_TRET(wt_session->close(wt_session, NULL));
 		conn->log_wrlsn_session = NULL;
 	}
+	if (conn->log_flush_tid_set) {
+		WT_TRET(__wt_cond_signal(session, conn->log_flush_cond));
+		WT_TRET(__wt_thread_join(session, conn->log_flush_tid));
+		conn->log_flush_tid_set = 0;
+	}
+	WT_TRET(__wt_cond_destroy(session, &conn->log_flush_cond));
+	if (conn->log_flush_session != NULL) {
+		wt_session = &conn->log_flush_session->iface;
+		WT_TRET(wt_session->close(wt_session, NULL));
+		conn->log_flush_session = NULL;
+	}
 
 	WT_TRET(__wt_log_close(session));
 
@@ -75,6 +75,7 @@ __wt_connection_close(WT_CONNECTION_IMPL *conn)
 	WT_DECL_RET;
 	WT_DLH *dlh;
 	WT_FH *fh;
+	WT_SESSION *wt_session;
 	WT_SESSION_IMPL *s, *session;
 	WT_TXN_GLOBAL *txn_global;
 	u_int i;
@@ -83,6 +84,12 @@ __wt_connection_close(WT_CONNECTION_IMPL *conn)
 	txn_global = &conn->txn_global;
 	session = conn->default_session;
 
+	/*
+	 * Discard prepared transactions recovered when the database was opened
+	 * and not resolved since, they are recovered again on the next open.
+	 */
+	WT_TRET(__wt_txn_prepare_close(session));
+
 	/*
 	 * We're shutting down.  Make sure everything gets freed.
 	 *
@@ -116,6 +123,22 @@ __wt_connection_close(WT_CONNECTION_IMPL *conn)
 	WT_TRET(__wt_checkpoint_server_destroy(session));
 	WT_TRET(__wt_statlog_destroy(session, 1));
 	WT_TRET(__wt_sweep_destroy(session));
+	WT_TRET(__wt_evict_writeback_destroy(session));
+	WT_TRET(__wt_cache_warmup_destroy(session));
+
+	/*
+	 * If the cache is warmed when the database is opened, checkpoint the
+	 * database before closing the files: the checkpoint lists the pages
+	 * in the cache at the addresses the files will have when re-opened.
+	 */
+	if (conn->cache != NULL &&
+	    conn->cache->warmup && conn->cache->warmup_complete) {
+		wt_session = &session->iface;
+		WT_TRET(wt_session->checkpoint(wt_session, NULL));
+	}
+
+	/* Close the lookaside table, eviction no longer needs it. */
+	WT_TRET(__wt_las_destroy(session));
 
 	/* Close open data handles. */
 	WT_TRET(__wt_conn_dhandle_discard(session));
@@ -255,6 +278,15 @@ __wt_connection_workers(WT_SESSION_IMPL *session, const char *cfg[])
 	 */
 	WT_RET(__wt_logmgr_open(session));
 
+	/* Create the lookaside table. */
+	WT_RET(__wt_las_create(session));
+
+	/* Start the optional write-back threads. */
+	WT_RET(__wt_evict_writeback_create(session, cfg));
+
+	/* Start the optional cache warm-up threads. */
+	WT_RET(__wt_cache_warmup_create(session, cfg));
+
 	/* Start the optional checkpoint thread. */
 	WT_RET(__wt_checkpoint_server_create(session, cfg));
 
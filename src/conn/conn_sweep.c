@@ -148,6 +148,133 @@ unlock:		WT_TRET(__wt_writeunlock(session, dhandle->rwlock));
 	return (0);
 }
 
+/*
+ * __sweep_obsolete_file --
+ *	Discard obsolete updates from a single file's dirty leaf pages.
+ */
+static int
+__sweep_obsolete_file(WT_SESSION_IMPL *session)
+{
+	WT_BTREE *btree;
+	WT_DECL_RET;
+	WT_PAGE *page;
+	WT_REF *walk;
+	uint64_t count, pages, updates;
+	uint32_t flags;
+
+	btree = S2BT(session);
+	walk = NULL;
+	pages = updates = 0;
+
+	flags = WT_READ_CACHE | WT_READ_NO_EVICT |
+	    WT_READ_NO_WAIT | WT_READ_SKIP_INTL;
+	for (;;) {
+		WT_ERR(__wt_tree_walk(session, &walk, NULL, flags));
+		if (walk == NULL)
+			break;
+		if (F_ISSET(btree, WT_BTREE_NO_EVICTION))
+			break;
+
+		page = walk->page;
+		if (!__wt_page_is_modified(page))
+			continue;
+		if ((count = __wt_update_obsolete_page(session, page)) != 0) {
+			++pages;
+			updates += count;
+		}
+	}
+
+err:	/* On error, clear any left-over tree walk. */
+	if (walk != NULL)
+		WT_TRET(__wt_page_release(session, walk, flags));
+
+	WT_STAT_FAST_CONN_INCRV(session, cache_obsolete_pages, pages);
+	WT_STAT_FAST_CONN_INCRV(session, cache_obsolete_updates, updates);
+	return (ret);
+}
+
+/*
+ * __sweep_obsolete_tree --
+ *	Discard a single file's obsolete updates, unless another thread is
+ *	walking the file or it's being closed.
+ */
+static int
+__sweep_obsolete_tree(WT_SESSION_IMPL *session, WT_DATA_HANDLE *dhandle)
+{
+	WT_BTREE *btree;
+	WT_DECL_RET;
+
+	btree = dhandle->handle;
+
+	if (!WT_ATOMIC_CAS4(btree->walk_busy, 0, 1))
+		return (0);
+
+	/*
+	 * Re-check the "no eviction" flag, it is used to enforce exclusive
+	 * access when a handle is being closed.
+	 */
+	if (!F_ISSET(btree, WT_BTREE_NO_EVICTION))
+		WT_WITH_DHANDLE(session, dhandle,
+		    ret = __sweep_obsolete_file(session));
+
+	WT_PUBLISH(btree->walk_busy, 0);
+	return (ret);
+}
+
+/*
+ * __sweep_obsolete --
+ *	Discard obsolete updates from the cache's dirty pages: updates to a key
+ *	discard the key's obsolete updates, but keys that are not updated once
+ *	their history can be discarded keep it until the page is written, and
+ *	readers walk it in the meantime.
+ */
+static int
+__sweep_obsolete(WT_SESSION_IMPL *session)
+{
+	WT_BTREE *btree;
+	WT_CONNECTION_IMPL *conn;
+	WT_DATA_HANDLE *dhandle;
+	WT_DECL_RET;
+
+	conn = S2C(session);
+
+	/* Update the oldest ID: it decides which updates can be discarded. */
+	__wt_txn_update_oldest(session);
+
+	/*
+	 * Lock the dhandle list to find the next handle and bump its reference
+	 * count to keep it alive while we walk it.
+	 */
+	__wt_spin_lock(session, &conn->dhandle_lock);
+	for (dhandle = SLIST_FIRST(&conn->dhlh);
+	    dhandle != NULL; dhandle = SLIST_NEXT(dhandle, l)) {
+		/* Ignore non-file handles, checkpoints and clean files. */
+		if (!WT_PREFIX_MATCH(dhandle->name, "file:") ||
+		    dhandle->checkpoint != NULL ||
+		    !F_ISSET(dhandle, WT_DHANDLE_OPEN))
+			continue;
+		btree = dhandle->handle;
+		if (!btree->modified ||
+		    F_ISSET(btree, WT_BTREE_NO_EVICTION) ||
+		    btree->walk_busy)
+			continue;
+
+		(void)WT_ATOMIC_ADD4(dhandle->session_inuse, 1);
+		__wt_spin_unlock(session, &conn->dhandle_lock);
+
+		ret = __sweep_obsolete_tree(session, dhandle);
+
+		__wt_spin_lock(session, &conn->dhandle_lock);
+		WT_ASSERT(session, dhandle->session_inuse > 0);
+		(void)WT_ATOMIC_SUB4(dhandle->session_inuse, 1);
+		if (ret != 0)
+			break;
+	}
+	__wt_spin_unlock(session, &conn->dhandle_lock);
+
+	return (ret);
+}
+
 /*
  * __sweep_server --
  *	The handle sweep server thread.
@@ -173,6 +300,12 @@ __sweep_server(void *arg)
 
 		/* Sweep the handles. */
 		WT_ERR(__sweep(session));
+
+		/* Remove lookaside records no transaction can read. */
+		WT_ERR(__wt_las_sweep(session));
+
+		/* Discard obsolete updates. */
+		WT_ERR(__sweep_obsolete(session));
 	}
 
 	if (0) {
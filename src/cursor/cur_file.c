@@ -242,6 +242,10 @@ __curfile_insert(WT_CURSOR *cursor)
 		WT_CURSOR_NEEDKEY(cursor);
 	WT_CURSOR_NEEDVALUE(cursor);
 
+	WT_ERR(__wt_cache_write_check(session, cbt->btree,
+	    (F_ISSET(cursor, WT_CURSTD_APPEND) ? 0 : cursor->key.size) +
+	    cursor->value.size));
+
 	WT_BTREE_CURSOR_SAVE_AND_RESTORE(cursor, __wt_btcur_insert(cbt), ret);
 
 	/*
@@ -281,6 +285,9 @@ __curfile_update(WT_CURSOR *cursor)
 	WT_CURSOR_NEEDKEY(cursor);
 	WT_CURSOR_NEEDVALUE(cursor);
 
+	WT_ERR(__wt_cache_write_check(
+	    session, cbt->btree, cursor->key.size + cursor->value.size));
+
 	WT_BTREE_CURSOR_SAVE_AND_RESTORE(cursor, __wt_btcur_update(cbt), ret);
 
 err:	CURSOR_UPDATE_API_END(session, ret);
@@ -328,6 +335,8 @@ __curfile_remove(WT_CURSOR *cursor)
 	WT_CURSOR_NEEDKEY(cursor);
 	WT_CURSOR_NOVALUE(cursor);
 
+	WT_ERR(__wt_cache_write_check(session, cbt->btree, cursor->key.size));
+
 	WT_BTREE_CURSOR_SAVE_AND_RESTORE(cursor, __wt_btcur_remove(cbt), ret);
 
 	/*
@@ -348,6 +357,56 @@ err:	CURSOR_UPDATE_API_END(session, ret);
 	return (ret);
 }
 
+/*
+ * __wt_curfile_batch_sorted --
+ *	Return if write batch operations through a cursor can be sorted and
+ *	applied directly to the tree: the cursor must be a btree cursor on a
+ *	row-store using the default collator.
+ */
+int
+__wt_curfile_batch_sorted(WT_CURSOR *cursor)
+{
+	WT_BTREE *btree;
+
+	/* Bulk, checkpoint and dump cursors have their own insert methods. */
+	if (cursor->insert != __curfile_insert)
+		return (0);
+
+	btree = ((WT_CURSOR_BTREE *)cursor)->btree;
+	return (btree->type == BTREE_ROW && btree->collator == NULL ? 1 : 0);
+}
+
+/*
+ * __wt_curfile_batch --
+ *	Apply a sorted write batch operation through a btree cursor.
+ */
+int
+__wt_curfile_batch(WT_CURSOR *cursor, WT_BATCH_OP *op)
+{
+	WT_CURSOR_BTREE *cbt;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+
+	cbt = (WT_CURSOR_BTREE *)cursor;
+	session = (WT_SESSION_IMPL *)cursor->session;
+
+	cursor->key.data = op->key.data;
+	cursor->key.size = op->key.size;
+	if (op->type == WT_BATCH_REMOVE)
+		cursor->value.size = 0;
+	else {
+		cursor->value.data = op->value.data;
+		cursor->value.size = op->value.size;
+	}
+
+	WT_RET(__wt_cache_write_check(session,
+	    cbt->btree, cursor->key.size + cursor->value.size));
+
+	WT_WITH_BTREE(session, cbt->btree,
+	    ret = __wt_btcur_batch(cbt, op->type));
+	return (ret);
+}
+
 /*
  * __curfile_close --
  *	WT_CURSOR->close method for the btree cursor type.
@@ -449,6 +508,14 @@ __wt_curfile_create(WT_SESSION_IMPL *session,
 		cursor->reset = __curfile_reset;
 	}
 
+	/*
+	 * read_once
+	 * Pages read by the cursor are the first candidates for eviction.
+	 */
+	WT_ERR(__wt_config_gets_def(session, cfg, "read_once", 0, &cval));
+	if (cval.val != 0)
+		F_SET(cbt, WT_CBT_READ_ONCE);
+
 	/* __wt_cursor_init is last so we don't have to clean up on error. */
 	WT_ERR(__wt_cursor_init(
 	    cursor, cursor->internal_uri, owner, cfg, cursorp));
@@ -38,6 +38,7 @@ __curlog_logrec(WT_SESSION_IMPL *session,
 
 	/* A step count of 0 means the entire record. */
 	cl->step_count = 0;
+	__wt_txn_log_keys_reset(cl->keys);
 
 	/*
 	 * Unpack the txnid so that we can return each
@@ -91,19 +92,21 @@ err:	API_END_RET(session, ret);
  *	in the log.  We're only interested in put and remove operations
  *	since truncate is not a cursor operation.  All successful
  *	returns from this function will have set up the cursor copy of
- *	key and value to give the user.
+ *	key and value to give the user.  Operations from compact log records
+ *	are returned as the put or remove they encode, with the full key.
  */
 static int
 __curlog_op_read(WT_SESSION_IMPL *session,
-    WT_CURSOR_LOG *cl, uint32_t optype, uint32_t opsize, uint32_t *fileid)
+    WT_CURSOR_LOG *cl, uint32_t *optypep, uint32_t opsize, uint32_t *fileid)
 {
-	WT_ITEM key, value;
+	WT_ITEM key, suffix, value;
 	uint64_t recno;
+	uint32_t prefix;
 	const uint8_t *end, *pp;
 
 	pp = cl->stepp;
 	end = pp + opsize;
-	switch (optype) {
+	switch (*optypep) {
 	case WT_LOGOP_COL_PUT:
 		WT_RET(__wt_logop_col_put_unpack(session, &pp, end,
 		    fileid, &recno, &value));
@@ -130,6 +133,25 @@ __curlog_op_read(WT_SESSION_IMPL *session,
 		WT_RET(__wt_buf_set(session, cl->opkey, key.data, key.size));
 		WT_RET(__wt_buf_set(session, cl->opvalue, NULL, 0));
 		break;
+	case WT_LOGOP_ROW_PUT_COMPACT:
+		WT_RET(__wt_logop_row_put_compact_unpack(session, &pp, end,
+		    fileid, &prefix, &suffix, &value));
+		WT_RET(__wt_txn_log_key_decode(
+		    session, cl->keys, *fileid, prefix, &suffix, &key));
+		WT_RET(__wt_buf_set(session, cl->opkey, key.data, key.size));
+		WT_RET(__wt_buf_set(session,
+		    cl->opvalue, value.data, value.size));
+		*optypep = WT_LOGOP_ROW_PUT;
+		break;
+	case WT_LOGOP_ROW_REMOVE_COMPACT:
+		WT_RET(__wt_logop_row_remove_compact_unpack(session, &pp, end,
+		    fileid, &prefix, &suffix));
+		WT_RET(__wt_txn_log_key_decode(
+		    session, cl->keys, *fileid, prefix, &suffix, &key));
+		WT_RET(__wt_buf_set(session, cl->opkey, key.data, key.size));
+		WT_RET(__wt_buf_set(session, cl->opvalue, NULL, 0));
+		*optypep = WT_LOGOP_ROW_REMOVE;
+		break;
 	default:
 		/*
 		 * Any other operations return the record in the value
@@ -161,7 +183,8 @@ __curlog_kv(WT_SESSION_IMPL *session, WT_CURSOR *cursor)
 	if ((key_count = cl->step_count++) > 0) {
 		WT_RET(__wt_logop_read(session,
 		    &cl->stepp, cl->stepp_end, &optype, &opsize));
-		WT_RET(__curlog_op_read(session, cl, optype, opsize, &fileid));
+		WT_RET(__curlog_op_read(
+		    session, cl, &optype, opsize, &fileid));
 		/* Position on the beginning of the next record part. */
 		cl->stepp += opsize;
 	} else {
@@ -322,6 +345,8 @@ __curlog_close(WT_CURSOR *cursor)
 	__wt_scr_free(session, &cl->logrec);
 	__wt_scr_free(session, &cl->opkey);
 	__wt_scr_free(session, &cl->opvalue);
+	__wt_txn_log_keys_free(session, cl->keys);
+	__wt_free(session, cl->keys);
 	__wt_free(session, cl->packed_key);
 	__wt_free(session, cl->packed_value);
 	WT_TRET(__wt_cursor_close(cursor));
@@ -377,6 +402,7 @@ __wt_curlog_open(WT_SESSION_IMPL *session,
 	WT_ERR(__wt_scr_alloc(session, 0, &cl->logrec));
 	WT_ERR(__wt_scr_alloc(session, 0, &cl->opkey));
 	WT_ERR(__wt_scr_alloc(session, 0, &cl->opvalue));
+	WT_ERR(__wt_calloc_one(session, &cl->keys));
 	cursor->key_format = LOGC_KEY_FORMAT;
 	cursor->value_format = LOGC_VALUE_FORMAT;
 
@@ -397,6 +423,7 @@ err:		if (F_ISSET(cursor, WT_CURSTD_OPEN))
 			__wt_scr_free(session, &cl->logrec);
 			__wt_scr_free(session, &cl->opkey);
 			__wt_scr_free(session, &cl->opvalue);
+			__wt_free(session, cl->keys);
 			/*
 			 * NOTE:  We cannot get on the error path with the
 			 * readlock held.  No need to unlock it unless that
@@ -8,6 +8,7 @@
 
 #include "wt_internal.h"
 
+static int   __evict_clear_all_walks(WT_SESSION_IMPL *);
 static int   __evict_clear_walks(WT_SESSION_IMPL *);
 static int   __evict_has_work(WT_SESSION_IMPL *, uint32_t *);
 static int   WT_CDECL __evict_lru_cmp(const void *, const void *);
@@ -15,8 +16,12 @@ static int   __evict_lru_pages(WT_SESSION_IMPL *, int);
 static int   __evict_lru_walk(WT_SESSION_IMPL *, uint32_t);
 static int   __evict_pass(WT_SESSION_IMPL *);
 static int   __evict_walk(WT_SESSION_IMPL *, uint32_t);
-static int   __evict_walk_file(WT_SESSION_IMPL *, u_int *, uint32_t);
+static int   __evict_walk_file(
+	WT_SESSION_IMPL *, WT_EVICT_QUEUE *, u_int *, uint32_t);
+static int   __evict_walk_tree(WT_SESSION_IMPL *,
+	WT_DATA_HANDLE *, WT_EVICT_QUEUE *, u_int *, uint32_t);
 static WT_THREAD_RET __evict_worker(void *);
+static int   __evict_worker_walk(WT_SESSION_IMPL *, WT_EVICT_WORKER *, u_int *);
 static int __evict_server_work(WT_SESSION_IMPL *);
 
 /*
@@ -26,13 +31,16 @@ static int __evict_server_work(WT_SESSION_IMPL *);
 static inline uint64_t
 __evict_read_gen(const WT_EVICT_ENTRY *entry)
 {
+	WT_BTREE *btree;
 	WT_PAGE *page;
+	int64_t skew;
 	uint64_t read_gen;
 
 	/* Never prioritize empty slots. */
 	if (entry->ref == NULL)
 		return (UINT64_MAX);
 
+	btree = entry->btree;
 	page = entry->ref->page;
 
 	/* Any empty page (leaf or internal), is a good choice. */
@@ -41,13 +49,57 @@ __evict_read_gen(const WT_EVICT_ENTRY *entry)
 
 	/*
 	 * Skew the read generation for internal pages, we prefer to evict leaf
-	 * pages.
+	 * pages.  Only internal pages heading cold subtrees are queued, the
+	 * skew is small enough that they don't stay in the cache for long once
+	 * their children are gone.
+	 *
+	 * Similarly, with the 2Q policy, skew the read generation for pages
+	 * accessed repeatedly, we prefer to evict pages accessed once.  The
+	 * clock policy also maintains the access count, but gives pages their
+	 * second chance when walking, not when sorting the candidates.
 	 */
-	read_gen = page->read_gen + entry->btree->evict_priority;
+	read_gen = page->read_gen + btree->evict_priority;
 	if (WT_PAGE_IS_INTERNAL(page))
 		read_gen += WT_EVICT_INT_SKEW;
+	if (entry->protect && page->access_count > 1)
+		read_gen += WT_EVICT_PROTECT_SKEW;
+
+	/*
+	 * Skew the read generation for the object's configured priority, and
+	 * prefer pages of objects using more than their resident maximum.
+	 */
+	skew = (int64_t)btree->cache_priority * WT_EVICT_PRIORITY_SKEW;
+	if (__wt_cache_over_quota(btree))
+		skew -= WT_EVICT_QUOTA_SKEW;
+	if (skew >= 0)
+		return (read_gen + (uint64_t)skew);
+	return (read_gen > (uint64_t)-skew + WT_READGEN_OLDEST + 1 ?
+	    read_gen - (uint64_t)-skew : WT_READGEN_OLDEST + 1);
+}
+
+/*
+ * __evict_intl_cold --
+ *	Return if an internal page heads a cold subtree, that is, none of its
+ * children are in memory.
+ */
+static int
+__evict_intl_cold(WT_SESSION_IMPL *session, WT_PAGE *page)
+{
+	WT_REF *child;
+	int cold;
+
+	cold = 1;
+	WT_ENTER_PAGE_INDEX(session);
+	WT_INTL_FOREACH_BEGIN(session, page, child) {
+		if (child->state != WT_REF_DISK &&
+		    child->state != WT_REF_DELETED) {
+			cold = 0;
+			break;
+		}
+	} WT_INTL_FOREACH_END;
+	WT_LEAVE_PAGE_INDEX(session);
 
-	return (read_gen);
+	return (cold);
 }
 
 /*
@@ -81,6 +133,153 @@ __evict_list_clear(WT_SESSION_IMPL *session, WT_EVICT_ENTRY *e)
 	e->btree = WT_DEBUG_POINT;
 }
 
+/*
+ * __evict_queue_clear --
+ *	Clear entries for a btree or a single page from an eviction queue.
+ */
+static void
+__evict_queue_clear(WT_SESSION_IMPL *session,
+    WT_EVICT_QUEUE *queue, WT_BTREE *btree, WT_REF *ref)
+{
+	WT_EVICT_ENTRY *evict;
+	uint32_t i;
+
+	__wt_spin_lock(session, &queue->evict_lock);
+	for (i = queue->evict_current,
+	    evict = queue->evict_queue + i;
+	    i < queue->evict_candidates; i++, evict++)
+		if (evict->ref != NULL &&
+		    (evict->ref == ref || evict->btree == btree))
+			__evict_list_clear(session, evict);
+	__wt_spin_unlock(session, &queue->evict_lock);
+}
+
+/*
+ * __evict_queue_compact --
+ *	Discard entries that have already been taken from an eviction queue,
+ *	called with the queue locked.
+ */
+static void
+__evict_queue_compact(WT_EVICT_QUEUE *queue)
+{
+	uint32_t remaining;
+
+	if (queue->evict_current == 0)
+		return;
+
+	remaining = queue->evict_candidates - queue->evict_current;
+	if (remaining > 0)
+		memmove(queue->evict_queue,
+		    queue->evict_queue + queue->evict_current,
+		    remaining * sizeof(WT_EVICT_ENTRY));
+	queue->evict_candidates = remaining;
+	queue->evict_current = 0;
+}
+
+/*
+ * __evict_queue_push --
+ *	Add a page found by an eviction worker's walk to an eviction queue,
+ *	returning if there was space.
+ */
+static int
+__evict_queue_push(
+    WT_SESSION_IMPL *session, WT_EVICT_QUEUE *queue, WT_REF *ref)
+{
+	WT_CACHE *cache;
+	WT_EVICT_ENTRY *evict;
+	int pushed;
+
+	cache = S2C(session)->cache;
+	pushed = 0;
+
+	__wt_spin_lock(session, &queue->evict_lock);
+	if (queue->evict_candidates == cache->evict_slots)
+		__evict_queue_compact(queue);
+	if (queue->evict_candidates < cache->evict_slots) {
+		evict = queue->evict_queue + queue->evict_candidates;
+		evict->ref = ref;
+		evict->btree = S2BT(session);
+		evict->protect = cache->evict_policy == EVICT_POLICY_2Q;
+		++queue->evict_candidates;
+
+		/* Mark the page on the list */
+		F_SET_ATOMIC(ref->page, WT_PAGE_EVICT_LRU);
+		pushed = 1;
+	}
+	__wt_spin_unlock(session, &queue->evict_lock);
+
+	return (pushed);
+}
+
+/*
+ * __evict_queued --
+ *	Return the number of candidates waiting on the eviction queues.
+ */
+static inline uint32_t
+__evict_queued(WT_CACHE *cache)
+{
+	WT_EVICT_QUEUE *queue;
+	uint32_t current, candidates, queued;
+	u_int q;
+
+	for (q = 0, queued = 0; q < cache->evict_queue_alloc; ++q) {
+		queue = &cache->evict_queues[q];
+		current = queue->evict_current;
+		candidates = queue->evict_candidates;
+		if (candidates > current)
+			queued += candidates - current;
+	}
+	return (queued);
+}
+
+/*
+ * __evict_numa_groups --
+ *	Return the number of groups the eviction queues are divided into when
+ *	the cache is partitioned between NUMA nodes: a group for each node,
+ *	unless there are more nodes than queues.  Queue and node N belong to
+ *	group (N % groups).
+ */
+static inline u_int
+__evict_numa_groups(WT_CACHE *cache)
+{
+	return (
+	    WT_MIN(cache->numa_nodes, WT_MAX(1, cache->evict_queue_count)));
+}
+
+/*
+ * __evict_numa_skip --
+ *	Return if an eviction walk should skip a page because of the NUMA node
+ *	it belongs to.
+ */
+static inline int
+__evict_numa_skip(WT_SESSION_IMPL *session,
+    WT_EVICT_QUEUE *queue, WT_PAGE *page, uint32_t flags)
+{
+	WT_CACHE *cache;
+	u_int groups;
+
+	cache = S2C(session)->cache;
+	groups = __evict_numa_groups(cache);
+
+	/* Workers only queue pages from their own node. */
+	if (queue != NULL && page->numa_node % groups !=
+	    (u_int)(queue - cache->evict_queues) % groups)
+		return (1);
+
+	/*
+	 * When the cache is full, evict from the nodes using more than their
+	 * share of the cache, unless eviction is aggressive.
+	 */
+	if (!LF_ISSET(WT_EVICT_PASS_ALL) ||
+	    LF_ISSET(WT_EVICT_PASS_AGGRESSIVE) ||
+	    cache->numa[page->numa_node].bytes_inmem * cache->numa_nodes >=
+	    cache->bytes_inmem)
+		return (0);
+
+	WT_STAT_FAST_CONN_INCR(session, cache_eviction_numa_skip);
+	return (1);
+}
+
 /*
  * __wt_evict_list_clear_page --
  *	Make sure a page is not in the LRU eviction list.  This called from the
@@ -93,6 +292,7 @@ __wt_evict_list_clear_page(WT_SESSION_IMPL *session, WT_REF *ref)
 	WT_CACHE *cache;
 	WT_EVICT_ENTRY *evict;
 	uint32_t i, elem;
+	u_int q;
 
 	WT_ASSERT(session,
 	    __wt_ref_is_root(ref) || ref->state == WT_REF_LOCKED);
@@ -111,6 +311,16 @@ __wt_evict_list_clear_page(WT_SESSION_IMPL *session, WT_REF *ref)
 			break;
 		}
 
+	/*
+	 * If the page isn't on the LRU list, the eviction server has moved it
+	 * onto one of the eviction queues.  We're holding the LRU list lock,
+	 * so it can't move while we search.
+	 */
+	for (q = 0; q < cache->evict_queue_alloc &&
+	    F_ISSET_ATOMIC(ref->page, WT_PAGE_EVICT_LRU); ++q)
+		__evict_queue_clear(
+		    session, &cache->evict_queues[q], NULL, ref);
+
 	WT_ASSERT(session, !F_ISSET_ATOMIC(ref->page, WT_PAGE_EVICT_LRU));
 
 	__wt_spin_unlock(session, &cache->evict_lock);
@@ -363,6 +573,7 @@ __wt_evict_destroy(WT_SESSION_IMPL *session)
 	/* Handle shutdown when cleaning up after a failed open. */
 	if (conn->evict_workctx != NULL) {
 		for (i = 0; i < conn->evict_workers_alloc; i++) {
+			__wt_free(session, conn->evict_workctx[i].walk_last);
 			wt_session = &conn->evict_workctx[i].session->iface;
 			if (wt_session != NULL)
 				WT_TRET(wt_session->close(wt_session, NULL));
@@ -392,21 +603,58 @@ __evict_worker(void *arg)
 	WT_DECL_RET;
 	WT_EVICT_WORKER *worker;
 	WT_SESSION_IMPL *session;
+	u_int queued;
 
 	worker = arg;
 	session = worker->session;
 	conn = S2C(session);
 	cache = conn->cache;
 
+	/*
+	 * With the cache partitioned between NUMA nodes, run the worker on the
+	 * node whose pages its queue holds.  The worker still evicts if it
+	 * can't be bound.
+	 */
+	if (cache->numa_nodes != 0 && (ret = __wt_numa_bind(session,
+	    ((worker->id + 1) % WT_MAX(1, cache->evict_queue_count)) %
+	    __evict_numa_groups(cache))) != 0) {
+		__wt_err(session, ret, "eviction worker NUMA binding");
+		ret = 0;
+	}
+
 	while (F_ISSET(conn, WT_CONN_EVICTION_RUN) &&
 	    F_ISSET(worker, WT_EVICT_WORKER_RUN)) {
-		/* Don't spin in a busy loop if there is no work to do */
-		if ((ret = __evict_lru_pages(session, 0)) == WT_NOTFOUND)
-			WT_ERR(__wt_cond_wait(
-			    session, cache->evict_waiter_cond, 10000));
-		else
+		/* Release any walk position another thread is waiting on. */
+		if (cache->evict_clear_waiting != 0)
+			WT_ERR(__evict_clear_walks(session));
+
+		if ((ret = __evict_lru_pages(session, 0)) != WT_NOTFOUND) {
 			WT_ERR(ret);
+			continue;
+		}
+
+		/*
+		 * The queues are empty: if the cache needs eviction, the
+		 * server isn't finding candidates fast enough, walk some
+		 * files ourselves.  Don't spin in a busy loop if there is no
+		 * work to do.
+		 */
+		WT_ERR(__evict_worker_walk(session, worker, &queued));
+		if (queued != 0)
+			continue;
+
+		/* Don't pin pages with walk positions while idle. */
+		if (worker->walk_held) {
+			worker->walk_held = 0;
+			WT_ERR(__evict_clear_all_walks(session));
+		}
+		WT_ERR(__wt_cond_wait(
+		    session, cache->evict_waiter_cond, 10000));
 	}
+
+	/* Don't leave pages pinned by walks once the worker has stopped. */
+	WT_ERR(__evict_clear_all_walks(session));
+
 	WT_ERR(__wt_verbose(
 	    session, WT_VERB_EVICTSERVER, "cache eviction worker exiting"));
 
@@ -427,6 +675,8 @@ __evict_has_work(WT_SESSION_IMPL *session, uint32_t *flagsp)
 	WT_CONNECTION_IMPL *conn;
 	uint32_t flags;
 	uint64_t bytes_inuse, bytes_max, dirty_inuse;
+	u_int dirty_target;
+	int writeback;
 
 	conn = S2C(session);
 	cache = conn->cache;
@@ -444,11 +694,22 @@ __evict_has_work(WT_SESSION_IMPL *session, uint32_t *flagsp)
 	dirty_inuse = __wt_cache_dirty_inuse(cache);
 	bytes_max = conn->cache_size;
 
+	/*
+	 * If write-back threads are running, they clean dirty pages: eviction
+	 * only writes dirty pages if the write-back threads fall behind and
+	 * the dirty trigger is reached.
+	 */
+	writeback = conn->evict_writeback != 0 &&
+	    dirty_inuse <= (cache->eviction_dirty_trigger * bytes_max) / 100;
+	dirty_target = conn->evict_writeback == 0 ?
+	    cache->eviction_dirty_target : cache->eviction_dirty_trigger;
+
 	/* Check to see if the eviction server should run. */
-	if (bytes_inuse > (cache->eviction_target * bytes_max) / 100)
+	if (bytes_inuse > (cache->eviction_target * bytes_max) / 100) {
 		LF_SET(WT_EVICT_PASS_ALL);
-	else if (dirty_inuse >
-	    (cache->eviction_dirty_target * bytes_max) / 100)
+		if (writeback && !F_ISSET(cache, WT_CACHE_STUCK))
+			LF_SET(WT_EVICT_PASS_CLEAN);
+	} else if (dirty_inuse > (dirty_target * bytes_max) / 100)
 		/* Ignore clean pages unless the cache is too large */
 		LF_SET(WT_EVICT_PASS_DIRTY);
 	else if (F_ISSET(cache, WT_CACHE_WOULD_BLOCK)) {
@@ -458,10 +719,14 @@ __evict_has_work(WT_SESSION_IMPL *session, uint32_t *flagsp)
 		 * reached the eviction trigger.
 		 */
 		LF_SET(WT_EVICT_PASS_WOULD_BLOCK);
-		F_CLR(cache, WT_CACHE_WOULD_BLOCK);
-	}
+	} else if (F_ISSET(cache, WT_CACHE_OVER_QUOTA))
+		/*
+		 * Evict pages from objects using more than their resident
+		 * maximum, regardless of whether the cache is full.
+		 */
+		LF_SET(WT_EVICT_PASS_QUOTA);
 
-	if (F_ISSET(cache, WT_CACHE_STUCK))
+	if (F_ISSET(cache, WT_CACHE_STUCK | WT_CACHE_LOOKASIDE))
 		LF_SET(WT_EVICT_PASS_AGGRESSIVE);
 
 	*flagsp = flags;
@@ -501,12 +766,33 @@ __evict_pass(WT_SESSION_IMPL *session)
 			    session, cache->evict_waiter_cond));
 		}
 
+		/*
+		 * Once the cache is back under its targets, stop moving updates
+		 * to the lookaside table.
+		 */
 		WT_RET(__evict_has_work(session, &flags));
-		if (flags == 0)
+		if (flags == 0) {
+			F_CLR(cache, WT_CACHE_LOOKASIDE);
 			break;
+		}
+		if (LF_ISSET(WT_EVICT_PASS_WOULD_BLOCK))
+			F_CLR(cache, WT_CACHE_WOULD_BLOCK);
+		if (LF_ISSET(WT_EVICT_PASS_QUOTA)) {
+			F_CLR(cache, WT_CACHE_OVER_QUOTA);
+			WT_STAT_FAST_CONN_INCR(session, cache_eviction_quota);
+		}
 
-		if (loop > 10)
+		/*
+		 * If we aren't making progress, the pages we need to evict may
+		 * have updates pinned by old snapshots: evict them by moving
+		 * the updates to the lookaside table.
+		 */
+		if (loop > 10) {
 			LF_SET(WT_EVICT_PASS_AGGRESSIVE);
+			if (LF_ISSET(WT_EVICT_PASS_ALL | WT_EVICT_PASS_DIRTY) &&
+			    !F_ISSET(cache, WT_CACHE_LOOKASIDE))
+				F_SET(cache, WT_CACHE_LOOKASIDE);
+		}
 
 		/*
 		 * Start a worker if we have capacity and we haven't reached
@@ -552,7 +838,8 @@ __evict_pass(WT_SESSION_IMPL *session)
 				 * Mark the cache as stuck if we need space
 				 * and aren't evicting any pages.
 				 */
-				if (!LF_ISSET(WT_EVICT_PASS_WOULD_BLOCK)) {
+				if (!LF_ISSET(WT_EVICT_PASS_WOULD_BLOCK |
+				    WT_EVICT_PASS_QUOTA)) {
 					F_SET(cache, WT_CACHE_STUCK);
 					WT_STAT_FAST_CONN_INCR(
 					    session, cache_eviction_slow);
@@ -572,7 +859,8 @@ __evict_pass(WT_SESSION_IMPL *session)
 
 /*
  * __evict_clear_walks --
- *	Clear the eviction walk points for any file a session is waiting on.
+ *	Clear the eviction walk points held by this session for any file a
+ *	session is waiting on.
  */
 static int
 __evict_clear_walks(WT_SESSION_IMPL *session)
@@ -597,13 +885,15 @@ __evict_clear_walks(WT_SESSION_IMPL *session)
 
 		session->dhandle = s->dhandle;
 		btree = s->dhandle->handle;
-		if ((ref = btree->evict_ref) != NULL) {
+		if ((ref = btree->evict_ref) != NULL &&
+		    btree->evict_session == session) {
 			/*
 			 * Clear evict_ref first, in case releasing it forces
 			 * eviction (we assert that we never try to evict the
 			 * current eviction walk point).
 			 */
 			btree->evict_ref = NULL;
+			btree->evict_session = NULL;
 			WT_TRET(__wt_page_release(session, ref, 0));
 		}
 		session->dhandle = NULL;
@@ -612,6 +902,43 @@ __evict_clear_walks(WT_SESSION_IMPL *session)
 	return (ret);
 }
 
+/*
+ * __evict_clear_all_walks --
+ *	Clear all of the eviction walk points held by this session.
+ */
+static int
+__evict_clear_all_walks(WT_SESSION_IMPL *session)
+{
+	WT_BTREE *btree;
+	WT_CONNECTION_IMPL *conn;
+	WT_DATA_HANDLE *dhandle;
+	WT_DECL_RET;
+	WT_REF *ref;
+
+	conn = S2C(session);
+
+	__wt_spin_lock(session, &conn->dhandle_lock);
+	SLIST_FOREACH(dhandle, &conn->dhlh, l) {
+		if (!WT_PREFIX_MATCH(dhandle->name, "file:") ||
+		    (btree = dhandle->handle) == NULL ||
+		    btree->evict_session != session ||
+		    (ref = btree->evict_ref) == NULL)
+			continue;
+
+		/*
+		 * We're holding the handle list lock, don't attempt to evict
+		 * the page as it's released.
+		 */
+		btree->evict_ref = NULL;
+		btree->evict_session = NULL;
+		WT_WITH_DHANDLE(session, dhandle,
+		    WT_TRET(__wt_page_release(session, ref, WT_READ_NO_EVICT)));
+	}
+	__wt_spin_unlock(session, &conn->dhandle_lock);
+
+	return (ret);
+}
+
 /*
  * __evict_tree_walk_clear --
  *	Clear the tree's current eviction point, acquiring the eviction lock.
@@ -628,11 +955,17 @@ __evict_tree_walk_clear(WT_SESSION_IMPL *session)
 
 	F_SET(session, WT_SESSION_CLEAR_EVICT_WALK);
 
+	/*
+	 * The walk point is cleared by the thread holding it: the server
+	 * checks for the flag, eviction workers check the waiting count.
+	 */
+	(void)WT_ATOMIC_ADD4(cache->evict_clear_waiting, 1);
 	while (btree->evict_ref != NULL && ret == 0) {
 		F_SET(cache, WT_CACHE_CLEAR_WALKS);
 		ret = __wt_cond_wait(
 		    session, cache->evict_waiter_cond, 100000);
 	}
+	(void)WT_ATOMIC_SUB4(cache->evict_clear_waiting, 1);
 
 	F_CLR(session, WT_SESSION_CLEAR_EVICT_WALK);
 
@@ -688,7 +1021,7 @@ __wt_evict_file_exclusive_on(WT_SESSION_IMPL *session, int *evict_resetp)
 	WT_BTREE *btree;
 	WT_CACHE *cache;
 	WT_EVICT_ENTRY *evict;
-	u_int i, elem;
+	u_int i, elem, q;
 
 	btree = S2BT(session);
 	cache = S2C(session)->cache;
@@ -703,12 +1036,15 @@ __wt_evict_file_exclusive_on(WT_SESSION_IMPL *session, int *evict_resetp)
 	*evict_resetp = 1;
 
 	/*
-	 * Hold the walk lock to set the "no eviction" flag: no new pages from
-	 * the file will be queued for eviction after this point.
+	 * Set the "no eviction" flag and wait for any eviction walk or other
+	 * background walk of the file to finish: they check the flag after
+	 * marking the file busy, so no new pages from the file will be queued
+	 * for eviction or written after this point.
 	 */
-	__wt_spin_lock(session, &cache->evict_walk_lock);
 	F_SET(btree, WT_BTREE_NO_EVICTION);
-	__wt_spin_unlock(session, &cache->evict_walk_lock);
+	WT_FULL_BARRIER();
+	while (btree->evict_walk_busy || btree->walk_busy)
+		__wt_yield();
 
 	/* Clear any existing LRU eviction walk for the file. */
 	WT_RET(__evict_tree_walk_clear(session));
@@ -717,13 +1053,16 @@ __wt_evict_file_exclusive_on(WT_SESSION_IMPL *session, int *evict_resetp)
 	__wt_spin_lock(session, &cache->evict_lock);
 
 	/*
-	 * The eviction candidate list might reference pages from the file,
-	 * clear it.
+	 * The eviction candidate list and queues might reference pages from
+	 * the file, clear them.
 	 */
 	elem = cache->evict_max;
 	for (i = 0, evict = cache->evict; i < elem; i++, evict++)
 		if (evict->btree == btree)
 			__evict_list_clear(session, evict);
+	for (q = 0; q < cache->evict_queue_alloc; ++q)
+		__evict_queue_clear(
+		    session, &cache->evict_queues[q], btree, NULL);
 	__wt_spin_unlock(session, &cache->evict_lock);
 
 	/*
@@ -771,6 +1110,86 @@ __evict_lru_pages(WT_SESSION_IMPL *session, int is_server)
 	return (ret);
 }
 
+/*
+ * __evict_queues_fill --
+ *	Move the best candidates from the LRU list onto the eviction queues,
+ *	called with the LRU list locked.
+ */
+static void
+__evict_queues_fill(WT_SESSION_IMPL *session, uint32_t candidates)
+{
+	WT_CACHE *cache;
+	WT_EVICT_ENTRY *evict, *keep;
+	WT_EVICT_QUEUE *queue;
+	uint32_t i, remaining, slot;
+	u_int group, group_queues, groups, nqueues, q, qi, rank;
+
+	cache = S2C(session)->cache;
+	nqueues = WT_MAX(1, cache->evict_queue_count);
+	groups = cache->numa_nodes == 0 ? 1 : __evict_numa_groups(cache);
+
+	/*
+	 * Deal the candidates out to the queues in turn: every queue gets a
+	 * share of the oldest pages, and each queue stays in LRU order.  If
+	 * the cache is partitioned between NUMA nodes, the candidates from
+	 * each node are dealt out to that node's queues.
+	 */
+	for (q = 0; q < nqueues && (groups > 1 || q < candidates); ++q) {
+		qi = (cache->evict_queue_next + q) % nqueues;
+		group = qi % groups;
+		group_queues = (nqueues - group + groups - 1) / groups;
+		rank = qi / groups;
+
+		queue = &cache->evict_queues[qi];
+		__wt_spin_lock(session, &queue->evict_lock);
+
+		/* Discard entries that have already been taken. */
+		__evict_queue_compact(queue);
+
+		/*
+		 * The page stays marked as being on the LRU queue, it's only
+		 * moving from the list to the queue.
+		 */
+		for (slot = groups > 1 ? 0 : q; slot < candidates &&
+		    queue->evict_candidates < cache->evict_slots;
+		    slot += groups > 1 ? 1 : nqueues) {
+			evict = cache->evict + slot;
+			if (groups > 1 && (evict->ref == NULL ||
+			    evict->ref->page->numa_node % groups != group ||
+			    slot % group_queues != rank))
+				continue;
+			queue->evict_queue[queue->evict_candidates] = *evict;
+			++queue->evict_candidates;
+			evict->ref = NULL;
+			evict->btree = WT_DEBUG_POINT;
+		}
+
+		/*
+		 * The eviction server only tries to evict half of the pages
+		 * before looking for more.
+		 */
+		remaining = queue->evict_candidates;
+		queue->evict_server_stop =
+		    remaining > 1 ? remaining / 2 : remaining;
+
+		__wt_spin_unlock(session, &queue->evict_lock);
+	}
+	cache->evict_queue_next = (cache->evict_queue_next + 1) % nqueues;
+
+	/* Close up the holes left in the list. */
+	for (i = 0, evict = keep = cache->evict;
+	    i < cache->evict_entries; i++, evict++)
+		if (evict->ref != NULL) {
+			if (keep != evict) {
+				*keep = *evict;
+				evict->ref = NULL;
+				evict->btree = WT_DEBUG_POINT;
+			}
+			++keep;
+		}
+	cache->evict_entries = (uint32_t)(keep - cache->evict);
+}
+
 /*
  * __evict_lru_walk --
  *	Add pages to the LRU queue to be evicted from cache.
@@ -786,6 +1205,19 @@ __evict_lru_walk(WT_SESSION_IMPL *session, uint32_t flags)
 
 	cache = S2C(session)->cache;
 
+	/*
+	 * Allocate any eviction queues we're about to use.  Threads taking
+	 * pages from the queues ignore empty queues, so this doesn't need the
+	 * queue lock.
+	 */
+	for (i = cache->evict_queue_alloc; i < cache->evict_queue_count; ++i) {
+		if (cache->evict_queues[i].evict_queue == NULL)
+			WT_RET(__wt_calloc_def(session, cache->evict_slots,
+			    &cache->evict_queues[i].evict_queue));
+		WT_WRITE_BARRIER();
+		cache->evict_queue_alloc = i + 1;
+	}
+
 	/* Get some more pages to consider for eviction. */
 	if ((ret = __evict_walk(session, flags)) != 0)
 		return (ret == EBUSY ? 0 : ret);
@@ -803,25 +1235,30 @@ __evict_lru_walk(WT_SESSION_IMPL *session, uint32_t flags)
 	cache->evict_entries = entries;
 
 	if (entries == 0) {
-		/*
-		 * If there are no entries, there cannot be any candidates.
-		 * Make sure application threads don't read past the end of the
-		 * candidate list, or they may race with the next walk.
-		 */
-		cache->evict_candidates = 0;
-		cache->evict_current = NULL;
 		__wt_spin_unlock(session, &cache->evict_lock);
 		return (0);
 	}
 
 	WT_ASSERT(session, cache->evict[0].ref != NULL);
 
-	if (LF_ISSET(WT_EVICT_PASS_AGGRESSIVE | WT_EVICT_PASS_WOULD_BLOCK))
+	if (LF_ISSET(WT_EVICT_PASS_QUOTA)) {
+		/*
+		 * If we're only limiting files using more than their resident
+		 * maximum, take their pages and any empty pages, which sort
+		 * first, the cache may have plenty of space for the rest.
+		 */
+		for (candidates = 0; candidates < entries; ++candidates)
+			if (__evict_read_gen(&cache->evict[candidates]) !=
+			    WT_READGEN_OLDEST && !__wt_cache_over_quota(
+			    cache->evict[candidates].btree))
+				break;
+	} else if (LF_ISSET(
+	    WT_EVICT_PASS_AGGRESSIVE | WT_EVICT_PASS_WOULD_BLOCK))
 		/*
 		 * Take all candidates if we only gathered pages with an oldest
 		 * read generation set.
 		 */
-		cache->evict_candidates = entries;
+		candidates = entries;
 	else {
 		/* Find the bottom 25% of read generations. */
 		cutoff = (3 * __evict_read_gen(&cache->evict[0]) +
@@ -837,9 +1274,11 @@ __evict_lru_walk(WT_SESSION_IMPL *session, uint32_t flags)
 			if (__evict_read_gen(
 			    &cache->evict[candidates]) > cutoff)
 				break;
-		cache->evict_candidates = candidates;
 	}
 
+	/* Move the candidates onto the eviction queues. */
+	__evict_queues_fill(session, candidates);
+
 	/* If we have more than the minimum number of entries, clear them. */
 	if (cache->evict_entries > WT_EVICT_WALK_BASE) {
 		for (i = WT_EVICT_WALK_BASE, evict = cache->evict + i;
@@ -849,7 +1288,6 @@ __evict_lru_walk(WT_SESSION_IMPL *session, uint32_t flags)
 		cache->evict_entries = WT_EVICT_WALK_BASE;
 	}
 
-	cache->evict_current = cache->evict;
 	__wt_spin_unlock(session, &cache->evict_lock);
 
 	/*
@@ -880,8 +1318,7 @@ __evict_server_work(WT_SESSION_IMPL *session)
 		 * If there are candidates queued, give other threads a chance
 		 * to access them before gathering more.
 		 */
-		if (cache->evict_candidates > 10 &&
-		    cache->evict_current != NULL)
+		if (__evict_queued(cache) > 10)
 			__wt_yield();
 	} else
 		WT_RET_NOTFOUND_OK(__evict_lru_pages(session, 1));
@@ -889,6 +1326,137 @@ __evict_server_work(WT_SESSION_IMPL *session)
 	return (0);
 }
 
+/*
+ * __evict_walk_score --
+ *	Return a file's eviction score: the bytes it has in cache (dirty bytes
+ *	if we're only looking for dirty pages), scaled down if its last walk
+ *	found few pages worth queueing, and scaled by the file's priority.
+ */
+static inline uint64_t
+__evict_walk_score(WT_BTREE *btree, uint32_t flags)
+{
+	uint64_t bytes;
+
+	bytes = LF_ISSET(WT_EVICT_PASS_DIRTY) ?
+	    btree->bytes_dirty : btree->bytes_inmem;
+
+	/* A file yielding nothing scores a quarter of its bytes. */
+	bytes = bytes / 4 + (bytes / 400) * 3 * btree->evict_walk_yield;
+
+	/*
+	 * Files with the highest priority score half as much, files with the
+	 * lowest priority half as much again.
+	 */
+	return ((bytes / 200) * (uint64_t)(200 - btree->cache_priority));
+}
+
+/*
+ * __evict_walk_skip --
+ *	Return if an eviction walk should skip a file.
+ */
+static int
+__evict_walk_skip(
+    WT_SESSION_IMPL *session, WT_BTREE *btree, uint32_t flags, int by_score)
+{
+	WT_CACHE *cache;
+	WT_CONNECTION_IMPL *conn;
+	uint64_t avg, score;
+
+	conn = S2C(session);
+	cache = conn->cache;
+
+	/* Skip files that don't allow eviction. */
+	if (F_ISSET(btree, WT_BTREE_NO_EVICTION))
+		return (1);
+
+	/*
+	 * Also skip files that are checkpointing or configured to stick in
+	 * cache until we get aggressive.
+	 */
+	if ((btree->checkpointing || btree->evict_priority != 0) &&
+	    !LF_ISSET(WT_EVICT_PASS_AGGRESSIVE))
+		return (1);
+
+	/*
+	 * If we're only limiting the files using more than their resident
+	 * maximum, skip the others.
+	 */
+	if (LF_ISSET(WT_EVICT_PASS_QUOTA) && !__wt_cache_over_quota(btree))
+		return (1);
+
+	/* Skip files where another thread holds the walk position. */
+	if (btree->evict_ref != NULL && btree->evict_session != session)
+		return (1);
+
+	/* Skip files if we have used all available hazard pointers. */
+	if (btree->evict_ref == NULL && session->nhazard >=
+	    conn->hazard_max - WT_MIN(conn->hazard_max / 2, 10))
+		return (1);
+
+	/*
+	 * Track a running average of the files' scores, and skip files scoring
+	 * well below average until we get aggressive: when there are many
+	 * files, most of them have little in cache, and walking them finds
+	 * nothing.  The average is a hint, races updating it don't matter.
+	 */
+	score = __evict_walk_score(btree, flags);
+	avg = cache->evict_score_avg;
+	cache->evict_score_avg = avg - avg / 32 + score / 32;
+	if (by_score && score < avg / 4 &&
+	    !LF_ISSET(WT_EVICT_PASS_AGGRESSIVE) &&
+	    !__wt_cache_over_quota(btree)) {
+		WT_STAT_FAST_CONN_INCR(session, cache_eviction_walk_score_skip);
+		return (1);
+	}
+
+	return (0);
+}
+
+/*
+ * __evict_walk_tree --
+ *	Walk a single file for eviction candidates, unless another thread is
+ *	already walking it.
+ */
+static int
+__evict_walk_tree(WT_SESSION_IMPL *session, WT_DATA_HANDLE *dhandle,
+    WT_EVICT_QUEUE *queue, u_int *slotp, uint32_t flags)
+{
+	WT_BTREE *btree;
+	WT_DECL_RET;
+	u_int prev_slot;
+
+	btree = dhandle->handle;
+	prev_slot = *slotp;
+
+	if (!WT_ATOMIC_CAS4(btree->evict_walk_busy, 0, 1))
+		return (0);
+
+	/*
+	 * Re-check the "no eviction" flag -- it is used to enforce exclusive
+	 * access when a handle is being closed -- and the walk position, it
+	 * may have been taken by another thread.
+	 */
+	if (F_ISSET(btree, WT_BTREE_NO_EVICTION) ||
+	    (btree->evict_ref != NULL && btree->evict_session != session))
+		goto done;
+
+	WT_WITH_DHANDLE(session, dhandle,
+	    ret = __evict_walk_file(session, queue, slotp, flags));
+	WT_ASSERT(session, session->split_gen == 0);
+
+	/*
+	 * If we didn't find any candidates in the file, skip it next time.
+	 */
+	if (*slotp == prev_slot)
+		btree->evict_walk_period = WT_MIN(
+		    WT_MAX(1, 2 * btree->evict_walk_period), 100);
+	else
+		btree->evict_walk_period = 0;
+
+done:	WT_PUBLISH(btree->evict_walk_busy, 0);
+	return (ret);
+}
+
 /*
  * __evict_walk --
  *	Fill in the array by walking the next set of pages.
@@ -901,7 +1469,7 @@ __evict_walk(WT_SESSION_IMPL *session, uint32_t flags)
 	WT_CONNECTION_IMPL *conn;
 	WT_DATA_HANDLE *dhandle;
 	WT_DECL_RET;
-	u_int max_entries, prev_slot, retries, slot, start_slot, spins;
+	u_int max_entries, retries, slot, start_slot, spins;
 	int incr, dhandle_locked;
 	WT_DECL_SPINLOCK_ID(id);
 
@@ -922,7 +1490,7 @@ __evict_walk(WT_SESSION_IMPL *session, uint32_t flags)
 	 */
 	__wt_txn_update_oldest(session);
 
-	if (cache->evict_current == NULL)
+	if (__evict_queued(cache) == 0)
 		WT_STAT_FAST_CONN_INCR(session, cache_eviction_queue_empty);
 	else
 		WT_STAT_FAST_CONN_INCR(session, cache_eviction_queue_not_empty);
@@ -990,22 +1558,12 @@ retry:	while (slot < max_entries && ret == 0) {
 			continue;
 		cache->evict_file_next = NULL;
 
-		/* Skip files that don't allow eviction. */
-		btree = dhandle->handle;
-		if (F_ISSET(btree, WT_BTREE_NO_EVICTION))
-			continue;
-
 		/*
-		 * Also skip files that are checkpointing or configured to
-		 * stick in cache until we get aggressive.
+		 * Skip files that can't or shouldn't be walked, and on the
+		 * first pass through the files, files with a low score.
 		 */
-		if ((btree->checkpointing || btree->evict_priority != 0) &&
-		    !LF_ISSET(WT_EVICT_PASS_AGGRESSIVE))
-			continue;
-
-		/* Skip files if we have used all available hazard pointers. */
-		if (btree->evict_ref == NULL && session->nhazard >=
-		    conn->hazard_max - WT_MIN(conn->hazard_max / 2, 10))
+		btree = dhandle->handle;
+		if (__evict_walk_skip(session, btree, flags, retries == 0))
 			continue;
 
 		/*
@@ -1017,36 +1575,13 @@ retry:	while (slot < max_entries && ret == 0) {
 		    btree->evict_walk_skips++ < btree->evict_walk_period)
 			continue;
 		btree->evict_walk_skips = 0;
-		prev_slot = slot;
 
 		(void)WT_ATOMIC_ADD4(dhandle->session_inuse, 1);
 		incr = 1;
 		__wt_spin_unlock(session, &conn->dhandle_lock);
 		dhandle_locked = 0;
 
-		__wt_spin_lock(session, &cache->evict_walk_lock);
-
-		/*
-		 * Re-check the "no eviction" flag -- it is used to enforce
-		 * exclusive access when a handle is being closed.
-		 */
-		if (!F_ISSET(btree, WT_BTREE_NO_EVICTION)) {
-			WT_WITH_DHANDLE(session, dhandle,
-			    ret = __evict_walk_file(session, &slot, flags));
-			WT_ASSERT(session, session->split_gen == 0);
-		}
-
-		__wt_spin_unlock(session, &cache->evict_walk_lock);
-
-		/*
-		 * If we didn't find any candidates in the file, skip it next
-		 * time.
-		 */
-		if (slot == prev_slot)
-			btree->evict_walk_period = WT_MIN(
-			    WT_MAX(1, 2 * btree->evict_walk_period), 100);
-		else
-			btree->evict_walk_period = 0;
+		ret = __evict_walk_tree(session, dhandle, NULL, &slot, flags);
 	}
 
 	if (incr) {
@@ -1082,6 +1617,154 @@ retry:	while (slot < max_entries && ret == 0) {
 	return (ret);
 }
 
+/*
+ * __evict_worker_walk --
+ *	Walk files for an eviction worker, adding the candidates found to the
+ *	worker's queue.
+ */
+static int
+__evict_worker_walk(
+    WT_SESSION_IMPL *session, WT_EVICT_WORKER *worker, u_int *queuedp)
+{
+	WT_CACHE *cache;
+	WT_CONNECTION_IMPL *conn;
+	WT_DATA_HANDLE *dhandle;
+	WT_DECL_RET;
+	WT_EVICT_QUEUE *queue;
+	uint32_t flags, remaining;
+	u_int queued;
+	int dhandle_locked, incr, restarted;
+	WT_DECL_SPINLOCK_ID(id);
+
+	*queuedp = 0;
+
+	conn = S2C(session);
+	cache = conn->cache;
+	dhandle = NULL;
+	dhandle_locked = incr = restarted = 0;
+	queued = 0;
+
+	/*
+	 * Only walk if the cache needs space and the server has set up the
+	 * queues.  Workers fill a queue after the server's, the server uses
+	 * the first.
+	 */
+	WT_RET(__evict_has_work(session, &flags));
+	if (!LF_ISSET(WT_EVICT_PASS_ALL | WT_EVICT_PASS_DIRTY) ||
+	    cache->evict_queue_alloc == 0)
+		return (0);
+	queue = &cache->evict_queues[
+	    (worker->id + 1) % cache->evict_queue_alloc];
+
+	WT_STAT_FAST_CONN_INCR(session, cache_eviction_worker_walk);
+
+	while (queued < WT_EVICT_WALK_INCR && ret == 0 &&
+	    cache->evict_clear_waiting == 0 &&
+	    F_ISSET(worker, WT_EVICT_WORKER_RUN)) {
+		/*
+		 * Lock the dhandle list to find the next handle and bump its
+		 * reference count to keep it alive while we sweep.  If the
+		 * list is busy, give up, the server is walking it.
+		 */
+		if (!dhandle_locked) {
+			if ((ret = __wt_spin_trylock(
+			    session, &conn->dhandle_lock, &id)) != 0)
+				break;
+			dhandle_locked = 1;
+		}
+
+		if (dhandle == NULL)
+			dhandle = SLIST_FIRST(&conn->dhlh);
+		else {
+			if (incr) {
+				WT_ASSERT(session, dhandle->session_inuse > 0);
+				(void)WT_ATOMIC_SUB4(dhandle->session_inuse, 1);
+				incr = 0;
+			}
+			dhandle = SLIST_NEXT(dhandle, l);
+		}
+
+		/*
+		 * If we reach the end of the list, we're done, unless we were
+		 * looking for the last file walked and it has been closed:
+		 * start again from the beginning of the list.
+		 */
+		if (dhandle == NULL) {
+			if (worker->walk_last == NULL || restarted)
+				break;
+			__wt_free(session, worker->walk_last);
+			restarted = 1;
+			continue;
+		}
+
+		/* Ignore non-file handles, or handles that aren't open. */
+		if (!WT_PREFIX_MATCH(dhandle->name, "file:") ||
+		    !F_ISSET(dhandle, WT_DHANDLE_OPEN))
+			continue;
+
+		/*
+		 * Start each walk at the handle after the last one walked.
+		 * Handles can be closed and freed between walks, so the last
+		 * file walked is remembered by name, not by its handle.
+		 */
+		if (worker->walk_last != NULL) {
+			if (strcmp(worker->walk_last, dhandle->name) == 0)
+				__wt_free(session, worker->walk_last);
+			continue;
+		}
+
+		if (__evict_walk_skip(session, dhandle->handle, flags, 1))
+			continue;
+
+		(void)WT_ATOMIC_ADD4(dhandle->session_inuse, 1);
+		incr = 1;
+		__wt_spin_unlock(session, &conn->dhandle_lock);
+		dhandle_locked = 0;
+
+		worker->walk_held = 1;
+		ret = __evict_walk_tree(
+		    session, dhandle, queue, &queued, flags);
+	}
+
+	/*
+	 * Remember the last file we walked, the next walk starts at the file
+	 * after it.  If we reached the end of the list, the next walk starts
+	 * at the beginning; if we gave up before finding a file, it starts
+	 * where this one would have.
+	 */
+	if (dhandle != NULL) {
+		if (worker->walk_last == NULL ||
+		    strcmp(worker->walk_last, dhandle->name) != 0) {
+			__wt_free(session, worker->walk_last);
+			WT_TRET(__wt_strdup(
+			    session, dhandle->name, &worker->walk_last));
+		}
+	} else if (ret != EBUSY)
+		__wt_free(session, worker->walk_last);
+	if (ret == EBUSY)
+		ret = 0;
+
+	if (incr) {
+		WT_ASSERT(session, dhandle->session_inuse > 0);
+		(void)WT_ATOMIC_SUB4(dhandle->session_inuse, 1);
+	}
+	if (dhandle_locked)
+		__wt_spin_unlock(session, &conn->dhandle_lock);
+
+	/* Sort the candidates we haven't evicted yet into LRU order. */
+	if (queued != 0) {
+		__wt_spin_lock(session, &queue->evict_lock);
+		remaining = queue->evict_candidates - queue->evict_current;
+		if (remaining > 1)
+			qsort(queue->evict_queue + queue->evict_current,
+			    remaining, sizeof(WT_EVICT_ENTRY), __evict_lru_cmp);
+		__wt_spin_unlock(session, &queue->evict_lock);
+	}
+
+	*queuedp = queued;
+	return (ret);
+}
+
 /*
  * __evict_init_candidate --
  *	Initialize a WT_EVICT_ENTRY structure with a given page.
@@ -1104,6 +1787,7 @@ __evict_init_candidate(
 		__evict_list_clear(session, evict);
 	evict->ref = ref;
 	evict->btree = S2BT(session);
+	evict->protect = cache->evict_policy == EVICT_POLICY_2Q;
 
 	/* Mark the page on the list */
 	F_SET_ATOMIC(ref->page, WT_PAGE_EVICT_LRU);
@@ -1111,27 +1795,31 @@ __evict_init_candidate(
 
 /*
  * __evict_walk_file --
- *	Get a few page eviction candidates from a single underlying file.
+ *	Get a few page eviction candidates from a single underlying file,
+ *	adding them to the LRU list, or if a queue is specified, directly to
+ *	an eviction queue.
  */
 static int
-__evict_walk_file(WT_SESSION_IMPL *session, u_int *slotp, uint32_t flags)
+__evict_walk_file(WT_SESSION_IMPL *session,
+    WT_EVICT_QUEUE *queue, u_int *slotp, uint32_t flags)
 {
 	WT_BTREE *btree;
 	WT_CACHE *cache;
 	WT_DECL_RET;
-	WT_EVICT_ENTRY *end, *evict, *start;
+	WT_EVICT_ENTRY *evict;
 	WT_PAGE *page;
 	WT_PAGE_MODIFY *mod;
 	WT_REF *ref;
 	uint64_t pages_walked;
 	uint32_t walk_flags;
+	u_int queued, queued_max;
 	int enough, internal_pages, modified, restarts;
 
 	btree = S2BT(session);
 	cache = S2C(session)->cache;
-	start = cache->evict + *slotp;
-	end = WT_MIN(start + WT_EVICT_WALK_PER_FILE,
-	    cache->evict + cache->evict_slots);
+	evict = cache->evict + *slotp;
+	queued_max = queue == NULL ? WT_MIN(WT_EVICT_WALK_PER_FILE,
+	    cache->evict_slots - *slotp) : WT_EVICT_WALK_PER_FILE;
 	enough = internal_pages = restarts = 0;
 
 	walk_flags = WT_READ_CACHE | WT_READ_NO_EVICT |
@@ -1140,6 +1828,12 @@ __evict_walk_file(WT_SESSION_IMPL *session, u_int *slotp, uint32_t flags)
 	if (F_ISSET(cache, WT_CACHE_WALK_REVERSE))
 		walk_flags |= WT_READ_PREV;
 
+	/*
+	 * The walk position is held by this session: only this session can
+	 * release it.
+	 */
+	btree->evict_session = session;
+
 	/*
 	 * Get some more eviction candidate pages.
 	 *
@@ -1152,8 +1846,9 @@ __evict_walk_file(WT_SESSION_IMPL *session, u_int *slotp, uint32_t flags)
 	 * Once we hit the page limit, do one more step through the walk in
 	 * case we are appending and only the last page in the file is live.
 	 */
-	for (evict = start, pages_walked = 0;
-	    evict < end && !enough && (ret == 0 || ret == WT_NOTFOUND);
+	for (queued = 0, pages_walked = 0;
+	    queued < queued_max && !enough &&
+	    (ret == 0 || ret == WT_NOTFOUND);
 	    ret = __wt_tree_walk(
 	    session, &btree->evict_ref, &pages_walked, walk_flags)) {
 		enough = (pages_walked > WT_EVICT_MAX_PER_FILE);
@@ -1181,9 +1876,15 @@ __evict_walk_file(WT_SESSION_IMPL *session, u_int *slotp, uint32_t flags)
 		if (__wt_page_is_empty(page))
 			goto fast;
 
-		/* Optionally ignore clean pages. */
+		/*
+		 * Optionally ignore clean pages, or dirty pages if write-back
+		 * threads are cleaning them.
+		 */
 		if (!modified && LF_ISSET(WT_EVICT_PASS_DIRTY))
 			continue;
+		if (modified && LF_ISSET(WT_EVICT_PASS_CLEAN) &&
+		    !LF_ISSET(WT_EVICT_PASS_AGGRESSIVE))
+			continue;
 
 		/*
 		 * If we are only trickling out pages marked for definite
@@ -1193,12 +1894,25 @@ __evict_walk_file(WT_SESSION_IMPL *session, u_int *slotp, uint32_t flags)
 		    page->read_gen != WT_READGEN_OLDEST)
 			continue;
 
-		/* Limit internal pages to 50% unless we get aggressive. */
-		if (WT_PAGE_IS_INTERNAL(page) &&
-		    ++internal_pages > WT_EVICT_WALK_PER_FILE / 2 &&
-		    !LF_ISSET(WT_EVICT_PASS_AGGRESSIVE))
+		/* Keep eviction local to NUMA nodes. */
+		if (cache->numa_nodes != 0 &&
+		    __evict_numa_skip(session, queue, page, flags))
 			continue;
 
+		/*
+		 * Internal pages can't be evicted until all of their children
+		 * have been evicted, skip internal pages unless they head cold
+		 * subtrees.  Limit internal pages to 50% unless we get
+		 * aggressive.
+		 */
+		if (WT_PAGE_IS_INTERNAL(page)) {
+			if (!__evict_intl_cold(session, page))
+				continue;
+			if (++internal_pages > WT_EVICT_WALK_PER_FILE / 2 &&
+			    !LF_ISSET(WT_EVICT_PASS_AGGRESSIVE))
+				continue;
+		}
+
 		/*
 		 * If this page has never been considered for eviction,
 		 * set its read generation to a little bit in the
@@ -1210,6 +1924,30 @@ __evict_walk_file(WT_SESSION_IMPL *session, u_int *slotp, uint32_t flags)
 			continue;
 		}
 
+		/*
+		 * With the clock policy, the walk is the clock's hand: pages
+		 * accessed since the walk last passed get a second chance
+		 * unless we're aggressive.  With the LRU policy, clear any
+		 * access count left behind by a previously configured policy.
+		 */
+		switch (cache->evict_policy) {
+		case EVICT_POLICY_CLOCK:
+			if (page->access_count != 0 &&
+			    !LF_ISSET(WT_EVICT_PASS_AGGRESSIVE)) {
+				--page->access_count;
+				WT_STAT_FAST_CONN_INCR(
+				    session, cache_eviction_second_chance);
+				continue;
+			}
+			break;
+		case EVICT_POLICY_LRU:
+			if (page->access_count != 0)
+				page->access_count = 0;
+			break;
+		case EVICT_POLICY_2Q:
+			break;
+		}
+
 fast:		/* If the page can't be evicted, give up. */
 		if (!__wt_page_can_evict(session, page, 1))
 			continue;
@@ -1246,9 +1984,13 @@ fast:		/* If the page can't be evicted, give up. */
 		    !__wt_txn_visible_all(session, mod->update_txn)))
 			continue;
 
-		WT_ASSERT(session, evict->ref == NULL);
-		__evict_init_candidate(session, evict, ref);
-		++evict;
+		if (queue == NULL) {
+			WT_ASSERT(session, evict->ref == NULL);
+			__evict_init_candidate(session, evict, ref);
+			++evict;
+		} else if (!__evict_queue_push(session, queue, ref))
+			break;
+		++queued;
 
 		WT_RET(__wt_verbose(session, WT_VERB_EVICTSERVER,
 		    "select: %p, size %" PRIu64, page, page->memory_footprint));
@@ -1267,66 +2009,52 @@ fast:		/* If the page can't be evicted, give up. */
 		btree->evict_ref = NULL;
 		__wt_page_release(session, ref, 0);
 	}
+	if (btree->evict_ref == NULL)
+		btree->evict_session = NULL;
 
 	/* If the walk was interrupted by a locked page, that's okay. */
 	if (ret == WT_NOTFOUND)
 		ret = 0;
 
-	*slotp += (u_int)(evict - start);
+	/* Remember how productive the walk was, for the file's score. */
+	btree->evict_walk_yield = pages_walked == 0 ?
+	    0 : (u_int)((queued * 100) / pages_walked);
+
+	*slotp += queued;
 	WT_STAT_FAST_CONN_INCRV(session, cache_eviction_walk, pages_walked);
+	WT_STAT_FAST_DATA_INCR(session, cache_eviction_walk_passes);
+	WT_STAT_FAST_DATA_INCRV(session, cache_eviction_walk, pages_walked);
+	WT_STAT_FAST_DATA_INCRV(session, cache_eviction_walk_queued, queued);
 	return (ret);
 }
 
 /*
- * __evict_get_ref --
- *	Get a page for eviction.
+ * __evict_queue_pop --
+ *	Get the next page from an eviction queue, called with the queue locked.
  */
-static int
-__evict_get_ref(
-    WT_SESSION_IMPL *session, int is_server, WT_BTREE **btreep, WT_REF **refp)
+static void
+__evict_queue_pop(WT_SESSION_IMPL *session,
+    WT_EVICT_QUEUE *queue, int is_server, WT_BTREE **btreep, WT_REF **refp)
 {
-	WT_CACHE *cache;
 	WT_EVICT_ENTRY *evict;
 	uint32_t candidates;
-	WT_DECL_SPINLOCK_ID(id);			/* Must appear last */
-
-	cache = S2C(session)->cache;
-	*btreep = NULL;
-	*refp = NULL;
 
-	/*
-	 * Avoid the LRU lock if no pages are available.  If there are pages
-	 * available, spin until we get the lock.  If this function returns
-	 * without getting a page to evict, application threads assume there
-	 * are no more pages available and will attempt to wake the eviction
-	 * server.
-	 */
-	for (;;) {
-		if (cache->evict_current == NULL)
-			return (WT_NOTFOUND);
-		if (__wt_spin_trylock(session, &cache->evict_lock, &id) == 0)
-			break;
-		__wt_yield();
-	}
-
-	/*
-	 * The eviction server only tries to evict half of the pages before
-	 * looking for more.
-	 */
-	candidates = cache->evict_candidates;
-	if (is_server && candidates > 1)
-		candidates /= 2;
+	candidates = is_server ?
+	    queue->evict_server_stop : queue->evict_candidates;
 
 	/* Get the next page queued for eviction. */
-	while ((evict = cache->evict_current) != NULL &&
-	    evict < cache->evict + candidates && evict->ref != NULL) {
-		WT_ASSERT(session, evict->btree != NULL);
+	while (queue->evict_current < candidates) {
+		evict = queue->evict_queue + queue->evict_current;
 
 		/* Move to the next item. */
-		++cache->evict_current;
+		++queue->evict_current;
+
+		if (evict->ref == NULL)
+			continue;
+		WT_ASSERT(session, evict->btree != NULL);
 
 		/*
-		 * Lock the page while holding the eviction mutex to prevent
+		 * Lock the page while holding the queue lock to prevent
 		 * multiple attempts to evict it.  For pages that are already
 		 * being evicted, this operation will fail and we will move on.
 		 */
@@ -1353,12 +2081,91 @@ __evict_get_ref(
 		break;
 	}
 
-	/* Clear the current pointer if there are no more candidates. */
-	if (evict >= cache->evict + cache->evict_candidates)
-		cache->evict_current = NULL;
-	__wt_spin_unlock(session, &cache->evict_lock);
+	/* Reset the queue if there are no more candidates. */
+	if (queue->evict_current >= queue->evict_candidates) {
+		queue->evict_candidates = 0;
+		queue->evict_current = 0;
+		queue->evict_server_stop = 0;
+	}
+}
+
+/*
+ * __evict_get_ref --
+ *	Get a page for eviction.
+ */
+static int
+__evict_get_ref(
+    WT_SESSION_IMPL *session, int is_server, WT_BTREE **btreep, WT_REF **refp)
+{
+	WT_CACHE *cache;
+	WT_EVICT_QUEUE *queue;
+	uint32_t candidates;
+	u_int busy, group, groups, i, nqueues, pass, passes, q, start;
+	WT_DECL_SPINLOCK_ID(id);			/* Must appear last */
+
+	cache = S2C(session)->cache;
+	*btreep = NULL;
+	*refp = NULL;
+
+	/*
+	 * Start with the session's own queue, then try the others.  Avoid the
+	 * queue locks if no pages are available, and if another thread holds
+	 * a queue's lock, move on to the next queue rather than waiting.  If
+	 * there are pages available but all of the queues holding them were
+	 * busy, yield and try again: if this function returns without getting
+	 * a page to evict, application threads assume there are no more pages
+	 * available and will attempt to wake the eviction server.
+	 *
+	 * If the cache is partitioned between NUMA nodes, start with the
+	 * queues holding pages from the session's node, then try the others.
+	 */
+	start = session->id % WT_MAX(1, cache->evict_queue_count);
+	group = 0;
+	groups = cache->numa_nodes == 0 ? 1 : __evict_numa_groups(cache);
+	passes = 1;
+	if (groups > 1) {
+		group = __wt_numa_node(session) % groups;
+		passes = 2;
+	}
+	do {
+		nqueues = cache->evict_queue_alloc;
+		for (busy = i = 0; i < passes * nqueues; ++i) {
+			q = (start + i) % nqueues;
+			pass = i / nqueues;
+			if (groups > 1 && (q % groups == group) != (pass == 0))
+				continue;
+			queue = &cache->evict_queues[q];
+			candidates = is_server ?
+			    queue->evict_server_stop : queue->evict_candidates;
+			if (queue->evict_current >= candidates)
+				continue;
+			if (__wt_spin_trylock(
+			    session, &queue->evict_lock, &id) != 0) {
+				WT_STAT_FAST_CONN_INCR(
+				    session, cache_eviction_queue_busy);
+				++busy;
+				continue;
+			}
+			__evict_queue_pop(
+			    session, queue, is_server, btreep, refp);
+			__wt_spin_unlock(session, &queue->evict_lock);
+
+			if (*refp == NULL)
+				continue;
+			if (i != 0)
+				WT_STAT_FAST_CONN_INCR(
+				    session, cache_eviction_queue_other);
+			if (pass != 0)
+				WT_STAT_FAST_CONN_INCR(
+				    session, cache_eviction_numa_remote);
+			return (0);
+		}
+		if (busy != 0)
+			__wt_yield();
+	} while (busy != 0);
 
-	return ((*refp == NULL) ? WT_NOTFOUND : 0);
+	WT_STAT_FAST_CONN_INCR(session, cache_eviction_queue_stall);
+	return (WT_NOTFOUND);
 }
 
 /*
@@ -1418,16 +2225,19 @@ __wt_evict_lru_page(WT_SESSION_IMPL *session, int is_server)
 }
 
 /*
- * __wt_cache_wait --
+ * __cache_wait --
  *	Wait for space in the cache.
  */
-int
-__wt_cache_wait(WT_SESSION_IMPL *session, int full)
+static int
+__cache_wait(WT_SESSION_IMPL *session, int full)
 {
+	struct timespec now, start;
 	WT_CACHE *cache;
 	WT_DECL_RET;
 	WT_TXN_GLOBAL *txn_global;
 	WT_TXN_STATE *txn_state;
+	uint64_t elapsed, wait_max;
+	u_int pages_max;
 	int busy, count;
 
 	cache = S2C(session)->cache;
@@ -1449,7 +2259,34 @@ __wt_cache_wait(WT_SESSION_IMPL *session, int full)
 		return (0);
 	count = busy ? 1 : 10;
 
-	for (;;) {
+	/*
+	 * Bound the work done for a single operation by the session's eviction
+	 * budget, or failing that, the connection's.
+	 */
+	pages_max = session->evict_pages_max != 0 ?
+	    session->evict_pages_max : cache->app_pages_max;
+	if (pages_max != 0 && count > (int)pages_max)
+		count = (int)pages_max;
+	wait_max = session->evict_wait_max != 0 ?
+	    session->evict_wait_max : cache->app_wait_max;
+	if (wait_max != 0)
+		WT_RET(__wt_epoch(session, &start));
+
+	for (elapsed = 0;; ) {
+		/*
+		 * Give up once the budget is spent: the operation proceeds
+		 * even though the cache is full.
+		 */
+		if (wait_max != 0) {
+			WT_RET(__wt_epoch(session, &now));
+			elapsed = WT_TIMEDIFF(now, start) / 1000;
+			if (elapsed >= wait_max) {
+				WT_STAT_FAST_CONN_INCR(
+				    session, cache_eviction_app_budget);
+				return (0);
+			}
+		}
+
 		/*
 		 * A pathological case: if we're the oldest transaction in the
 		 * system and the eviction server is stuck trying to find space,
@@ -1497,7 +2334,8 @@ __wt_cache_wait(WT_SESSION_IMPL *session, int full)
 
 		/* Wait for the queue to re-populate before trying again. */
 		WT_RET(__wt_cond_wait(session,
-		    S2C(session)->cache->evict_waiter_cond, 100000));
+		    S2C(session)->cache->evict_waiter_cond, wait_max == 0 ?
+		    100000 : WT_MIN(100000, wait_max - elapsed)));
 
 		/* Check if things have changed so that we are busy. */
 		if (!busy && txn_state->snap_min != WT_TXN_NONE &&
@@ -1505,6 +2343,99 @@ __wt_cache_wait(WT_SESSION_IMPL *session, int full)
 			busy = count = 1;
 	}
 }
+
+/*
+ * __wt_cache_wait --
+ *	Wait for space in the cache, tracking the time application threads
+ *	spend evicting for the shared cache.
+ */
+int
+__wt_cache_wait(WT_SESSION_IMPL *session, int full)
+{
+	struct timespec start, stop;
+	WT_DECL_RET;
+
+	if (!F_ISSET(S2C(session), WT_CONN_CACHE_POOL))
+		return (__cache_wait(session, full));
+
+	WT_RET(__wt_epoch(session, &start));
+	ret = __cache_wait(session, full);
+	WT_TRET(__wt_epoch(session, &stop));
+	(void)WT_ATOMIC_ADD8(S2C(session)->cache->app_evict_time,
+	    WT_TIMEDIFF(stop, start) / 1000);
+	return (ret);
+}
+
+/*
+ * __wt_cache_write_throttle --
+ *	Take tokens for a write from the write throttle's bucket, waiting for
+ *	eviction to clean dirty pages if the bucket is empty.
+ */
+int
+__wt_cache_write_throttle(WT_SESSION_IMPL *session, size_t size)
+{
+	struct timespec now, start;
+	WT_CACHE *cache;
+	WT_CONNECTION_IMPL *conn;
+	int64_t tokens, tokens_max;
+	uint64_t dirty_target, elapsed, wait_max;
+
+	conn = S2C(session);
+	cache = conn->cache;
+
+	/*
+	 * Writers are only throttled once the cache has more dirty bytes than
+	 * the dirty target, until then keep the bucket full.  The bucket holds
+	 * half of the gap between the dirty target and the dirty trigger: a
+	 * burst of writes can dirty that much more of the cache before writers
+	 * have to wait for eviction, so application threads don't normally
+	 * reach the dirty trigger and have to evict dirty pages themselves.
+	 */
+	dirty_target = (cache->eviction_dirty_target * conn->cache_size) / 100;
+	tokens_max = (int64_t)(((cache->eviction_dirty_trigger -
+	    cache->eviction_dirty_target) * conn->cache_size) / 200);
+	if (__wt_cache_dirty_inuse(cache) <= dirty_target) {
+		if (cache->throttle_tokens != tokens_max)
+			cache->throttle_tokens = tokens_max;
+		return (0);
+	}
+
+	size += sizeof(WT_UPDATE);
+	tokens = WT_ATOMIC_SUB8(cache->throttle_tokens, (int64_t)size);
+	if (tokens > tokens_max)
+		cache->throttle_tokens = tokens_max;
+	if (tokens >= 0)
+		return (0);
+
+	/*
+	 * The bucket is empty: wait for eviction to clean pages, unless this
+	 * transaction has an ID, which would keep eviction from making
+	 * progress.  Don't wait longer than the session's eviction budget, or
+	 * failing that, the time the cache wait would sleep before retrying.
+	 */
+	if (F_ISSET(&session->txn, TXN_HAS_ID))
+		return (0);
+	wait_max = session->evict_wait_max != 0 ?
+	    session->evict_wait_max : cache->app_wait_max;
+	if (wait_max == 0)
+		wait_max = 100000;
+
+	WT_STAT_FAST_CONN_INCR(session, cache_write_throttle);
+	WT_RET(__wt_evict_server_wake(session));
+	WT_RET(__wt_epoch(session, &start));
+	for (elapsed = 0; elapsed < wait_max;) {
+		__wt_sleep(0, WT_MIN(1000, wait_max - elapsed));
+		WT_RET(__wt_epoch(session, &now));
+		elapsed = WT_TIMEDIFF(now, start) / 1000;
+		if (cache->throttle_tokens >= 0 ||
+		    __wt_cache_dirty_inuse(cache) <= dirty_target)
+			break;
+	}
+	WT_STAT_FAST_CONN_INCRV(session, cache_write_throttle_time, elapsed);
+
+	return (0);
+}
+
 #ifdef HAVE_DIAGNOSTIC
 /*
  * __wt_cache_dump --
@@ -9,7 +9,7 @@
 #include "wt_internal.h"
 
 static int  __evict_page_dirty_update(WT_SESSION_IMPL *, WT_REF *, int);
-static int  __evict_review(WT_SESSION_IMPL *, WT_REF *, int, int *);
+static int  __evict_review(WT_SESSION_IMPL *, WT_REF *, int, int *, int *);
 
 /*
  * __evict_exclusive_clear --
@@ -55,13 +55,13 @@ __wt_evict(WT_SESSION_IMPL *session, WT_REF *ref, int exclusive)
 	WT_DECL_RET;
 	WT_PAGE *page;
 	WT_PAGE_MODIFY *mod;
-	int forced_eviction, inmem_split;
+	int forced_eviction, inmem_split, lookaside;
 
 	conn = S2C(session);
 
 	page = ref->page;
 	forced_eviction = (page->read_gen == WT_READGEN_OLDEST);
-	inmem_split = 0;
+	inmem_split = lookaside = 0;
 
 	WT_RET(__wt_verbose(session, WT_VERB_EVICT,
 	    "page %p (%s)", page, __wt_page_type_string(page->type)));
@@ -73,7 +73,8 @@ __wt_evict(WT_SESSION_IMPL *session, WT_REF *ref, int exclusive)
 	 * to make this check for clean pages, too: while unlikely eviction
 	 * would choose an internal page with children, it's not disallowed.
 	 */
-	WT_ERR(__evict_review(session, ref, exclusive, &inmem_split));
+	WT_ERR(__evict_review(
+	    session, ref, exclusive, &inmem_split, &lookaside));
 
 	/*
 	 * If there was an in-memory split, the tree has been left in the state
@@ -123,7 +124,15 @@ __wt_evict(WT_SESSION_IMPL *session, WT_REF *ref, int exclusive)
 	}
 
 	if (0) {
-err:		if (!exclusive)
+err:		/*
+		 * If updates were moved to the lookaside table, the blocks we
+		 * wrote hold updates that aren't globally visible: the page
+		 * stays in memory, mark it dirty so checkpoints don't use the
+		 * blocks.
+		 */
+		if (lookaside)
+			__wt_page_modify_set(session, page);
+		if (!exclusive)
 			__evict_exclusive_clear(session, ref);
 
 		WT_STAT_FAST_CONN_INCR(session, cache_eviction_fail);
@@ -270,8 +279,8 @@ __evict_child_check(WT_SESSION_IMPL *session, WT_REF *parent)
  *	for conditions that would block its eviction.
  */
 static int
-__evict_review(
-    WT_SESSION_IMPL *session, WT_REF *ref, int exclusive, int *inmem_splitp)
+__evict_review(WT_SESSION_IMPL *session,
+    WT_REF *ref, int exclusive, int *inmem_splitp, int *lookasidep)
 {
 	WT_DECL_RET;
 	WT_PAGE *page;
@@ -349,27 +358,53 @@ __evict_review(
 	 *
 	 * Don't set the update-restore flag for internal pages, they don't have
 	 * updates that can be saved and restored.
+	 *
+	 * Otherwise, if eviction is stuck, set the lookaside flag: the newest
+	 * committed updates are written and older updates still needed by
+	 * running transactions are moved into the lookaside table, so the page
+	 * can be discarded.
 	 */
 	flags = WT_EVICTING;
+
+	/*
+	 * A clean page written while its updates were still needed by running
+	 * transactions keeps those updates in memory: if evicting using the
+	 * lookaside table, mark it dirty so reconciliation moves them into the
+	 * table.
+	 */
+	if (!exclusive && mod != NULL && !__wt_page_is_modified(page) &&
+	    !__wt_txn_visible_all(session, mod->rec_max_txn) &&
+	    __wt_cache_lookaside(session, page))
+		__wt_page_modify_set(session, page);
+
 	if (__wt_page_is_modified(page)) {
 		if (exclusive)
 			LF_SET(WT_SKIP_UPDATE_ERR);
 		else if (!WT_PAGE_IS_INTERNAL(page) &&
 		    page->read_gen == WT_READGEN_OLDEST)
 			LF_SET(WT_SKIP_UPDATE_RESTORE);
+		else if (__wt_cache_lookaside(session, page))
+			LF_SET(WT_SKIP_UPDATE_LOOKASIDE);
 		WT_RET(__wt_reconcile(session, ref, NULL, flags));
 		WT_ASSERT(session,
 		    !__wt_page_is_modified(page) ||
 		    LF_ISSET(WT_SKIP_UPDATE_RESTORE));
+		if (LF_ISSET(WT_SKIP_UPDATE_LOOKASIDE)) {
+			*lookasidep = 1;
+			WT_STAT_FAST_CONN_INCR(
+			    session, cache_eviction_lookaside);
+		}
 	}
 
 	/*
 	 * If the page was ever modified, make sure all of the updates
 	 * on the page are old enough they can be discarded from cache.
+	 * Updates that aren't were moved to the lookaside table if the
+	 * lookaside flag was set.
 	 */
 	if (!exclusive && mod != NULL &&
 	    !__wt_txn_visible_all(session, mod->rec_max_txn) &&
-	    !LF_ISSET(WT_SKIP_UPDATE_RESTORE))
+	    !LF_ISSET(WT_SKIP_UPDATE_RESTORE | WT_SKIP_UPDATE_LOOKASIDE))
 		return (EBUSY);
 
 	return (0);
@@ -0,0 +1,398 @@
+/*-
+ * Copyright (c) 2014-2015 MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * Write-back threads write dirty leaf pages in the background when the cache
+ * has more dirty bytes than the eviction dirty target.  The pages stay in the
+ * cache, but once written they are clean, so eviction can discard them
+ * without waiting on reconciliation.  While the write-back threads keep up,
+ * eviction leaves dirty pages alone.
+ */
+
+/*
+ * __writeback_needed --
+ *	Return if the cache has more dirty bytes than the dirty target.
+ */
+static inline int
+__writeback_needed(WT_SESSION_IMPL *session)
+{
+	WT_CACHE *cache;
+	WT_CONNECTION_IMPL *conn;
+
+	conn = S2C(session);
+	cache = conn->cache;
+
+	return (__wt_cache_dirty_inuse(cache) >
+	    (cache->eviction_dirty_target * conn->cache_size) / 100);
+}
+
+/*
+ * __writeback_file --
+ *	Write the dirty leaf pages of a single file.
+ */
+static int
+__writeback_file(
+    WT_SESSION_IMPL *session, WT_EVICT_WORKER *worker, u_int *writtenp)
+{
+	WT_BTREE *btree;
+	WT_DECL_RET;
+	WT_PAGE *page;
+	WT_REF *walk;
+	uint32_t flags;
+	u_int written;
+	WT_DECL_SPINLOCK_ID(id);
+
+	btree = S2BT(session);
+	walk = NULL;
+	written = 0;
+
+	/*
+	 * Writing leaf pages is serialized with checkpoints and other threads
+	 * writing the file's leaf pages, skip the file if it's busy.
+	 */
+	if (__wt_spin_trylock(session, &btree->flush_lock, &id) != 0)
+		return (0);
+
+	flags = WT_READ_CACHE | WT_READ_NO_GEN |
+	    WT_READ_NO_WAIT | WT_READ_SKIP_INTL;
+	for (;;) {
+		WT_ERR(__wt_tree_walk(session, &walk, NULL, flags));
+		if (walk == NULL)
+			break;
+
+		/*
+		 * Give up if the file is being closed, the thread is being
+		 * stopped, or enough of the cache is clean.
+		 */
+		if (F_ISSET(btree, WT_BTREE_NO_EVICTION) ||
+		    !F_ISSET(worker, WT_EVICT_WORKER_RUN) ||
+		    !__writeback_needed(session))
+			break;
+
+		/*
+		 * Write dirty pages if all of their updates are visible to
+		 * every transaction, otherwise the page stays dirty.  Skip
+		 * pages already queued for eviction, eviction will write them.
+		 */
+		page = walk->page;
+		if (!__wt_page_is_modified(page) ||
+		    F_ISSET_ATOMIC(page, WT_PAGE_EVICT_LRU) ||
+		    !__wt_txn_visible_all(session, page->modify->update_txn))
+			continue;
+
+		WT_ERR(__wt_reconcile(session, walk, NULL, 0));
+		++written;
+	}
+
+err:	/* On error, clear any left-over tree walk. */
+	if (walk != NULL)
+		WT_TRET(__wt_page_release(session, walk, flags));
+
+	__wt_spin_unlock(session, &btree->flush_lock);
+
+	WT_STAT_FAST_CONN_INCRV(session, cache_writeback, written);
+	WT_STAT_FAST_DATA_INCRV(session, cache_writeback, written);
+	*writtenp += written;
+	return (ret);
+}
+
+/*
+ * __writeback_tree --
+ *	Write a single file's dirty leaf pages, unless another thread is
+ *	already writing them.
+ */
+static int
+__writeback_tree(WT_SESSION_IMPL *session,
+    WT_EVICT_WORKER *worker, WT_DATA_HANDLE *dhandle, u_int *writtenp)
+{
+	WT_BTREE *btree;
+	WT_DECL_RET;
+
+	btree = dhandle->handle;
+
+	if (!WT_ATOMIC_CAS4(btree->walk_busy, 0, 1))
+		return (0);
+
+	/*
+	 * Re-check the "no eviction" flag, it is used to enforce exclusive
+	 * access when a handle is being closed.
+	 */
+	if (!F_ISSET(btree, WT_BTREE_NO_EVICTION))
+		WT_WITH_DHANDLE(session, dhandle,
+		    ret = __writeback_file(session, worker, writtenp));
+
+	WT_PUBLISH(btree->walk_busy, 0);
+	return (ret);
+}
+
+/*
+ * __writeback_pass --
+ *	Visit the files with dirty pages in turn, until some pages are written
+ *	or every file has been visited.
+ */
+static int
+__writeback_pass(
+    WT_SESSION_IMPL *session, WT_EVICT_WORKER *worker, u_int *writtenp)
+{
+	WT_BTREE *btree;
+	WT_CONNECTION_IMPL *conn;
+	WT_DATA_HANDLE *dhandle;
+	WT_DECL_RET;
+	int dhandle_locked, incr, restarted;
+	WT_DECL_SPINLOCK_ID(id);
+
+	conn = S2C(session);
+	dhandle = NULL;
+	dhandle_locked = incr = restarted = 0;
+
+	/* Update the oldest ID: it decides which pages can be written. */
+	__wt_txn_update_oldest(session);
+
+	while (*writtenp == 0 && ret == 0 &&
+	    F_ISSET(worker, WT_EVICT_WORKER_RUN)) {
+		/*
+		 * Lock the dhandle list to find the next handle and bump its
+		 * reference count to keep it alive while we write.  If the
+		 * list is busy, give up and try again later.
+		 */
+		if (!dhandle_locked) {
+			if ((ret = __wt_spin_trylock(
+			    session, &conn->dhandle_lock, &id)) != 0)
+				break;
+			dhandle_locked = 1;
+		}
+
+		if (dhandle == NULL)
+			dhandle = SLIST_FIRST(&conn->dhlh);
+		else {
+			if (incr) {
+				WT_ASSERT(session, dhandle->session_inuse > 0);
+				(void)WT_ATOMIC_SUB4(dhandle->session_inuse, 1);
+				incr = 0;
+			}
+			dhandle = SLIST_NEXT(dhandle, l);
+		}
+
+		/*
+		 * If we reach the end of the list, we're done, unless the file
+		 * the last pass stopped in has been closed: start again from
+		 * the beginning of the list.
+		 */
+		if (dhandle == NULL) {
+			if (worker->walk_last == NULL || restarted)
+				break;
+			__wt_free(session, worker->walk_last);
+			restarted = 1;
+			continue;
+		}
+
+		/*
+		 * Ignore non-file handles, handles that aren't open and the
+		 * metadata, which is only written by checkpoints.
+		 */
+		if (!WT_PREFIX_MATCH(dhandle->name, "file:") ||
+		    !F_ISSET(dhandle, WT_DHANDLE_OPEN) ||
+		    WT_IS_METADATA(dhandle))
+			continue;
+
+		/*
+		 * Start where the last pass stopped.  Handles can be closed and
+		 * freed between passes, so the file is remembered by name, not
+		 * by its handle.
+		 */
+		if (worker->walk_last != NULL) {
+			if (strcmp(worker->walk_last, dhandle->name) != 0)
+				continue;
+			__wt_free(session, worker->walk_last);
+		}
+
+		/* Skip files without dirty pages or that can't be written. */
+		btree = dhandle->handle;
+		if (btree->bytes_dirty == 0 ||
+		    F_ISSET(btree, WT_BTREE_NO_EVICTION) ||
+		    btree->walk_busy)
+			continue;
+
+		(void)WT_ATOMIC_ADD4(dhandle->session_inuse, 1);
+		incr = 1;
+		__wt_spin_unlock(session, &conn->dhandle_lock);
+		dhandle_locked = 0;
+
+		ret = __writeback_tree(session, worker, dhandle, writtenp);
+	}
+
+	/*
+	 * Remember the file we should visit first, next time, unless we gave
+	 * up before finding one.
+	 */
+	if (dhandle != NULL) {
+		if (worker->walk_last == NULL ||
+		    strcmp(worker->walk_last, dhandle->name) != 0) {
+			__wt_free(session, worker->walk_last);
+			WT_TRET(__wt_strdup(
+			    session, dhandle->name, &worker->walk_last));
+		}
+	} else if (ret != EBUSY)
+		__wt_free(session, worker->walk_last);
+	if (ret == EBUSY)
+		ret = 0;
+
+	if (incr) {
+		WT_ASSERT(session, dhandle->session_inuse > 0);
+		(void)WT_ATOMIC_SUB4(dhandle->session_inuse, 1);
+	}
+	if (dhandle_locked)
+		__wt_spin_unlock(session, &conn->dhandle_lock);
+
+	return (ret);
+}
+
+/*
+ * __writeback_server --
+ *	Thread to write dirty pages in the background.
+ */
+static WT_THREAD_RET
+__writeback_server(void *arg)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_EVICT_WORKER *worker;
+	WT_SESSION_IMPL *session;
+	u_int written;
+
+	worker = arg;
+	session = worker->session;
+	conn = S2C(session);
+
+	while (F_ISSET(conn, WT_CONN_SERVER_RUN) &&
+	    F_ISSET(worker, WT_EVICT_WORKER_RUN)) {
+		written = 0;
+		if (__writeback_needed(session))
+			WT_ERR(__writeback_pass(session, worker, &written));
+
+		/*
+		 * Don't spin in a busy loop if there is no work to do: the
+		 * threads aren't signalled, check periodically.
+		 */
+		if (written == 0)
+			WT_ERR(__wt_cond_wait(
+			    session, conn->evict_writeback_cond, 10000));
+	}
+
+	WT_ERR(__wt_verbose(
+	    session, WT_VERB_EVICTSERVER, "write-back thread exiting"));
+
+	if (0) {
+err:		WT_PANIC_MSG(session, ret, "cache write-back thread error");
+	}
+	return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * __wt_evict_writeback_create --
+ *	Configure and start the write-back threads.
+ */
+int
+__wt_evict_writeback_create(WT_SESSION_IMPL *session, const char *cfg[])
+{
+	WT_CONFIG_ITEM cval;
+	WT_CONNECTION_IMPL *conn;
+	WT_EVICT_WORKER *workers;
+	uint32_t i, threads;
+
+	conn = S2C(session);
+
+	WT_RET(__wt_config_gets(
+	    session, cfg, "eviction.writeback_threads", &cval));
+	threads = (uint32_t)cval.val;
+
+	/* If the number of threads hasn't changed, we're done. */
+	if (threads == conn->evict_writeback)
+		return (0);
+
+	/* If there are threads running, shut them down. */
+	if (conn->evict_writebackctx != NULL)
+		WT_RET(__wt_evict_writeback_destroy(session));
+	if (threads == 0)
+		return (0);
+
+	WT_RET(__wt_cond_alloc(session,
+	    "cache write-back", 0, &conn->evict_writeback_cond));
+	WT_RET(__wt_calloc_def(session, threads, &conn->evict_writebackctx));
+	conn->evict_writeback_alloc = threads;
+	workers = conn->evict_writebackctx;
+
+	/*
+	 * Write-back threads have their own sessions, and read pages using the
+	 * special eviction isolation level: they only write pages with updates
+	 * visible to every transaction.
+	 */
+	for (i = 0; i < threads; i++) {
+		WT_RET(__wt_open_internal_session(conn,
+		    "cache-write-back", 0, 0, &workers[i].session));
+		workers[i].id = i;
+		workers[i].session->txn.isolation = TXN_ISO_EVICTION;
+		F_SET(workers[i].session, WT_SESSION_CAN_WAIT);
+		F_SET(&workers[i], WT_EVICT_WORKER_RUN);
+		WT_RET(__wt_thread_create(workers[i].session,
+		    &workers[i].tid, __writeback_server, &workers[i]));
+		++conn->evict_writeback;
+	}
+
+	return (0);
+}
+
+/*
+ * __wt_evict_writeback_destroy --
+ *	Stop the write-back threads.
+ */
+int
+__wt_evict_writeback_destroy(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_EVICT_WORKER *workers;
+	WT_SESSION *wt_session;
+	uint32_t i, threads;
+
+	conn = S2C(session);
+	workers = conn->evict_writebackctx;
+	if (workers == NULL)
+		return (0);
+
+	/*
+	 * Clear the count first, so eviction stops relying on the write-back
+	 * threads to clean dirty pages.
+	 */
+	threads = conn->evict_writeback;
+	conn->evict_writeback = 0;
+
+	for (i = 0; i < threads; i++)
+		F_CLR(&workers[i], WT_EVICT_WORKER_RUN);
+	for (i = 0; i < threads; i++) {
+		WT_TRET(__wt_cond_signal(session, conn->evict_writeback_cond));
+		WT_TRET(__wt_thread_join(session, workers[i].tid));
+	}
+
+	/* Close the threads' sessions, including any from a failed start. */
+	for (i = 0; i < conn->evict_writeback_alloc; i++) {
+		__wt_free(session, workers[i].walk_last);
+		if (workers[i].session != NULL) {
+			wt_session = &workers[i].session->iface;
+			WT_TRET(wt_session->close(wt_session, NULL));
+		}
+	}
+	__wt_free(session, conn->evict_writebackctx);
+	conn->evict_writeback_alloc = 0;
+
+	WT_TRET(__wt_cond_destroy(session, &conn->evict_writeback_cond));
+
+	return (ret);
+}
@@ -34,6 +34,7 @@
 		(s)->dhandle = __olddh;					\
 		(s)->name = __oldname;					\
 		if (F_ISSET(&(s)->txn, TXN_RUNNING) &&			\
+		    !F_ISSET(&(s)->txn, TXN_PREPARED) &&		\
 		    (ret) != 0 &&					\
 		    (ret) != WT_NOTFOUND &&				\
 		    (ret) != WT_DUPLICATE_KEY)				\
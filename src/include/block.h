@@ -253,6 +253,39 @@ struct __wt_block {
 	uint8_t   *fragckpt;		/* Per-checkpoint frag tracking list */
 };
 
+/*
+ * WT_BLOCK_CACHE_ITEM --
+ *	A block's on-disk image held in the block cache, the image follows the
+ * structure in memory.
+ */
+struct __wt_block_cache_item {
+	WT_BLOCK *block;			/* Underlying file */
+	wt_off_t  offset;			/* Block address */
+	uint32_t  size;
+	uint32_t  cksum;
+
+	TAILQ_ENTRY(__wt_block_cache_item) hashq;	/* Hash bucket */
+	TAILQ_ENTRY(__wt_block_cache_item) q;		/* LRU queue */
+};
+#define	WT_BLOCK_CACHE_DATA(item)					\
+	((uint8_t *)(item) + sizeof(WT_BLOCK_CACHE_ITEM))
+
+/*
+ * WT_BLOCK_CACHE --
+ *	A connection-wide cache of block images, between the block manager's
+ * reads and writes and the page cache.
+ */
+struct __wt_block_cache {
+	WT_SPINLOCK lock;			/* Locked: everything below */
+
+	uint64_t bytes_inuse;			/* Bytes of block images */
+	uint64_t bytes_max;			/* Configured size */
+
+	TAILQ_HEAD(__wt_block_cache_lru, __wt_block_cache_item) lru;
+#define	WT_BLOCK_CACHE_HASH_SIZE	16384
+	TAILQ_HEAD(__wt_block_cache_hash, __wt_block_cache_item) *hash;
+};
+
 /*
  * WT_BLOCK_DESC --
  *	The file's description.
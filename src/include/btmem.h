@@ -191,6 +191,13 @@ struct __wt_page_modify {
 	/* In-memory split transaction ID. */
 	uint64_t inmem_split_txn;
 
+	/*
+	 * The oldest transaction ID and pinned timestamp when the sweep server
+	 * last discarded the page's obsolete updates.
+	 */
+	uint64_t obsolete_check_txn;
+	uint64_t obsolete_check_timestamp;
+
 	/* Dirty bytes added to the cache. */
 	size_t bytes_dirty;
 
@@ -535,6 +542,19 @@ struct __wt_page {
 #define	WT_PAGE_SPLITTING	0x80	/* An internal page is growing */
 	uint8_t flags_atomic;		/* Atomic flags, use F_*_ATOMIC */
 
+	/*
+	 * The access count is maintained for the clock and 2Q eviction
+	 * policies: it is set when the page is accessed and incremented (up
+	 * to a small limit), each time an access moves the page's read
+	 * generation forward.  The clock policy's eviction walk decrements it
+	 * as the walk passes the page, the 2Q policy protects pages accessed
+	 * more than once.
+	 */
+#define	WT_PAGE_ACCESS_MAX	3
+	uint8_t access_count;		/* Eviction policy access count */
+
+	uint8_t numa_node;		/* NUMA node that created the page */
+
 	/*
 	 * The page's read generation acts as an LRU value for each page in the
 	 * tree; it is used by the eviction server thread to select pages to be
@@ -553,6 +573,7 @@ struct __wt_page {
 	 */
 #define	WT_READGEN_NOTSET	0
 #define	WT_READGEN_OLDEST	1
+#define	WT_READGEN_ONCE		2	/* Read by a read-once cursor */
 #define	WT_READGEN_STEP		100
 	uint64_t read_gen;
 
@@ -837,6 +858,7 @@ struct __wt_ikey {
  */
 WT_PACKED_STRUCT_BEGIN(__wt_update)
 	uint64_t txnid;			/* update transaction */
+	uint64_t timestamp;		/* commit timestamp, 0 if none */
 
 	WT_UPDATE *next;		/* forward-linked list */
 
@@ -126,13 +126,33 @@ struct __wt_btree {
 	uint64_t checkpoint_gen;	/* Checkpoint generation */
 	uint64_t rec_max_txn;		/* Maximum txn seen (clean trees) */
 	uint64_t write_gen;		/* Write generation */
+	int	 lookaside;		/* Lookaside table may have records */
+
+	uint64_t bytes_inmem;		/* Cache bytes in memory */
+	uint64_t bytes_dirty;		/* Cache bytes dirty */
 
 	WT_REF  *evict_ref;		/* Eviction thread's location */
+	WT_SESSION_IMPL *evict_session;	/* Session holding the location */
 	uint64_t evict_priority;	/* Relative priority of cached pages */
+	int	 cache_priority;	/* Configured cache priority */
+	uint64_t cache_resident_max;	/* Configured cache bytes maximum */
 	u_int    evict_walk_period;	/* Skip this many LRU walks */
 	u_int    evict_walk_skips;	/* Number of walks skipped */
+	u_int    evict_walk_yield;	/* Percent queued by the last walk */
+	volatile uint32_t evict_walk_busy;/* Walk in progress */
 	volatile uint32_t evict_busy;	/* Count of threads in eviction */
 
+	/*
+	 * Background threads walking the tree's pages outside of eviction's
+	 * LRU walk (the eviction write-back workers, the sweep server trimming
+	 * obsolete updates and the cache warm-up listing pages at close) take
+	 * this flag, so only one of them walks the tree at a time.  Exclusive
+	 * eviction of the file waits for the flag to clear.
+	 */
+	volatile uint32_t walk_busy;
+
+	WT_CACHE_WARMUP_FILE *warmup;	/* Cache warm-up page list */
+
 	int checkpointing;		/* Checkpoint in progress */
 
 	/*
@@ -149,6 +169,7 @@ struct __wt_btree {
 #define	WT_BTREE_SALVAGE	0x00800	/* Handle is for salvage */
 #define	WT_BTREE_UPGRADE	0x01000	/* Handle is for upgrade */
 #define	WT_BTREE_VERIFY		0x02000	/* Handle is for verify */
+#define	WT_BTREE_LOOKASIDE	0x04000	/* Handle is the lookaside table */
 	uint32_t flags;
 };
 
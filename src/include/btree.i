@@ -44,14 +44,21 @@ __wt_page_is_modified(WT_PAGE *page)
 static inline void
 __wt_cache_page_inmem_incr(WT_SESSION_IMPL *session, WT_PAGE *page, size_t size)
 {
+	WT_BTREE *btree;
 	WT_CACHE *cache;
 
 	WT_ASSERT(session, size < WT_EXABYTE);
 
+	btree = S2BT(session);
 	cache = S2C(session)->cache;
+	(void)WT_ATOMIC_ADD8(btree->bytes_inmem, size);
 	(void)WT_ATOMIC_ADD8(cache->bytes_inmem, size);
 	(void)WT_ATOMIC_ADD8(page->memory_footprint, size);
+	if (cache->numa_nodes != 0)
+		(void)WT_ATOMIC_ADD8(
+		    cache->numa[page->numa_node].bytes_inmem, size);
 	if (__wt_page_is_modified(page)) {
+		(void)WT_ATOMIC_ADD8(btree->bytes_dirty, size);
 		(void)WT_ATOMIC_ADD8(cache->bytes_dirty, size);
 		(void)WT_ATOMIC_ADD8(page->modify->bytes_dirty, size);
 	}
@@ -60,6 +67,11 @@ __wt_cache_page_inmem_incr(WT_SESSION_IMPL *session, WT_PAGE *page, size_t size)
 		(void)WT_ATOMIC_ADD8(cache->bytes_internal, size);
 	else if (page->type == WT_PAGE_OVFL)
 		(void)WT_ATOMIC_ADD8(cache->bytes_overflow, size);
+
+	/* Tell eviction if the object is over its resident maximum. */
+	if (__wt_cache_over_quota(btree) &&
+	    !F_ISSET(cache, WT_CACHE_OVER_QUOTA))
+		F_SET(cache, WT_CACHE_OVER_QUOTA);
 }
 
 /* 
@@ -98,10 +110,12 @@ static inline void
 __wt_cache_page_byte_dirty_decr(
     WT_SESSION_IMPL *session, WT_PAGE *page, size_t size)
 {
+	WT_BTREE *btree;
 	WT_CACHE *cache;
 	size_t decr, orig;
 	int i;
 
+	btree = S2BT(session);
 	cache = S2C(session)->cache;
 
 	/*
@@ -130,7 +144,13 @@ __wt_cache_page_byte_dirty_decr(
 		decr = WT_MIN(size, orig);
 		if (WT_ATOMIC_CAS8(
 		    page->modify->bytes_dirty, orig, orig - decr)) {
+			WT_CACHE_DECR(session, btree->bytes_dirty, decr);
 			WT_CACHE_DECR(session, cache->bytes_dirty, decr);
+
+			/* Cleaned bytes refill the write throttle. */
+			if (cache->write_throttle)
+				(void)WT_ATOMIC_ADD8(
+				    cache->throttle_tokens, (int64_t)decr);
 			break;
 		}
 	}
@@ -143,14 +163,20 @@ __wt_cache_page_byte_dirty_decr(
 static inline void
 __wt_cache_page_inmem_decr(WT_SESSION_IMPL *session, WT_PAGE *page, size_t size)
 {
+	WT_BTREE *btree;
 	WT_CACHE *cache;
 
+	btree = S2BT(session);
 	cache = S2C(session)->cache;
 
 	WT_ASSERT(session, size < WT_EXABYTE);
 
+	WT_CACHE_DECR(session, btree->bytes_inmem, size);
 	WT_CACHE_DECR(session, cache->bytes_inmem, size);
 	WT_CACHE_DECR(session, page->memory_footprint, size);
+	if (cache->numa_nodes != 0)
+		WT_CACHE_DECR(session,
+		    cache->numa[page->numa_node].bytes_inmem, size);
 	if (__wt_page_is_modified(page))
 		__wt_cache_page_byte_dirty_decr(session, page, size);
 	/* Track internal and overflow size in cache. */
@@ -168,9 +194,11 @@ __wt_cache_page_inmem_decr(WT_SESSION_IMPL *session, WT_PAGE *page, size_t size)
 static inline void
 __wt_cache_dirty_incr(WT_SESSION_IMPL *session, WT_PAGE *page)
 {
+	WT_BTREE *btree;
 	WT_CACHE *cache;
 	size_t size;
 
+	btree = S2BT(session);
 	cache = S2C(session)->cache;
 	(void)WT_ATOMIC_ADD8(cache->pages_dirty, 1);
 
@@ -179,6 +207,7 @@ __wt_cache_dirty_incr(WT_SESSION_IMPL *session, WT_PAGE *page)
 	 * with updates.
 	 */
 	size = page->memory_footprint;
+	(void)WT_ATOMIC_ADD8(btree->bytes_dirty, size);
 	(void)WT_ATOMIC_ADD8(cache->bytes_dirty, size);
 	(void)WT_ATOMIC_ADD8(page->modify->bytes_dirty, size);
 }
@@ -217,17 +246,30 @@ __wt_cache_dirty_decr(WT_SESSION_IMPL *session, WT_PAGE *page)
 static inline void
 __wt_cache_page_evict(WT_SESSION_IMPL *session, WT_PAGE *page)
 {
+	WT_BTREE *btree;
 	WT_CACHE *cache;
+	WT_CACHE_NODE *node;
 	WT_PAGE_MODIFY *modify;
 
+	btree = S2BT(session);
 	cache = S2C(session)->cache;
 	modify = page->modify;
 
 	/* Update the bytes in-memory to reflect the eviction. */
+	WT_CACHE_DECR(session, btree->bytes_inmem, page->memory_footprint);
 	WT_CACHE_DECR(session, cache->bytes_inmem, page->memory_footprint);
 
-	/* Update the cache's dirty-byte count. */
+	/* Update the cache's internal and overflow byte counts. */
+	if (WT_PAGE_IS_INTERNAL(page))
+		WT_CACHE_DECR(
+		    session, cache->bytes_internal, page->memory_footprint);
+	else if (page->type == WT_PAGE_OVFL)
+		WT_CACHE_DECR(
+		    session, cache->bytes_overflow, page->memory_footprint);
+
+	/* Update the tree's and the cache's dirty-byte count. */
 	if (modify != NULL && modify->bytes_dirty != 0) {
+		WT_CACHE_DECR(session, btree->bytes_dirty, modify->bytes_dirty);
 		if (cache->bytes_dirty < modify->bytes_dirty) {
 			__wt_errx(session,
 			   "cache eviction dirty-bytes decrement failed: "
@@ -236,11 +278,24 @@ __wt_cache_page_evict(WT_SESSION_IMPL *session, WT_PAGE *page)
 		} else
 			WT_CACHE_DECR(
 			    session, cache->bytes_dirty, modify->bytes_dirty);
+
+		/* Cleaned bytes refill the write throttle. */
+		if (cache->write_throttle)
+			(void)WT_ATOMIC_ADD8(cache->throttle_tokens,
+			    (int64_t)modify->bytes_dirty);
 	}
 
 	/* Update pages and bytes evicted. */
 	(void)WT_ATOMIC_ADD8(cache->bytes_evict, page->memory_footprint);
 	(void)WT_ATOMIC_ADD8(cache->pages_evict, 1);
+
+	/* Update the page's NUMA node. */
+	if (cache->numa_nodes != 0) {
+		node = &cache->numa[page->numa_node];
+		WT_CACHE_DECR(
+		    session, node->bytes_inmem, page->memory_footprint);
+		(void)WT_ATOMIC_ADD8(node->pages_evict, 1);
+	}
 }
 
 /*
@@ -998,9 +1053,18 @@ __wt_page_can_evict(WT_SESSION_IMPL *session, WT_PAGE *page, int check_splits)
 		return (0);
 	}
 
+	/*
+	 * Updates to the lookaside table are visible to everyone: the IDs
+	 * tracked for its pages are those of threads that happened to dirty
+	 * them (for example, by splitting them), don't wait on them.
+	 */
+	if (F_ISSET(btree, WT_BTREE_LOOKASIDE))
+		return (1);
+
 	/*
 	 * If we aren't (potentially) doing eviction that can restore updates
-	 * and the updates on this page are too recent, give up.
+	 * or move them to the lookaside table, and the updates on this page
+	 * are too recent, give up.
 	 *
 	 * Don't rely on new updates being skipped by the transaction used
 	 * for transaction reads: (1) there are paths that dirty pages for
@@ -1017,6 +1081,7 @@ __wt_page_can_evict(WT_SESSION_IMPL *session, WT_PAGE *page, int check_splits)
 	 * is blocked by the exclusive lock.
 	 */
 	if (page->read_gen != WT_READGEN_OLDEST &&
+	    !__wt_cache_lookaside(session, page) &&
 	    !__wt_txn_visible_all(session, __wt_page_is_modified(page) ?
 	    mod->update_txn : mod->rec_max_txn))
 		return (0);
@@ -1189,7 +1254,7 @@ __wt_page_hazard_check(WT_SESSION_IMPL *session, WT_PAGE *page)
 	WT_CONNECTION_IMPL *conn;
 	WT_HAZARD *hp;
 	WT_SESSION_IMPL *s;
-	uint32_t i, hazard_size, session_cnt;
+	uint32_t i, hazard_inuse, session_cnt;
 
 	conn = S2C(session);
 
@@ -1200,13 +1265,14 @@ __wt_page_hazard_check(WT_SESSION_IMPL *session, WT_PAGE *page)
 	 * reading the active session count.  That way, no matter what sessions
 	 * come or go, we'll check the slots for all of the sessions that could
 	 * have been active when we started our check.
+	 *
+	 * Inactive sessions and sessions without hazard pointers have no slots
+	 * in use, there's no need to check the active field separately.
 	 */
 	WT_ORDERED_READ(session_cnt, conn->session_cnt);
 	for (s = conn->sessions, i = 0; i < session_cnt; ++s, ++i) {
-		if (!s->active)
-			continue;
-		WT_ORDERED_READ(hazard_size, s->hazard_size);
-		for (hp = s->hazard; hp < s->hazard + hazard_size; ++hp)
+		WT_ORDERED_READ(hazard_inuse, s->hazard_inuse);
+		for (hp = s->hazard; hp < s->hazard + hazard_inuse; ++hp)
 			if (hp->page == page)
 				return (hp);
 	}
@@ -10,18 +10,45 @@
  * Tuning constants: I hesitate to call this tuning, but we want to review some
  * number of pages from each file's in-memory tree for each page we evict.
  */
-#define	WT_EVICT_INT_SKEW  (1<<20)	/* Prefer leaf pages over internal
-					   pages by this many increments of the
-					   read generation. */
+#define	WT_EVICT_INT_SKEW  (1<<12)	/* Prefer leaf pages over internal
+					   pages with no children in memory by
+					   this many increments of the read
+					   generation. */
+#define	WT_EVICT_PROTECT_SKEW (1<<20)	/* With the 2Q policy, prefer pages
+					   accessed once over pages accessed
+					   repeatedly by this many increments
+					   of the read generation. */
+#define	WT_EVICT_PRIORITY_SKEW (1<<14)	/* Skew the read generation of pages
+					   by this many increments for each
+					   point of an object's priority. */
+#define	WT_EVICT_QUOTA_SKEW (1<<24)	/* Prefer pages of objects over their
+					   resident maximum by this many
+					   increments. */
 #define	WT_EVICT_WALK_PER_FILE	 10	/* Pages to queue per file */
 #define	WT_EVICT_MAX_PER_FILE	100	/* Max pages to visit per file */
 #define	WT_EVICT_WALK_BASE	300	/* Pages tracked across file visits */
 #define	WT_EVICT_WALK_INCR	100	/* Pages added each walk */
 
+#define	WT_CACHE_POOL_REQUEST_BATCH 64	/* Page requests counted at once */
+
+/*
+ * The lookaside table key is the btree ID, the address cookie of the block
+ * written in place of the page and a record counter; the value is the ID and
+ * timestamp of the transaction whose update was written to the block, then
+ * the update's transaction ID, timestamp, a deleted flag, the record's key
+ * and the update's value.
+ */
+#define	WT_LAS_FORMAT							\
+	"key_format=" WT_UNCHECKED_STRING(IuQ)				\
+	",value_format=" WT_UNCHECKED_STRING(QQQQBuu)
+#define	WT_LAS_SWEEP_ENTRIES	20000	/* Records reviewed per sweep */
+
 #define	WT_EVICT_PASS_AGGRESSIVE	0x01
 #define	WT_EVICT_PASS_ALL		0x02
 #define	WT_EVICT_PASS_DIRTY		0x04
 #define	WT_EVICT_PASS_WOULD_BLOCK	0x08
+#define	WT_EVICT_PASS_CLEAN		0x10
+#define	WT_EVICT_PASS_QUOTA		0x20
 
 /*
  * WT_EVICT_ENTRY --
@@ -30,20 +57,64 @@
 struct __wt_evict_entry {
 	WT_BTREE *btree;			/* Enclosing btree object */
 	WT_REF	 *ref;				/* Page to flush/evict */
+	int	  protect;			/* Protect pages (2Q) */
+};
+
+/*
+ * WT_EVICT_QUEUE --
+ *	Encapsulation of an eviction candidate queue.  Candidates selected by
+ * the eviction server are spread across several queues, each with its own
+ * lock, so application threads and eviction workers don't all serialize on
+ * a single lock when the cache is full.
+ */
+#define	WT_EVICT_QUEUE_MAX	20	/* !!! Must match threads_max */
+struct __wt_evict_queue {
+	WT_SPINLOCK evict_lock;			/* Queue lock */
+	WT_EVICT_ENTRY *evict_queue;		/* Candidates, in LRU order */
+	volatile uint32_t evict_current;	/* Next candidate to evict */
+	volatile uint32_t evict_candidates;	/* Candidates queued */
+	uint32_t evict_server_stop;		/* Server stops evicting here */
 };
 
 /*
  * WT_EVICT_WORKER --
- *	Encapsulation of an eviction worker thread.
+ *	Encapsulation of an eviction worker or write-back thread.
  */
 struct __wt_evict_worker {
 	WT_SESSION_IMPL *session;
 	u_int id;
 	wt_thread_t tid;
+	char *walk_last;		/* Name of the last file walked */
+	int walk_held;			/* Worker may hold walk positions */
 #define	WT_EVICT_WORKER_RUN	0x01
 	uint32_t flags;
 };
 
+/*
+ * WT_CACHE_NODE --
+ *	Cache usage of a single NUMA node.
+ */
+struct WT_COMPILER_TYPE_ALIGN(WT_CACHE_LINE_ALIGNMENT) __wt_cache_node {
+	uint64_t bytes_inmem;		/* Bytes/pages in memory */
+	uint64_t pages_inmem;
+	uint64_t pages_evict;		/* Pages discarded by eviction */
+};
+
+/*
+ * WT_CACHE_WARMUP_FILE --
+ *	The pages of a single file to read into the cache when the database is
+ * opened, sorted by address.
+ */
+struct __wt_cache_warmup_file {
+	char	*uri;			/* File URI */
+	WT_ITEM *addr;			/* Page addresses */
+	u_int	 addr_cnt;
+	size_t	 addr_alloc;
+
+	WT_PAGE *preload_home;		/* Last page pre-loaded from */
+	uint32_t preload_slot;		/* Last slot pre-loaded */
+};
+
 /*
  * WiredTiger cache structure.
  */
@@ -76,29 +147,86 @@ struct __wt_cache {
 	 * Eviction thread information.
 	 */
 	WT_CONDVAR *evict_cond;		/* Eviction server condition */
-	WT_SPINLOCK evict_lock;		/* Eviction LRU queue */
-	WT_SPINLOCK evict_walk_lock;	/* Eviction walk location */
+	WT_SPINLOCK evict_lock;		/* Eviction LRU list */
 	/* Condition signalled when the eviction server populates the queue */
 	WT_CONDVAR *evict_waiter_cond;
 
 	u_int eviction_trigger;		/* Percent to trigger eviction */
 	u_int eviction_target;		/* Percent to end eviction */
 	u_int eviction_dirty_target;    /* Percent to allow dirty */
+	u_int eviction_dirty_trigger;	/* Percent to trigger dirty eviction */
 
 	u_int overhead_pct;	        /* Cache percent adjustment */
 
 	/*
-	 * LRU eviction list information.
+	 * Application thread eviction budget and write throttle: when writers
+	 * are throttled, they take tokens from a bucket refilled as dirty
+	 * bytes are cleaned.
+	 */
+	uint64_t app_wait_max;		/* Eviction usecs per operation */
+	u_int	 app_pages_max;		/* Eviction pages per operation */
+	int	 write_throttle;	/* Throttle writers */
+	volatile int64_t throttle_tokens;/* Write throttle bytes available */
+
+	/*
+	 * LRU eviction list information: the list is owned by the eviction
+	 * server, which sorts it and moves the best candidates onto the
+	 * eviction queues.
 	 */
 	WT_EVICT_ENTRY *evict;		/* LRU pages being tracked */
-	WT_EVICT_ENTRY *evict_current;	/* LRU current page to be evicted */
-	uint32_t evict_candidates;	/* LRU list pages to evict */
-	uint32_t evict_entries;		/* LRU entries in the queue */
+	uint32_t evict_entries;		/* LRU entries in the list */
 	volatile uint32_t evict_max;	/* LRU maximum eviction slot used */
 	uint32_t evict_slots;		/* LRU list eviction slots */
 	WT_DATA_HANDLE
 		*evict_file_next;	/* LRU next file to search */
 
+	/*
+	 * Eviction walk information: several threads can walk files at the
+	 * same time, each file's walk position is held by a single thread.
+	 */
+	uint64_t evict_score_avg;	/* Average file eviction score */
+					/* Sessions waiting on a walk clear */
+	volatile uint32_t evict_clear_waiting;
+
+	/*
+	 * Eviction candidate queues.
+	 */
+	WT_EVICT_QUEUE *evict_queues;	/* Candidate queues */
+	u_int evict_queue_count;	/* Queues to fill */
+	volatile u_int evict_queue_alloc;/* Queues allocated */
+	u_int evict_queue_next;		/* Next queue to fill */
+
+	/*
+	 * NUMA partitioning: pages are tagged with the node of the thread that
+	 * created them, each node's share of the cache is tracked, and the
+	 * eviction queues and workers are divided between the nodes.
+	 */
+	u_int	 numa_nodes;		/* Nodes, 0 if not partitioned */
+	WT_CACHE_NODE *numa;		/* Per-node cache usage */
+	uint8_t *numa_cpu_node;		/* Node of each CPU */
+	u_int	 numa_cpus;		/* CPUs in the map */
+
+	enum {	EVICT_POLICY_LRU=0,	/* Least-recently used */
+		EVICT_POLICY_CLOCK=1,	/* Clock, second chance */
+		EVICT_POLICY_2Q=2	/* Two-queue, scan resistant */
+	} evict_policy;			/* Eviction policy */
+
+	/*
+	 * Cache warm-up information: the pages in the cache are listed at each
+	 * checkpoint and when the database is closed, and threads read them
+	 * back into the cache when the database is next opened.
+	 */
+	int	 warmup;		/* Save and restore the cache */
+	volatile int warmup_complete;	/* Pages have been read back */
+	WT_EVICT_WORKER *warmup_workers;/* Warm-up threads */
+	uint32_t warmup_threads;	/* Number of warm-up threads */
+	uint32_t warmup_alloc;		/* Allocated warm-up threads */
+	volatile uint32_t warmup_running;/* Warm-up threads still running */
+	WT_CACHE_WARMUP_FILE *warmup_files;/* Files to read */
+	u_int	 warmup_file_cnt;
+	size_t	 warmup_file_alloc;
+	volatile uint32_t warmup_file_next;/* Next file to read */
+
 	/*
 	 * Sync/flush request information.
 	 */
@@ -106,10 +234,17 @@ struct __wt_cache {
 	volatile uint64_t sync_complete;/* File sync requests completed */
 
 	/*
-	 * Cache pool information.
+	 * Cache pool information: the pool assesses each connection's cache
+	 * pressure from its miss ratio and the time application threads spend
+	 * evicting pages, smoothed across balancing passes.
 	 */
-	uint64_t cp_saved_read;		/* Read count from last pass */
-	uint64_t cp_current_read;	/* Read count from current pass */
+	uint64_t pages_requested;	/* Application page requests */
+	uint64_t pages_missed;		/* Requests reading from disk */
+	uint64_t app_evict_time;	/* Application eviction usecs */
+	uint64_t cp_saved_requests;	/* Page requests from last pass */
+	uint64_t cp_saved_misses;	/* Page misses from last pass */
+	uint64_t cp_saved_app_time;	/* Eviction usecs from last pass */
+	uint64_t cp_pressure;		/* Cache pressure, per mille */
 	uint32_t cp_skip_count;		/* Post change stabilization */
 	uint64_t cp_reserved;		/* Base size for this cache */
 	WT_SESSION_IMPL *cp_session;	/* May be used for cache management */
@@ -124,6 +259,8 @@ struct __wt_cache {
 #define	WT_CACHE_STUCK		0x08	/* Eviction server is stuck */
 #define	WT_CACHE_WALK_REVERSE	0x10	/* Scan backwards for candidates */
 #define	WT_CACHE_WOULD_BLOCK	0x20	/* Pages that would block apps */
+#define	WT_CACHE_OVER_QUOTA	0x40	/* Objects over resident maximum */
+#define	WT_CACHE_LOOKASIDE	0x80	/* Evict using the lookaside table */
 	uint32_t flags;
 };
 
@@ -138,6 +275,7 @@ struct __wt_cache_pool {
 	uint64_t size;
 	uint64_t chunk;
 	uint64_t currently_used;
+	struct timespec assess_time;	/* Time of the last assessment */
 	uint32_t refs;		/* Reference count for structure. */
 	/* Locked: List of connections participating in the cache pool. */
 	TAILQ_HEAD(__wt_cache_pool_qh, __wt_connection_impl) cache_pool_qh;
@@ -26,6 +26,51 @@ __wt_cache_read_gen_incr(WT_SESSION_IMPL *session)
 	++S2C(session)->cache->read_gen;
 }
 
+/*
+ * __wt_cache_over_quota --
+ *	Return if an object uses more of the cache than its resident maximum.
+ */
+static inline int
+__wt_cache_over_quota(WT_BTREE *btree)
+{
+	return (btree->cache_resident_max != 0 &&
+	    btree->bytes_inmem > btree->cache_resident_max);
+}
+
+/*
+ * __wt_cache_lookaside --
+ *	Return if a page should be evicted using the lookaside table: eviction
+ *	is stuck, and the page is a row-store or variable-length column-store
+ *	leaf page of a tree that isn't about to be checkpointed.
+ */
+static inline int
+__wt_cache_lookaside(WT_SESSION_IMPL *session, WT_PAGE *page)
+{
+	WT_BTREE *btree;
+	WT_CONNECTION_IMPL *conn;
+	WT_TXN_GLOBAL *txn_global;
+
+	btree = S2BT(session);
+	conn = S2C(session);
+	txn_global = &conn->txn_global;
+
+	if (!F_ISSET(conn->cache, WT_CACHE_LOOKASIDE) ||
+	    conn->las_cursor == NULL)
+		return (0);
+	if (page->type != WT_PAGE_ROW_LEAF && page->type != WT_PAGE_COL_VAR)
+		return (0);
+	if (F_ISSET(btree, WT_BTREE_LOOKASIDE) ||
+	    WT_IS_METADATA(btree->dhandle))
+		return (0);
+
+	/*
+	 * The newest committed updates are written, a checkpoint that hasn't
+	 * yet reached the tree mustn't find them.
+	 */
+	return (txn_global->checkpoint_snap_min == WT_TXN_NONE ||
+	    btree->checkpoint_gen == txn_global->checkpoint_gen);
+}
+
 /*
  * __wt_cache_read_gen_set --
  *      Get the read generation to store in a page.
@@ -45,6 +90,31 @@ __wt_cache_read_gen_set(WT_SESSION_IMPL *session)
 	return (__wt_cache_read_gen(session) + WT_READGEN_STEP);
 }
 
+/*
+ * __wt_cache_pool_count --
+ *	Count an application page request for the shared cache, which uses the
+ *	connection's miss ratio to decide how much cache it needs.
+ */
+static inline void
+__wt_cache_pool_count(WT_SESSION_IMPL *session, int miss)
+{
+	WT_CACHE *cache;
+
+	cache = S2C(session)->cache;
+
+	/*
+	 * Misses are rare enough to count as they happen, count requests in
+	 * batches to avoid updating shared memory on every page access.
+	 */
+	if (miss)
+		(void)WT_ATOMIC_ADD8(cache->pages_missed, 1);
+	else if (++session->cache_requests == WT_CACHE_POOL_REQUEST_BATCH) {
+		(void)WT_ATOMIC_ADD8(
+		    cache->pages_requested, WT_CACHE_POOL_REQUEST_BATCH);
+		session->cache_requests = 0;
+	}
+}
+
 /*
  * __wt_cache_pages_inuse --
  *	Return the number of pages in use.
@@ -118,15 +188,61 @@ __wt_eviction_check(WT_SESSION_IMPL *session, int *fullp, int wake)
 	/* Calculate the cache full percentage. */
 	*fullp = (int)((100 * bytes_inuse) / bytes_max);
 
-	/* Wake eviction when we're over the trigger cache size. */
+	/*
+	 * Wake eviction when we're over the trigger cache size, or over the
+	 * dirty target.  If write-back threads are cleaning dirty pages, leave
+	 * dirty pages to them until we're over the dirty trigger.  Also wake
+	 * eviction if an object is using more than its resident maximum.
+	 */
 	if (wake &&
 	    (bytes_inuse > (cache->eviction_trigger * bytes_max) / 100 ||
-	    dirty_inuse > (cache->eviction_dirty_target * bytes_max) / 100))
+	    dirty_inuse > ((conn->evict_writeback == 0 ?
+	    cache->eviction_dirty_target : cache->eviction_dirty_trigger) *
+	    bytes_max) / 100 ||
+	    F_ISSET(cache, WT_CACHE_OVER_QUOTA)))
 		WT_RET(__wt_evict_server_wake(session));
 
 	return (0);
 }
 
+/*
+ * __wt_eviction_dirty_needed --
+ *	Return if the cache has more dirty bytes than the dirty trigger.
+ */
+static inline int
+__wt_eviction_dirty_needed(WT_SESSION_IMPL *session)
+{
+	WT_CACHE *cache;
+	WT_CONNECTION_IMPL *conn;
+
+	conn = S2C(session);
+	cache = conn->cache;
+
+	return (__wt_cache_dirty_inuse(cache) >
+	    (cache->eviction_dirty_trigger * conn->cache_size) / 100);
+}
+
+/*
+ * __wt_cache_write_check --
+ *	Throttle a write if writers are dirtying the cache faster than eviction
+ *	can clean it.
+ */
+static inline int
+__wt_cache_write_check(WT_SESSION_IMPL *session, WT_BTREE *btree, size_t size)
+{
+	/*
+	 * Internal threads, threads holding locks that block eviction and
+	 * threads writing trees that can't be evicted are never throttled.
+	 */
+	if (!S2C(session)->cache->write_throttle ||
+	    F_ISSET(session, WT_SESSION_INTERNAL | WT_SESSION_NO_CACHE_CHECK |
+	    WT_SESSION_SCHEMA_LOCKED | WT_SESSION_HANDLE_LIST_LOCKED) ||
+	    F_ISSET(btree, WT_BTREE_NO_EVICTION))
+		return (0);
+
+	return (__wt_cache_write_throttle(session, size));
+}
+
 /*
  * __wt_session_can_wait --
  *	Return if a session available for a potentially slow operation.
@@ -188,10 +304,12 @@ __wt_cache_full_check(WT_SESSION_IMPL *session)
 	 * If the cache is less than 95% full, no work to be done.  If we are
 	 * at the API boundary and the cache is more than 95% full, try to
 	 * evict at least one page before we start an operation.  This helps
-	 * with some eviction-dominated workloads.
+	 * with some eviction-dominated workloads.  Similarly, help out if more
+	 * of the cache is dirty than the dirty trigger: the eviction and
+	 * write-back threads aren't keeping up.
 	 */
 	WT_RET(__wt_eviction_check(session, &full, 1));
-	if (full < 95)
+	if (full < 95 && !__wt_eviction_dirty_needed(session))
 		return (0);
 
 	return (__wt_cache_wait(session, full));
@@ -57,32 +57,35 @@ struct __wt_config_parser_impl {
 #define	WT_CONFIG_ENTRY_connection_load_extension	 7
 #define	WT_CONFIG_ENTRY_connection_open_session		 8
 #define	WT_CONFIG_ENTRY_connection_reconfigure		 9
-#define	WT_CONFIG_ENTRY_cursor_close			10
-#define	WT_CONFIG_ENTRY_cursor_reconfigure		11
-#define	WT_CONFIG_ENTRY_file_meta			12
-#define	WT_CONFIG_ENTRY_index_meta			13
-#define	WT_CONFIG_ENTRY_session_begin_transaction	14
-#define	WT_CONFIG_ENTRY_session_checkpoint		15
-#define	WT_CONFIG_ENTRY_session_close			16
-#define	WT_CONFIG_ENTRY_session_commit_transaction	17
-#define	WT_CONFIG_ENTRY_session_compact			18
-#define	WT_CONFIG_ENTRY_session_create			19
-#define	WT_CONFIG_ENTRY_session_drop			20
-#define	WT_CONFIG_ENTRY_session_log_printf		21
-#define	WT_CONFIG_ENTRY_session_open_cursor		22
-#define	WT_CONFIG_ENTRY_session_reconfigure		23
-#define	WT_CONFIG_ENTRY_session_rename			24
-#define	WT_CONFIG_ENTRY_session_rollback_transaction	25
-#define	WT_CONFIG_ENTRY_session_salvage			26
-#define	WT_CONFIG_ENTRY_session_strerror		27
-#define	WT_CONFIG_ENTRY_session_truncate		28
-#define	WT_CONFIG_ENTRY_session_upgrade			29
-#define	WT_CONFIG_ENTRY_session_verify			30
-#define	WT_CONFIG_ENTRY_table_meta			31
-#define	WT_CONFIG_ENTRY_wiredtiger_open			32
-#define	WT_CONFIG_ENTRY_wiredtiger_open_all		33
-#define	WT_CONFIG_ENTRY_wiredtiger_open_basecfg		34
-#define	WT_CONFIG_ENTRY_wiredtiger_open_usercfg		35
+#define	WT_CONFIG_ENTRY_connection_set_timestamp	10
+#define	WT_CONFIG_ENTRY_cursor_close			11
+#define	WT_CONFIG_ENTRY_cursor_reconfigure		12
+#define	WT_CONFIG_ENTRY_file_meta			13
+#define	WT_CONFIG_ENTRY_index_meta			14
+#define	WT_CONFIG_ENTRY_session_begin_transaction	15
+#define	WT_CONFIG_ENTRY_session_checkpoint		16
+#define	WT_CONFIG_ENTRY_session_close			17
+#define	WT_CONFIG_ENTRY_session_commit_transaction	18
+#define	WT_CONFIG_ENTRY_session_compact			19
+#define	WT_CONFIG_ENTRY_session_create			20
+#define	WT_CONFIG_ENTRY_session_drop			21
+#define	WT_CONFIG_ENTRY_session_log_printf		22
+#define	WT_CONFIG_ENTRY_session_open_cursor		23
+#define	WT_CONFIG_ENTRY_session_prepare_transaction	24
+#define	WT_CONFIG_ENTRY_session_reconfigure		25
+#define	WT_CONFIG_ENTRY_session_rename			26
+#define	WT_CONFIG_ENTRY_session_rollback_transaction	27
+#define	WT_CONFIG_ENTRY_session_salvage			28
+#define	WT_CONFIG_ENTRY_session_strerror		29
+#define	WT_CONFIG_ENTRY_session_truncate		30
+#define	WT_CONFIG_ENTRY_session_upgrade			31
+#define	WT_CONFIG_ENTRY_session_verify			32
+#define	WT_CONFIG_ENTRY_session_write_batch		33
+#define	WT_CONFIG_ENTRY_table_meta			34
+#define	WT_CONFIG_ENTRY_wiredtiger_open			35
+#define	WT_CONFIG_ENTRY_wiredtiger_open_all		36
+#define	WT_CONFIG_ENTRY_wiredtiger_open_basecfg		37
+#define	WT_CONFIG_ENTRY_wiredtiger_open_usercfg		38
 /*
  * configuration section: END
  * DO NOT EDIT: automatically built by dist/flags.py.
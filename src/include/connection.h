@@ -200,6 +200,8 @@ struct __wt_connection_impl {
 	SLIST_HEAD(__wt_blockhash, __wt_block) blockhash[WT_HASH_ARRAY_SIZE];
 	SLIST_HEAD(__wt_block_lh, __wt_block) blocklh;
 
+	WT_BLOCK_CACHE block_cache;	/* Block image cache */
+
 	u_int open_btree_count;		/* Locked: open writable btree count */
 	uint32_t next_file_id;		/* Locked: file ID counter */
 
@@ -295,6 +297,13 @@ struct __wt_connection_impl {
 	uint32_t	 evict_workers;	/* Number of eviction workers */
 	WT_EVICT_WORKER	*evict_workctx;	/* Eviction worker context */
 
+	uint32_t	 evict_writeback_alloc;/* Allocated write-back thread */
+	uint32_t	 evict_writeback;/* Number of write-back threads */
+					/* Write-back thread context */
+	WT_EVICT_WORKER	*evict_writebackctx;
+					/* Write-back thread wait mutex */
+	WT_CONDVAR	*evict_writeback_cond;
+
 	WT_SESSION_IMPL *stat_session;	/* Statistics log session */
 	wt_thread_t	 stat_tid;	/* Statistics log thread */
 	int		 stat_tid_set;	/* Statistics log thread set */
@@ -307,10 +316,11 @@ struct __wt_connection_impl {
 	uint64_t	 stat_usecs;	/* Statistics log period */
 
 #define	WT_CONN_LOG_ARCHIVE	0x01	/* Archive is enabled */
-#define	WT_CONN_LOG_ENABLED	0x02	/* Logging is enabled */
-#define	WT_CONN_LOG_EXISTED	0x04	/* Log files found */
-#define	WT_CONN_LOG_PREALLOC	0x08	/* Pre-allocation is enabled */
-#define	WT_CONN_LOG_RECOVER_ERR	0x10	/* Error if recovery required */
+#define	WT_CONN_LOG_COMPACT	0x02	/* Compact operation format */
+#define	WT_CONN_LOG_ENABLED	0x04	/* Logging is enabled */
+#define	WT_CONN_LOG_EXISTED	0x08	/* Log files found */
+#define	WT_CONN_LOG_PREALLOC	0x10	/* Pre-allocation is enabled */
+#define	WT_CONN_LOG_RECOVER_ERR	0x20	/* Error if recovery required */
 	uint32_t	 log_flags;	/* Global logging configuration */
 	WT_CONDVAR	*log_cond;	/* Log server wait mutex */
 	WT_SESSION_IMPL *log_session;	/* Log server session */
@@ -320,10 +330,14 @@ struct __wt_connection_impl {
 	WT_SESSION_IMPL *log_close_session;/* Log close thread session */
 	wt_thread_t	 log_close_tid;	/* Log close thread thread */
 	int		 log_close_tid_set;/* Log close thread set */
-	WT_CONDVAR	*log_wrlsn_cond;/* Log write lsn thread wait mutex */
-	WT_SESSION_IMPL *log_wrlsn_session;/* Log write lsn thread session */
-	wt_thread_t	 log_wrlsn_tid;	/* Log write lsn thread thread */
-	int		 log_wrlsn_tid_set;/* Log write lsn thread set */
+	WT_CONDVAR	*log_wrlsn_cond;/* Log writer thread wait mutex */
+	WT_SESSION_IMPL *log_wrlsn_session;/* Log writer thread session */
+	wt_thread_t	 log_wrlsn_tid;	/* Log writer thread thread */
+	int		 log_wrlsn_tid_set;/* Log writer thread set */
+	WT_CONDVAR	*log_flush_cond;/* Log flush thread wait mutex */
+	WT_SESSION_IMPL *log_flush_session;/* Log flush thread session */
+	wt_thread_t	 log_flush_tid;	/* Log flush thread thread */
+	int		 log_flush_tid_set;/* Log flush thread set */
 	WT_LOG		*log;		/* Logging structure */
 	WT_COMPRESSOR	*log_compressor;/* Logging compressor */
 	wt_off_t	 log_file_max;	/* Log file max size */
@@ -338,6 +352,19 @@ struct __wt_connection_impl {
 	time_t		 sweep_idle_time;/* Handle sweep idle time */
 	time_t		 sweep_interval;/* Handle sweep interval */
 
+	/*
+	 * Lookaside table: when eviction can't make progress because updates
+	 * are pinned by old snapshots, reconciliation writes the newest
+	 * committed values to disk and moves the older versions into the
+	 * lookaside table, they're read back when the page is read.
+	 */
+	WT_SPINLOCK	 las_lock;	/* Lookaside table cursor lock */
+	WT_SESSION_IMPL *las_session;	/* Lookaside table session */
+	WT_CURSOR	*las_cursor;	/* Lookaside table cursor */
+	uint64_t	 las_counter;	/* Lookaside record counter */
+	int		 las_written;	/* Lookaside table has been written */
+	WT_ITEM		 las_sweep_key;	/* Lookaside sweep position */
+
 					/* Locked: collator list */
 	TAILQ_HEAD(__wt_coll_qh, __wt_named_collator) collqh;
 
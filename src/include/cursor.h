@@ -187,7 +187,8 @@ struct __wt_cursor_btree {
 #define	WT_CBT_ITERATE_NEXT	0x04	/* Next iteration configuration */
 #define	WT_CBT_ITERATE_PREV	0x08	/* Prev iteration configuration */
 #define	WT_CBT_MAX_RECORD	0x10	/* Col-store: past end-of-table */
-#define	WT_CBT_SEARCH_SMALLEST	0x20	/* Row-store: small-key insert list */
+#define	WT_CBT_READ_ONCE	0x20	/* Don't update page read generations */
+#define	WT_CBT_SEARCH_SMALLEST	0x40	/* Row-store: small-key insert list */
 	uint8_t flags;
 };
 
@@ -267,6 +268,7 @@ struct __wt_cursor_log {
 	WT_LSN		*next_lsn;	/* LSN of next record */
 	WT_ITEM		*logrec;	/* Copy of record for cursor */
 	WT_ITEM		*opkey, *opvalue;	/* Op key/value copy */
+	WT_TXN_LOG_KEYS	*keys;		/* Keys of compact operations */
 	const uint8_t	*stepp, *stepp_end;	/* Pointer within record */
 	uint8_t		*packed_key;	/* Packed key for 'raw' interface */
 	uint8_t		*packed_value;	/* Packed value for 'raw' interface */
@@ -43,9 +43,10 @@ __cursor_pos_clear(WT_CURSOR_BTREE *cbt)
 
 	/*
 	 * Don't clear the active flag, it's owned by the cursor enter/leave
-	 * functions.
+	 * functions, or the read-once flag, it's set when the cursor is
+	 * opened.
 	 */
-	F_CLR(cbt, ~WT_CBT_ACTIVE);
+	F_CLR(cbt, ~(WT_CBT_ACTIVE | WT_CBT_READ_ONCE));
 }
 
 /*
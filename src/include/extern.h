@@ -15,6 +15,12 @@ extern int __wt_block_addr_valid(WT_SESSION_IMPL *session, WT_BLOCK *block, cons
 extern int __wt_block_addr_string(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_ITEM *buf, const uint8_t *addr, size_t addr_size);
 extern int __wt_block_buffer_to_ckpt(WT_SESSION_IMPL *session, WT_BLOCK *block, const uint8_t *p, WT_BLOCK_CKPT *ci);
 extern int __wt_block_ckpt_to_buffer(WT_SESSION_IMPL *session, WT_BLOCK *block, uint8_t **pp, WT_BLOCK_CKPT *ci);
+extern int __wt_block_cache_config(WT_SESSION_IMPL *session, const char *cfg[]);
+extern void __wt_block_cache_destroy(WT_SESSION_IMPL *session);
+extern int __wt_block_cache_read(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_ITEM *buf, wt_off_t offset, uint32_t size, uint32_t cksum, int *foundp);
+extern int __wt_block_cache_insert(WT_SESSION_IMPL *session, WT_BLOCK *block, const void *image, wt_off_t offset, uint32_t size, uint32_t cksum);
+extern void __wt_block_cache_remove( WT_SESSION_IMPL *session, WT_BLOCK *block, wt_off_t offset);
+extern void __wt_block_cache_discard(WT_SESSION_IMPL *session, WT_BLOCK *block);
 extern int __wt_block_ckpt_init( WT_SESSION_IMPL *session, WT_BLOCK_CKPT *ci, const char *name);
 extern int __wt_block_checkpoint_load(WT_SESSION_IMPL *session, WT_BLOCK *block, const uint8_t *addr, size_t addr_size, uint8_t *root_addr, size_t *root_addr_sizep, int checkpoint);
 extern int __wt_block_checkpoint_unload( WT_SESSION_IMPL *session, WT_BLOCK *block, int checkpoint);
@@ -95,6 +101,7 @@ extern int __wt_btcur_insert(WT_CURSOR_BTREE *cbt);
 extern int __wt_btcur_update_check(WT_CURSOR_BTREE *cbt);
 extern int __wt_btcur_remove(WT_CURSOR_BTREE *cbt);
 extern int __wt_btcur_update(WT_CURSOR_BTREE *cbt);
+extern int __wt_btcur_batch(WT_CURSOR_BTREE *cbt, WT_BATCH_OPTYPE type);
 extern int __wt_btcur_next_random(WT_CURSOR_BTREE *cbt);
 extern int __wt_btcur_compare(WT_CURSOR_BTREE *a_arg, WT_CURSOR_BTREE *b_arg, int *cmpp);
 extern int __wt_btcur_equals( WT_CURSOR_BTREE *a_arg, WT_CURSOR_BTREE *b_arg, int *equalp);
@@ -174,6 +181,7 @@ extern int __wt_row_insert_alloc(WT_SESSION_IMPL *session, WT_ITEM *key, u_int s
 extern int __wt_update_alloc( WT_SESSION_IMPL *session, WT_ITEM *value, WT_UPDATE **updp, size_t *sizep);
 extern WT_UPDATE *__wt_update_obsolete_check(WT_SESSION_IMPL *session, WT_UPDATE *upd);
 extern void __wt_update_obsolete_free( WT_SESSION_IMPL *session, WT_PAGE *page, WT_UPDATE *upd);
+extern uint64_t __wt_update_obsolete_page(WT_SESSION_IMPL *session, WT_PAGE *page);
 extern int __wt_search_insert( WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, WT_ITEM *srch_key);
 extern int __wt_row_search(WT_SESSION_IMPL *session, WT_ITEM *srch_key, WT_REF *leaf, WT_CURSOR_BTREE *cbt, int insert);
 extern int __wt_row_random(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt);
@@ -221,6 +229,10 @@ extern int __wt_cache_pool_config(WT_SESSION_IMPL *session, const char **cfg);
 extern int __wt_conn_cache_pool_open(WT_SESSION_IMPL *session);
 extern int __wt_conn_cache_pool_destroy(WT_SESSION_IMPL *session);
 extern WT_THREAD_RET __wt_cache_pool_server(void *arg);
+extern int __wt_cache_warmup_save(WT_SESSION_IMPL *session);
+extern int __wt_cache_warmup_skip(WT_SESSION_IMPL *session, WT_REF *ref, int *skipp);
+extern int __wt_cache_warmup_create(WT_SESSION_IMPL *session, const char *cfg[]);
+extern int __wt_cache_warmup_destroy(WT_SESSION_IMPL *session);
 extern int __wt_checkpoint_server_create(WT_SESSION_IMPL *session, const char *cfg[]);
 extern int __wt_checkpoint_server_destroy(WT_SESSION_IMPL *session);
 extern int __wt_checkpoint_signal(WT_SESSION_IMPL *session, wt_off_t logsize);
@@ -235,6 +247,11 @@ extern int __wt_conn_dhandle_discard_single(WT_SESSION_IMPL *session, int final)
 extern int __wt_conn_dhandle_discard(WT_SESSION_IMPL *session);
 extern int __wt_connection_init(WT_CONNECTION_IMPL *conn);
 extern int __wt_connection_destroy(WT_CONNECTION_IMPL *conn);
+extern int __wt_las_create(WT_SESSION_IMPL *session);
+extern int __wt_las_destroy(WT_SESSION_IMPL *session);
+extern void __wt_las_cursor(WT_SESSION_IMPL *session, WT_CURSOR **cursorp);
+extern int __wt_las_cursor_close(WT_SESSION_IMPL *session, WT_CURSOR **cursorp);
+extern int __wt_las_sweep(WT_SESSION_IMPL *session);
 extern int __wt_log_truncate_files( WT_SESSION_IMPL *session, WT_CURSOR *cursor, const char *cfg[]);
 extern int __wt_logmgr_create(WT_SESSION_IMPL *session, const char *cfg[]);
 extern int __wt_logmgr_open(WT_SESSION_IMPL *session);
@@ -257,6 +274,8 @@ extern int __wt_curconfig_open(WT_SESSION_IMPL *session, const char *uri, const
 extern int __wt_curds_open( WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *owner, const char *cfg[], WT_DATA_SOURCE *dsrc, WT_CURSOR **cursorp);
 extern int __wt_curdump_create(WT_CURSOR *child, WT_CURSOR *owner, WT_CURSOR **cursorp);
 extern int __wt_curfile_update_check(WT_CURSOR *cursor);
+extern int __wt_curfile_batch_sorted(WT_CURSOR *cursor);
+extern int __wt_curfile_batch(WT_CURSOR *cursor, WT_BATCH_OP *op);
 extern int __wt_curfile_create(WT_SESSION_IMPL *session, WT_CURSOR *owner, const char *cfg[], int bulk, int bitmap, WT_CURSOR **cursorp);
 extern int __wt_curfile_open(WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *owner, const char *cfg[], WT_CURSOR **cursorp);
 extern int __wt_curindex_open(WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *owner, const char *cfg[], WT_CURSOR **cursorp);
@@ -311,19 +330,26 @@ extern int __wt_evict_file_exclusive_on(WT_SESSION_IMPL *session, int *evict_res
 extern void __wt_evict_file_exclusive_off(WT_SESSION_IMPL *session);
 extern int __wt_evict_lru_page(WT_SESSION_IMPL *session, int is_server);
 extern int __wt_cache_wait(WT_SESSION_IMPL *session, int full);
+extern int __wt_cache_write_throttle(WT_SESSION_IMPL *session, size_t size);
 extern void __wt_cache_dump(WT_SESSION_IMPL *session);
 extern int __wt_evict(WT_SESSION_IMPL *session, WT_REF *ref, int exclusive);
 extern void __wt_evict_page_clean_update(WT_SESSION_IMPL *session, WT_REF *ref);
+extern int __wt_evict_writeback_create(WT_SESSION_IMPL *session, const char *cfg[]);
+extern int __wt_evict_writeback_destroy(WT_SESSION_IMPL *session);
 extern int __wt_log_ckpt(WT_SESSION_IMPL *session, WT_LSN *ckp_lsn);
 extern int __wt_log_needs_recovery(WT_SESSION_IMPL *session, WT_LSN *ckp_lsn, int *rec);
 extern void __wt_log_written_reset(WT_SESSION_IMPL *session);
 extern int __wt_log_get_all_files(WT_SESSION_IMPL *session, char ***filesp, u_int *countp, uint32_t *maxid, int active_only);
 extern void __wt_log_files_free(WT_SESSION_IMPL *session, char **files, u_int count);
 extern int __wt_log_extract_lognum( WT_SESSION_IMPL *session, const char *name, uint32_t *id);
+extern int __wt_log_acquire(WT_SESSION_IMPL *session, uint64_t recsize, WT_LOGSLOT *slot);
 extern int __wt_log_allocfile( WT_SESSION_IMPL *session, uint32_t lognum, const char *dest, int prealloc);
 extern int __wt_log_remove(WT_SESSION_IMPL *session, const char *file_prefix, uint32_t lognum);
 extern int __wt_log_open(WT_SESSION_IMPL *session);
 extern int __wt_log_close(WT_SESSION_IMPL *session);
+extern void __wt_log_error(WT_SESSION_IMPL *session, int error);
+extern int __wt_log_release(WT_SESSION_IMPL *session, WT_LOGSLOT *slot, int *freep);
+extern int __wt_log_flush_once(WT_SESSION_IMPL *session, int *syncedp);
 extern int __wt_log_newfile(WT_SESSION_IMPL *session, int conn_create, int *created);
 extern int __wt_log_read(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp, uint32_t flags);
 extern int __wt_log_scan(WT_SESSION_IMPL *session, WT_LSN *lsnp, uint32_t flags, int (*func)(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp, void *cookie, int firstrecord), void *cookie);
@@ -351,12 +377,17 @@ extern int __wt_logop_row_remove_print( WT_SESSION_IMPL *session, const uint8_t
 extern int __wt_logop_row_truncate_pack( WT_SESSION_IMPL *session, WT_ITEM *logrec, uint32_t fileid, WT_ITEM *start, WT_ITEM *stop, uint32_t mode);
 extern int __wt_logop_row_truncate_unpack( WT_SESSION_IMPL *session, const uint8_t **pp, const uint8_t *end, uint32_t *fileidp, WT_ITEM *startp, WT_ITEM *stopp, uint32_t *modep);
 extern int __wt_logop_row_truncate_print( WT_SESSION_IMPL *session, const uint8_t **pp, const uint8_t *end, FILE *out);
+extern int __wt_logop_row_put_compact_pack( WT_SESSION_IMPL *session, WT_ITEM *logrec, uint32_t fileid, uint32_t prefix, WT_ITEM *suffix, WT_ITEM *value);
+extern int __wt_logop_row_put_compact_unpack( WT_SESSION_IMPL *session, const uint8_t **pp, const uint8_t *end, uint32_t *fileidp, uint32_t *prefixp, WT_ITEM *suffixp, WT_ITEM *valuep);
+extern int __wt_logop_row_put_compact_print( WT_SESSION_IMPL *session, const uint8_t **pp, const uint8_t *end, FILE *out);
+extern int __wt_logop_row_remove_compact_pack( WT_SESSION_IMPL *session, WT_ITEM *logrec, uint32_t fileid, uint32_t prefix, WT_ITEM *suffix);
+extern int __wt_logop_row_remove_compact_unpack( WT_SESSION_IMPL *session, const uint8_t **pp, const uint8_t *end, uint32_t *fileidp, uint32_t *prefixp, WT_ITEM *suffixp);
+extern int __wt_logop_row_remove_compact_print( WT_SESSION_IMPL *session, const uint8_t **pp, const uint8_t *end, FILE *out);
 extern int __wt_txn_op_printlog( WT_SESSION_IMPL *session, const uint8_t **pp, const uint8_t *end, FILE *out);
 extern int __wt_log_slot_init(WT_SESSION_IMPL *session);
 extern int __wt_log_slot_destroy(WT_SESSION_IMPL *session);
-extern int __wt_log_slot_join(WT_SESSION_IMPL *session, uint64_t mysize, uint32_t flags, WT_MYSLOT *myslotp);
-extern int __wt_log_slot_close(WT_SESSION_IMPL *session, WT_LOGSLOT *slot);
-extern int __wt_log_slot_notify(WT_SESSION_IMPL *session, WT_LOGSLOT *slot);
+extern int __wt_log_slot_join(WT_SESSION_IMPL *session, uint64_t mysize, WT_MYSLOT *myslotp);
+extern int __wt_log_slot_switch(WT_SESSION_IMPL *session, WT_LOGSLOT *slot);
 extern int __wt_log_slot_wait(WT_SESSION_IMPL *session, WT_LOGSLOT *slot);
 extern int64_t __wt_log_slot_release(WT_LOGSLOT *slot, uint64_t size);
 extern int __wt_log_slot_free(WT_SESSION_IMPL *session, WT_LOGSLOT *slot);
@@ -479,6 +510,9 @@ extern int __wt_try_writelock(WT_SESSION_IMPL *session, WT_RWLOCK *rwlock);
 extern int __wt_writelock(WT_SESSION_IMPL *session, WT_RWLOCK *rwlock);
 extern int __wt_writeunlock(WT_SESSION_IMPL *session, WT_RWLOCK *rwlock);
 extern int __wt_rwlock_destroy(WT_SESSION_IMPL *session, WT_RWLOCK **rwlockp);
+extern int __wt_numa_topology(WT_SESSION_IMPL *session, u_int nodes_config, uint8_t **cpu_nodep, u_int *cpusp, u_int *nodesp);
+extern u_int __wt_numa_node(WT_SESSION_IMPL *session);
+extern int __wt_numa_bind(WT_SESSION_IMPL *session, u_int node);
 extern int __wt_once(void (*init_routine)(void));
 extern int __wt_open(WT_SESSION_IMPL *session, const char *name, int ok_create, int exclusive, int dio_type, WT_FH **fhp);
 extern int __wt_close(WT_SESSION_IMPL *session, WT_FH **fhp);
@@ -572,6 +606,7 @@ extern int __wt_open_cursor(WT_SESSION_IMPL *session, const char *uri, WT_CURSOR
 extern int __wt_session_create_strip(WT_SESSION *wt_session, const char *v1, const char *v2, char **value_ret);
 extern int __wt_open_internal_session(WT_CONNECTION_IMPL *conn, const char *name, int uses_dhandles, int open_metadata, WT_SESSION_IMPL **sessionp);
 extern int __wt_open_session(WT_CONNECTION_IMPL *conn, WT_EVENT_HANDLER *event_handler, const char *config, WT_SESSION_IMPL **sessionp);
+extern int __wt_session_write_batch( WT_SESSION_IMPL *session, WT_BATCH_OP *ops, uint32_t count);
 extern int __wt_compact_uri_analyze(WT_SESSION_IMPL *session, const char *uri, int *skip);
 extern int __wt_session_compact( WT_SESSION *wt_session, const char *uri, const char *config);
 extern int __wt_session_lock_dhandle(WT_SESSION_IMPL *session, uint32_t flags);
@@ -657,8 +692,13 @@ extern void __wt_stat_refresh_connection_stats(void *stats_arg);
 extern int WT_CDECL __wt_txnid_cmp(const void *v1, const void *v2);
 extern void __wt_txn_release_snapshot(WT_SESSION_IMPL *session);
 extern void __wt_txn_update_oldest(WT_SESSION_IMPL *session);
+extern void __wt_txn_update_pinned_timestamp(WT_SESSION_IMPL *session);
+extern int __wt_txn_global_set_timestamp(WT_SESSION_IMPL *session, const char *cfg[]);
 extern void __wt_txn_refresh(WT_SESSION_IMPL *session, int get_snapshot);
+extern uint64_t __wt_txn_id_batch(WT_SESSION_IMPL *session);
 extern int __wt_txn_begin(WT_SESSION_IMPL *session, const char *cfg[]);
+extern int __wt_txn_reserve(WT_SESSION_IMPL *session, u_int count, size_t logsize);
+extern int __wt_txn_conflict_wait(WT_SESSION_IMPL *session, WT_UPDATE *upd);
 extern void __wt_txn_release(WT_SESSION_IMPL *session);
 extern int __wt_txn_commit(WT_SESSION_IMPL *session, const char *cfg[]);
 extern int __wt_txn_rollback(WT_SESSION_IMPL *session, const char *cfg[]);
@@ -678,12 +718,26 @@ extern int __wt_ext_transaction_isolation_level( WT_EXTENSION_API *wt_api, WT_SE
 extern int __wt_ext_transaction_notify( WT_EXTENSION_API *wt_api, WT_SESSION *wt_session, WT_TXN_NOTIFY *notify);
 extern uint64_t __wt_ext_transaction_oldest(WT_EXTENSION_API *wt_api);
 extern int __wt_ext_transaction_visible( WT_EXTENSION_API *wt_api, WT_SESSION *wt_session, uint64_t transaction_id);
+extern void __wt_txn_log_keys_reset(WT_TXN_LOG_KEYS *keys);
+extern void __wt_txn_log_keys_free(WT_SESSION_IMPL *session, WT_TXN_LOG_KEYS *keys);
+extern int __wt_txn_log_key_decode(WT_SESSION_IMPL *session, WT_TXN_LOG_KEYS *keys, uint32_t fileid, uint32_t prefix, WT_ITEM *suffix, WT_ITEM *key);
 extern void __wt_txn_op_free(WT_SESSION_IMPL *session, WT_TXN_OP *op);
 extern int __wt_txn_log_op(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt);
+extern int __wt_txn_log_reserve(WT_SESSION_IMPL *session, size_t size);
 extern int __wt_txn_log_commit(WT_SESSION_IMPL *session, const char *cfg[]);
+extern int __wt_txn_log_prepare( WT_SESSION_IMPL *session, uint64_t prepare_id, WT_LSN *lsnp);
+extern int __wt_txn_log_prepare_resolve(WT_SESSION_IMPL *session, int commit);
 extern int __wt_txn_checkpoint_logread( WT_SESSION_IMPL *session, const uint8_t **pp, const uint8_t *end, WT_LSN *ckpt_lsn);
 extern int __wt_txn_checkpoint_log( WT_SESSION_IMPL *session, int full, uint32_t flags, WT_LSN *lsnp);
 extern int __wt_txn_truncate_log( WT_SESSION_IMPL *session, WT_CURSOR_BTREE *start, WT_CURSOR_BTREE *stop);
 extern int __wt_txn_truncate_end(WT_SESSION_IMPL *session);
 extern int __wt_txn_printlog(WT_SESSION *wt_session, FILE *out);
+extern int __wt_txn_prepare(WT_SESSION_IMPL *session, const char *cfg[]);
+extern void __wt_txn_prepare_clear(WT_SESSION_IMPL *session, int committed);
+extern void __wt_txn_prepare_detach(WT_SESSION_IMPL *session);
+extern void __wt_txn_prepare_pin( WT_SESSION_IMPL *session, WT_LSN *ckpt_lsn, WT_LSN *recover_lsn);
+extern int __wt_txn_prepare_recover(WT_SESSION_IMPL *session, WT_SESSION_IMPL *txn_session, uint64_t prepare_id, WT_LSN *lsnp);
+extern int __wt_txn_prepare_resolve(WT_SESSION_IMPL *session, uint64_t prepare_id, const char *cfg[], int commit);
+extern int __wt_txn_prepare_close(WT_SESSION_IMPL *session);
+extern void __wt_txn_prepare_destroy(WT_SESSION_IMPL *session);
 extern int __wt_txn_recover(WT_SESSION_IMPL *session);
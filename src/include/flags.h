@@ -35,10 +35,12 @@
 #define	WT_READ_NO_EVICT				0x00000004
 #define	WT_READ_NO_GEN					0x00000008
 #define	WT_READ_NO_WAIT					0x00000010
-#define	WT_READ_PREV					0x00000020
-#define	WT_READ_SKIP_INTL				0x00000040
-#define	WT_READ_TRUNCATE				0x00000080
-#define	WT_READ_WONT_NEED				0x00000100
+#define	WT_READ_ONCE					0x00000020
+#define	WT_READ_PREV					0x00000040
+#define	WT_READ_SKIP_INTL				0x00000080
+#define	WT_READ_TRUNCATE				0x00000100
+#define	WT_READ_WARMUP					0x00000200
+#define	WT_READ_WONT_NEED				0x00000400
 #define	WT_SESSION_CAN_WAIT				0x00000001
 #define	WT_SESSION_CLEAR_EVICT_WALK			0x00000002
 #define	WT_SESSION_DISCARD_FORCE			0x00000004
@@ -55,7 +57,8 @@
 #define	WT_SESSION_SERVER_ASYNC				0x00002000
 #define	WT_SESSION_TABLE_LOCKED				0x00004000
 #define	WT_SKIP_UPDATE_ERR				0x00000002
-#define	WT_SKIP_UPDATE_RESTORE				0x00000004
+#define	WT_SKIP_UPDATE_LOOKASIDE			0x00000004
+#define	WT_SKIP_UPDATE_RESTORE				0x00000008
 #define	WT_SYNC_CHECKPOINT				0x00000001
 #define	WT_SYNC_CLOSE					0x00000002
 #define	WT_SYNC_DISCARD					0x00000004
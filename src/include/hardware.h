@@ -59,3 +59,10 @@
 } while (0)
 
 #define	WT_CACHE_LINE_ALIGNMENT	64	/* Cache line alignment */
+
+/*
+ * Padding between structure members written by different threads: the members
+ * either side of the pad never share a cache line, whatever the alignment of
+ * the enclosing structure.
+ */
+#define	WT_CACHE_LINE_PAD(name)	uint8_t name[WT_CACHE_LINE_ALIGNMENT]
@@ -59,41 +59,56 @@
 
 /*
  * Possible values for the consolidation array slot states:
- * (NOTE: Any new states must be > WT_LOG_SLOT_DONE and < WT_LOG_SLOT_READY.)
  *
- * < WT_LOG_SLOT_DONE - threads are actively writing to the log.
- * WT_LOG_SLOT_DONE - all activity on this slot is complete.
  * WT_LOG_SLOT_FREE - slot is available for allocation.
- * WT_LOG_SLOT_PENDING - slot is transitioning from ready to active.
- * WT_LOG_SLOT_WRITTEN - slot is written and should be processed by worker.
- * WT_LOG_SLOT_READY - slot is ready for threads to join.
- * > WT_LOG_SLOT_READY - threads are actively consolidating on this slot.
+ * WT_LOG_SLOT_PENDING - slot is being changed by a single thread.
+ * WT_LOG_SLOT_READY - slot is filled and should be written by the writer.
+ * WT_LOG_SLOT_WRITTEN - slot is written and should be processed by writer.
+ * >= WT_LOG_SLOT_ACTIVE - threads are actively consolidating on this slot.
+ *
+ * An active slot's state packs the number of bytes threads have joined, the
+ * number of bytes threads have released once their records are copied into
+ * the slot's buffer, a flag set when the slot is closed to joins and a flag
+ * set when log space is allocated for the slot.  Threads join and release
+ * the slot with atomic operations on the state, the thread whose operation
+ * leaves the slot allocated with all the bytes it joined released, writes the
+ * slot.
  */
-#define	WT_LOG_SLOT_DONE	0
-#define	WT_LOG_SLOT_FREE	1
-#define	WT_LOG_SLOT_PENDING	2
-#define	WT_LOG_SLOT_WRITTEN	3
-#define	WT_LOG_SLOT_READY	4
+#define	WT_LOG_SLOT_FREE	(-1)
+#define	WT_LOG_SLOT_PENDING	(-2)
+#define	WT_LOG_SLOT_WRITTEN	(-3)
+#define	WT_LOG_SLOT_READY	(-4)
+#define	WT_LOG_SLOT_ACTIVE	0
+
+#define	WT_LOG_SLOT_BITS	30		/* Bits for joined, released */
+#define	WT_LOG_SLOT_MASK	(((int64_t)1 << WT_LOG_SLOT_BITS) - 1)
+#define	WT_LOG_SLOT_BUF_MAX	((int64_t)1 << (WT_LOG_SLOT_BITS - 1))
+#define	WT_LOG_SLOT_CLOSE	((int64_t)1 << 60)	/* Closed to joins */
+#define	WT_LOG_SLOT_ALLOCATED	((int64_t)1 << 61)	/* Space allocated */
+
+#define	WT_LOG_SLOT_JOINED(state)	((state) & WT_LOG_SLOT_MASK)
+#define	WT_LOG_SLOT_RELEASED(state)					\
+	(((state) >> WT_LOG_SLOT_BITS) & WT_LOG_SLOT_MASK)
+#define	WT_LOG_SLOT_RELEASE(size)	((int64_t)(size) << WT_LOG_SLOT_BITS)
+#define	WT_LOG_SLOT_DONE(state)						\
+	(((state) & WT_LOG_SLOT_ALLOCATED) != 0 &&			\
+	WT_LOG_SLOT_JOINED(state) == WT_LOG_SLOT_RELEASED(state))
 typedef WT_COMPILER_TYPE_ALIGN(WT_CACHE_LINE_ALIGNMENT) struct {
 	int64_t	 slot_state;		/* Slot state */
 	uint64_t slot_group_size;	/* Group size */
 	int32_t	 slot_error;		/* Error value */
-#define	SLOT_INVALID_INDEX	0xffffffff
-	uint32_t slot_index;		/* Active slot index */
+	uint32_t slot_index;		/* Slot's index in the pool */
 	wt_off_t slot_start_offset;	/* Starting file offset */
 	WT_LSN	slot_release_lsn;	/* Slot release LSN */
 	WT_LSN	slot_start_lsn;		/* Slot starting LSN */
 	WT_LSN	slot_end_lsn;		/* Slot ending LSN */
 	WT_FH	*slot_fh;		/* File handle for this group */
 	WT_ITEM slot_buf;		/* Buffer for grouped writes */
-	int32_t	slot_churn;		/* Active slots are scarce. */
 
 #define	SLOT_BUF_GROW	0x01			/* Grow buffer on release */
 #define	SLOT_BUFFERED	0x02			/* Buffer writes */
 #define	SLOT_CLOSEFH	0x04			/* Close old fh on release */
-#define	SLOT_SYNC	0x08			/* Needs sync on release */
-#define	SLOT_SYNC_DIR	0x10			/* Directory sync on release */
-	uint32_t flags;			/* Flags */
+	uint8_t flags_atomic;		/* Atomic flags, use F_*_ATOMIC */
 } WT_LOGSLOT;
 
 #define	SLOT_INIT_FLAGS	(SLOT_BUFFERED)
@@ -127,13 +142,17 @@ typedef struct {
 	WT_LSN		first_lsn;	/* First LSN */
 	WT_LSN		sync_dir_lsn;	/* LSN of the last directory sync */
 	WT_LSN		sync_lsn;	/* LSN of the last sync */
+	WT_LSN		sync_dir_req_lsn;/* Directory sync requested */
+	WT_LSN		sync_req_lsn;	/* Sync requested */
 	WT_LSN		trunc_lsn;	/* End LSN for recovery truncation */
 	WT_LSN		write_lsn;	/* Last LSN written to log file */
 
+	int32_t		 log_error;	/* Failed write or sync of the log */
+
 	/*
 	 * Synchronization resources
 	 */
-	WT_SPINLOCK      log_lock;      /* Locked: Logging fields */
+	WT_SPINLOCK      log_lock;      /* Locked: write LSN, sync requests */
 	WT_SPINLOCK      log_slot_lock; /* Locked: Consolidation array */
 	WT_SPINLOCK      log_sync_lock; /* Locked: Single-thread fsync */
 
@@ -146,15 +165,14 @@ typedef struct {
 
 	/*
 	 * Consolidation array information
-	 * SLOT_ACTIVE must be less than SLOT_POOL.
-	 * Our testing shows that the more consolidation we generate the
-	 * better the performance we see which equates to an active slot
-	 * slot count of one.
+	 * Threads consolidate into a single active slot: our testing shows
+	 * that the more consolidation we generate the better the performance
+	 * we see.  Slots are used from the pool in turn, a closed slot is
+	 * replaced by the next slot in the pool, and is written while threads
+	 * join its replacement.
 	 */
-#define	SLOT_ACTIVE	1
 #define	SLOT_POOL	16
-	uint32_t	 pool_index;		/* Global pool index */
-	WT_LOGSLOT	*slot_array[SLOT_ACTIVE];	/* Active slots */
+	WT_LOGSLOT	*active_slot;		/* Active slot */
 	WT_LOGSLOT	 slot_pool[SLOT_POOL];	/* Pool of all slots */
 
 #define	WT_LOG_FORCE_CONSOLIDATE	0x01	/* Disable direct writes */
@@ -12,6 +12,9 @@
 #define	WT_BASECONFIG		"WiredTiger.basecfg"	/* Base configuration */
 #define	WT_BASECONFIG_SET	"WiredTiger.basecfg.set"/* Base config temp */
 
+#define	WT_CACHE_RESIDENT	"WiredTiger.resident"	/* Cache warm-up list */
+#define	WT_CACHE_RESIDENT_SET	"WiredTiger.resident.set"/* Warm-up temp */
+
 #define	WT_USERCONFIG		"WiredTiger.config"	/* User configuration */
 
 #define	WT_METADATA_BACKUP	"WiredTiger.backup"	/* Hot backup file */
@@ -22,6 +25,7 @@
 
 #define	WT_METADATA_URI		"metadata:"		/* Metadata alias */
 #define	WT_METAFILE_URI		"file:WiredTiger.wt"	/* Metadata file URI */
+#define	WT_LAS_URI		"file:WiredTigerLAS.wt"	/* Lookaside table */
 
 /*
  * Pre computed hash for the metadata file. Used to optimize comparisons
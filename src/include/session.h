@@ -113,6 +113,10 @@ struct WT_COMPILER_TYPE_ALIGN(WT_CACHE_LINE_ALIGNMENT) __wt_session_impl {
 
 	WT_TXN_ISOLATION isolation;
 	WT_TXN	txn;			/* Transaction state */
+
+	uint64_t evict_wait_max;	/* Eviction usecs per operation */
+	u_int	 evict_pages_max;	/* Eviction pages per operation */
+	u_int	 cache_requests;	/* Page requests not yet counted */
 	u_int	ncursors;		/* Count of active file cursors. */
 
 	void	*block_manager;		/* Block-manager support */
@@ -181,9 +185,14 @@ struct WT_COMPILER_TYPE_ALIGN(WT_CACHE_LINE_ALIGNMENT) __wt_session_impl {
 #define	WT_SESSION_FIRST_USE(s)						\
 	((s)->hazard == NULL)
 
-	/* The number of hazard pointers grows dynamically. */
-#define	WT_HAZARD_INCR		10
-	uint32_t   hazard_size;		/* Allocated slots in hazard array. */
+	/*
+	 * Threads checking for hazard pointers only review the slots below
+	 * the published in-use count, which is zero for sessions holding no
+	 * hazard pointers, so idle sessions cost a single read.  Keep the
+	 * count and the array pointer together so the check reads one cache
+	 * line per session.
+	 */
 	uint32_t   nhazard;		/* Count of active hazard pointers */
+	volatile uint32_t hazard_inuse;	/* Slots in use, set or not */
 	WT_HAZARD *hazard;		/* Hazard pointer array */
 };
@@ -148,6 +148,11 @@ struct __wt_connection_stats {
 	WT_STATS block_byte_map_read;
 	WT_STATS block_byte_read;
 	WT_STATS block_byte_write;
+	WT_STATS block_cache_bytes;
+	WT_STATS block_cache_evict;
+	WT_STATS block_cache_hit;
+	WT_STATS block_cache_insert;
+	WT_STATS block_cache_miss;
 	WT_STATS block_map_read;
 	WT_STATS block_preload;
 	WT_STATS block_read;
@@ -157,10 +162,12 @@ struct __wt_connection_stats {
 	WT_STATS cache_bytes_inuse;
 	WT_STATS cache_bytes_leaf;
 	WT_STATS cache_bytes_max;
+	WT_STATS cache_bytes_numa_max;
 	WT_STATS cache_bytes_overflow;
 	WT_STATS cache_bytes_read;
 	WT_STATS cache_bytes_write;
 	WT_STATS cache_eviction_app;
+	WT_STATS cache_eviction_app_budget;
 	WT_STATS cache_eviction_checkpoint;
 	WT_STATS cache_eviction_clean;
 	WT_STATS cache_eviction_deepen;
@@ -171,21 +178,43 @@ struct __wt_connection_stats {
 	WT_STATS cache_eviction_force_fail;
 	WT_STATS cache_eviction_hazard;
 	WT_STATS cache_eviction_internal;
+	WT_STATS cache_eviction_lookaside;
 	WT_STATS cache_eviction_maximum_page_size;
+	WT_STATS cache_eviction_numa_remote;
+	WT_STATS cache_eviction_numa_skip;
+	WT_STATS cache_eviction_queue_busy;
 	WT_STATS cache_eviction_queue_empty;
 	WT_STATS cache_eviction_queue_not_empty;
+	WT_STATS cache_eviction_queue_other;
+	WT_STATS cache_eviction_queue_stall;
+	WT_STATS cache_eviction_quota;
+	WT_STATS cache_eviction_second_chance;
 	WT_STATS cache_eviction_server_evicting;
 	WT_STATS cache_eviction_server_not_evicting;
 	WT_STATS cache_eviction_slow;
 	WT_STATS cache_eviction_split;
 	WT_STATS cache_eviction_walk;
+	WT_STATS cache_eviction_walk_score_skip;
 	WT_STATS cache_eviction_worker_evicting;
+	WT_STATS cache_eviction_worker_walk;
 	WT_STATS cache_inmem_split;
+	WT_STATS cache_lookaside_insert;
+	WT_STATS cache_lookaside_remove;
+	WT_STATS cache_obsolete_pages;
+	WT_STATS cache_obsolete_updates;
 	WT_STATS cache_overhead;
 	WT_STATS cache_pages_dirty;
 	WT_STATS cache_pages_inuse;
+	WT_STATS cache_pool_pressure;
 	WT_STATS cache_read;
+	WT_STATS cache_read_lookaside;
+	WT_STATS cache_read_once;
+	WT_STATS cache_warmup_read;
+	WT_STATS cache_warmup_saved;
 	WT_STATS cache_write;
+	WT_STATS cache_write_throttle;
+	WT_STATS cache_write_throttle_time;
+	WT_STATS cache_writeback;
 	WT_STATS cond_wait;
 	WT_STATS cursor_create;
 	WT_STATS cursor_insert;
@@ -196,6 +225,9 @@ struct __wt_connection_stats {
 	WT_STATS cursor_search;
 	WT_STATS cursor_search_near;
 	WT_STATS cursor_update;
+	WT_STATS cursor_write_batch;
+	WT_STATS cursor_write_batch_leaf;
+	WT_STATS cursor_write_batch_ops;
 	WT_STATS dh_conn_handles;
 	WT_STATS dh_conn_ref;
 	WT_STATS dh_conn_sweeps;
@@ -208,6 +240,7 @@ struct __wt_connection_stats {
 	WT_STATS log_bytes_payload;
 	WT_STATS log_bytes_written;
 	WT_STATS log_close_yields;
+	WT_STATS log_compact_saved;
 	WT_STATS log_compress_len;
 	WT_STATS log_compress_mem;
 	WT_STATS log_compress_small;
@@ -218,21 +251,23 @@ struct __wt_connection_stats {
 	WT_STATS log_prealloc_max;
 	WT_STATS log_prealloc_used;
 	WT_STATS log_reads;
+	WT_STATS log_release_waits;
 	WT_STATS log_release_write_lsn;
 	WT_STATS log_scan_records;
 	WT_STATS log_scan_rereads;
 	WT_STATS log_scans;
+	WT_STATS log_slot_allocate_waits;
 	WT_STATS log_slot_closes;
 	WT_STATS log_slot_consolidated;
+	WT_STATS log_slot_join_retries;
 	WT_STATS log_slot_joins;
-	WT_STATS log_slot_races;
-	WT_STATS log_slot_switch_fails;
-	WT_STATS log_slot_toobig;
+	WT_STATS log_slot_switch_waits;
 	WT_STATS log_slot_toosmall;
-	WT_STATS log_slot_transitions;
 	WT_STATS log_sync;
 	WT_STATS log_sync_dir;
+	WT_STATS log_sync_requests;
 	WT_STATS log_write_lsn;
+	WT_STATS log_writer_writes;
 	WT_STATS log_writes;
 	WT_STATS lsm_checkpoint_throttle;
 	WT_STATS lsm_merge_throttle;
@@ -270,10 +305,25 @@ struct __wt_connection_stats {
 	WT_STATS txn_checkpoint_time_recent;
 	WT_STATS txn_checkpoint_time_total;
 	WT_STATS txn_commit;
+	WT_STATS txn_conflict_wait;
+	WT_STATS txn_conflict_wait_abort;
+	WT_STATS txn_conflict_wait_time;
+	WT_STATS txn_conflict_wait_timeout;
+	WT_STATS txn_conflict_wound;
 	WT_STATS txn_fail_cache;
+	WT_STATS txn_id_batch;
 	WT_STATS txn_pinned_checkpoint_range;
 	WT_STATS txn_pinned_range;
+	WT_STATS txn_prepare;
+	WT_STATS txn_prepare_commit;
+	WT_STATS txn_prepare_recover;
+	WT_STATS txn_prepare_rollback;
+	WT_STATS txn_read_chain;
+	WT_STATS txn_read_chain_entries;
+	WT_STATS txn_readonly;
+	WT_STATS txn_readonly_update;
 	WT_STATS txn_rollback;
+	WT_STATS txn_update_conflict;
 	WT_STATS write_io;
 };
 
@@ -316,6 +366,7 @@ struct __wt_dsrc_stats {
 	WT_STATS btree_overflow;
 	WT_STATS btree_row_internal;
 	WT_STATS btree_row_leaf;
+	WT_STATS cache_bytes_inuse;
 	WT_STATS cache_bytes_read;
 	WT_STATS cache_bytes_write;
 	WT_STATS cache_eviction_checkpoint;
@@ -326,11 +377,15 @@ struct __wt_dsrc_stats {
 	WT_STATS cache_eviction_hazard;
 	WT_STATS cache_eviction_internal;
 	WT_STATS cache_eviction_split;
+	WT_STATS cache_eviction_walk;
+	WT_STATS cache_eviction_walk_passes;
+	WT_STATS cache_eviction_walk_queued;
 	WT_STATS cache_inmem_split;
 	WT_STATS cache_overflow_value;
 	WT_STATS cache_read;
 	WT_STATS cache_read_overflow;
 	WT_STATS cache_write;
+	WT_STATS cache_writeback;
 	WT_STATS compress_raw_fail;
 	WT_STATS compress_raw_fail_temporary;
 	WT_STATS compress_raw_ok;
@@ -9,13 +9,28 @@
 #define	WT_TXN_NONE	0		/* No txn running in a session. */
 #define	WT_TXN_FIRST	1		/* First transaction to run. */
 #define	WT_TXN_ABORTED	UINT64_MAX	/* Update rolled back, ignore. */
+#define	WT_TXN_PENDING	(UINT64_MAX - 1)/* Waiting for an ID. */
+
+/*
+ * When threads race to allocate transaction IDs, one of them allocates IDs for
+ * up to this many waiting threads at once.
+ */
+#define	WT_TXN_ID_BATCH_MAX	64
+
+/*
+ * Transactions waiting for a conflicting transaction to resolve wake up at
+ * least this often (microseconds), in case they missed a signal.
+ */
+#define	WT_TXN_CONFLICT_WAIT	10000
 
 /*
  * Transaction ID comparison dealing with edge cases.
  *
  * WT_TXN_ABORTED is the largest possible ID (never visible to a running
  * transaction), WT_TXN_NONE is smaller than any possible ID (visible to all
- * running transactions).
+ * running transactions).  WT_TXN_PENDING is published by threads waiting for
+ * an ID and is newer than any ID that will be allocated, so scans of the
+ * running transactions can treat it as an ordinary ID.
  */
 #define	TXNID_LE(t1, t2)						\
 	((t1) <= (t2))
@@ -28,10 +43,26 @@
 struct WT_COMPILER_TYPE_ALIGN(WT_CACHE_LINE_ALIGNMENT) __wt_txn_state {
 	volatile uint64_t id;
 	volatile uint64_t snap_min;
+	volatile uint64_t read_timestamp;
+
+	/*
+	 * Update conflicts: transactions waiting for this transaction to
+	 * resolve sleep on the condition variable, and a transaction with a
+	 * higher precedence sets "wounded" to this transaction's ID to ask it
+	 * to roll back.
+	 */
+	volatile int32_t priority;
+	volatile uint32_t waiters;
+	volatile uint64_t wounded;
+	WT_CONDVAR *conflict_cond;
 };
 
 struct __wt_txn_global {
-	volatile uint64_t current;	/* Current transaction ID. */
+	/*
+	 * The fields below are read by every thread building a snapshot and
+	 * rarely written, keep them apart from the counters each transaction
+	 * updates.
+	 */
 
 	/* The oldest running transaction ID (may race). */
 	uint64_t last_running;
@@ -45,9 +76,6 @@ struct __wt_txn_global {
 	/* The oldest session found in the last scan. */
 	uint32_t oldest_session;
 
-	/* Count of scanning threads, or -1 for exclusive access. */
-	volatile int32_t scan_count;
-
 	/*
 	 * Track information about the running checkpoint. The transaction IDs
 	 * used when checkpointing are special. Checkpoints can run for a long
@@ -59,7 +87,66 @@ struct __wt_txn_global {
 	volatile uint64_t checkpoint_id;
 	volatile uint64_t checkpoint_snap_min;
 
-	WT_TXN_STATE *states;		/* Per-session transaction states */
+	/*
+	 * The oldest timestamp set by the application, and the timestamp
+	 * before which updates are visible to all readers: the oldest
+	 * timestamp, or the oldest read timestamp of a running transaction
+	 * if that's older.
+	 */
+	volatile uint64_t oldest_timestamp;
+	volatile uint64_t pinned_timestamp;
+
+	/* Prepared transactions, in prepare order. */
+	WT_SPINLOCK prepare_lock;
+	TAILQ_HEAD(__wt_txn_prepared_qh, __wt_txn_prepared) prepareqh;
+
+	/*
+	 * Per-session transaction states, each on its own cache line: the
+	 * array is allocated with a spare entry and aligned within it.
+	 */
+	WT_TXN_STATE *states;
+	void *states_alloc;
+
+	/*
+	 * One byte per session, set while the session may have an ID or a
+	 * snap_min published in its state.  Threads building a snapshot read
+	 * the map a word at a time and only visit the states of sessions that
+	 * are running transactions, so the cost of a snapshot depends on the
+	 * number of running transactions rather than the number of sessions.
+	 * The map is padded to a multiple of the word size.
+	 */
+	uint8_t *active;
+
+	/*
+	 * Every transaction allocating an ID updates the current ID and every
+	 * snapshot updates the scan count: give each its own cache line.
+	 */
+	WT_CACHE_LINE_PAD(pad_current);
+	volatile uint64_t current;	/* Current transaction ID. */
+
+	/* Held by the thread allocating IDs for a batch of waiting threads. */
+	volatile uint32_t id_batch_lock;
+	WT_CACHE_LINE_PAD(pad_scan_count);
+
+	/* Count of scanning threads, or -1 for exclusive access. */
+	volatile int32_t scan_count;
+	WT_CACHE_LINE_PAD(pad_end);
+};
+
+/*
+ * WT_TXN_PREPARED --
+ *	A prepared transaction whose prepare record is in the log.  The log
+ *	isn't archived past the record until the transaction is resolved, and
+ *	transactions recovered when the database is opened are held by an
+ *	internal session until the application resolves them.
+ */
+struct __wt_txn_prepared {
+	uint64_t prepare_id;		/* Application's identifier */
+	WT_LSN	 lsn;			/* Prepare record LSN */
+	WT_SESSION_IMPL *session;	/* Recovered transaction's session */
+	int	 logged;		/* Has a prepare record */
+
+	TAILQ_ENTRY(__wt_txn_prepared) q;
 };
 
 typedef enum __wt_txn_isolation {
@@ -106,6 +193,21 @@ struct __wt_txn_op {
 	} u;
 };
 
+/*
+ * WT_TXN_LOG_KEYS --
+ *	The last row-store key of each file in a log record: operations in
+ *	compact log records store their key as the length of the prefix it
+ *	shares with that key, and the rest of the key.
+ */
+struct __wt_txn_log_keys {
+	struct __wt_txn_log_key {
+		uint32_t fileid;	/* File ID */
+		WT_ITEM	 key;		/* Last key of the file */
+	} *keys;
+	size_t	 keys_alloc;		/* Allocated size of keys array */
+	u_int	 nkeys;			/* Files in the record */
+};
+
 /*
  * WT_TXN --
  *	Per-session transaction context.
@@ -126,6 +228,23 @@ struct __wt_txn {
 	uint32_t snapshot_count;
 	uint32_t txn_logsync;	/* Log sync configuration */
 
+	/*
+	 * Timestamp data: a transaction reading at a timestamp doesn't see
+	 * updates committed with a later timestamp.
+	 */
+	uint64_t read_timestamp;
+
+	/*
+	 * Update conflicts: how long to wait for a conflicting transaction to
+	 * resolve before rolling back, and the priority used to decide which
+	 * of two conflicting transactions waits.
+	 */
+	uint64_t conflict_timeout;	/* Microseconds, 0 to never wait */
+	int32_t priority;
+
+	/* The transaction's entry in the list of prepared transactions. */
+	WT_TXN_PREPARED *prepared;
+
 	/* Array of modifications by this transaction. */
 	WT_TXN_OP      *mod;
 	size_t		mod_alloc;
@@ -133,12 +252,14 @@ struct __wt_txn {
 
 	/* Scratch buffer for in-memory log records. */
 	WT_ITEM	       *logrec;
+	WT_TXN_LOG_KEYS log_keys;	/* Keys of compact log records */
 
 	/* Requested notification when transactions are resolved. */
 	WT_TXN_NOTIFY *notify;
 
 	/* Checkpoint status. */
 	WT_LSN		ckpt_lsn;
+	WT_LSN		ckpt_recover_lsn;	/* Where recovery starts */
 	int		full_ckpt;
 	uint32_t	ckpt_nsnapshot;
 	WT_ITEM		*ckpt_snapshot;
@@ -147,6 +268,8 @@ struct __wt_txn {
 #define	TXN_ERROR		0x02
 #define	TXN_HAS_ID	        0x04
 #define	TXN_HAS_SNAPSHOT	0x08
-#define	TXN_RUNNING		0x10
+#define	TXN_PREPARED		0x10
+#define	TXN_READONLY		0x20
+#define	TXN_RUNNING		0x40
 	uint32_t flags;
 };
@@ -7,6 +7,7 @@
  */
 
 static inline int __wt_txn_id_check(WT_SESSION_IMPL *session);
+static inline int __wt_txn_wounded_check(WT_SESSION_IMPL *session);
 static inline void __wt_txn_read_last(WT_SESSION_IMPL *session);
 
 /*
@@ -28,6 +29,12 @@ __txn_next_op(WT_SESSION_IMPL *session, WT_TXN_OP **opp)
 	WT_RET(__wt_txn_id_check(session));
 	WT_ASSERT(session, F_ISSET(txn, TXN_HAS_ID));
 
+	/*
+	 * A transaction we conflicted with may have asked us to roll back so
+	 * it can proceed.
+	 */
+	WT_RET(__wt_txn_wounded_check(session));
+
 	WT_RET(__wt_realloc_def(session, &txn->mod_alloc,
 	    txn->mod_count + 1, &txn->mod));
 
@@ -65,6 +72,15 @@ __wt_txn_modify(WT_SESSION_IMPL *session, WT_UPDATE *upd)
 	WT_DECL_RET;
 	WT_TXN_OP *op;
 
+	/*
+	 * Updates to the lookaside table are written by eviction on behalf of
+	 * committed transactions, they're visible to everyone immediately.
+	 */
+	if (F_ISSET(S2BT(session), WT_BTREE_LOOKASIDE)) {
+		upd->txnid = WT_TXN_NONE;
+		return (0);
+	}
+
 	WT_RET(__txn_next_op(session, &op));
 	op->type = F_ISSET(session, WT_SESSION_LOGGING_INMEM) ?
 	    TXN_OP_INMEM : TXN_OP_BASIC;
@@ -128,6 +144,29 @@ __wt_txn_visible_all(WT_SESSION_IMPL *session, uint64_t id)
 	return (TXNID_LT(id, oldest_id));
 }
 
+/*
+ * __wt_txn_timestamp_visible_all --
+ *	Check if a given commit timestamp is visible to every reader.
+ */
+static inline int
+__wt_txn_timestamp_visible_all(WT_SESSION_IMPL *session, uint64_t timestamp)
+{
+	return (timestamp <= S2C(session)->txn_global.pinned_timestamp);
+}
+
+/*
+ * __wt_txn_upd_visible_all --
+ *	Check if a given update is "globally visible": its transaction must be
+ *	globally visible, and every reader at a timestamp must see its commit
+ *	timestamp.
+ */
+static inline int
+__wt_txn_upd_visible_all(WT_SESSION_IMPL *session, WT_UPDATE *upd)
+{
+	return (__wt_txn_visible_all(session, upd->txnid) &&
+	    __wt_txn_timestamp_visible_all(session, upd->timestamp));
+}
+
 /*
  * __wt_txn_visible --
  *	Can the current transaction see the given ID?
@@ -190,6 +229,31 @@ __wt_txn_visible(WT_SESSION_IMPL *session, uint64_t id)
 	    sizeof(uint64_t), __wt_txnid_cmp) == NULL);
 }
 
+/*
+ * __wt_txn_upd_visible --
+ *	Can the current transaction see the given update?
+ */
+static inline int
+__wt_txn_upd_visible(WT_SESSION_IMPL *session, WT_UPDATE *upd)
+{
+	WT_TXN *txn;
+
+	txn = &session->txn;
+
+	/* Eviction writes updates only once all readers can see them. */
+	if (txn->isolation == TXN_ISO_EVICTION)
+		return (__wt_txn_upd_visible_all(session, upd));
+
+	/*
+	 * A transaction reading at a timestamp doesn't see updates committed
+	 * after it, our own updates have no timestamp until we commit.
+	 */
+	if (txn->read_timestamp != 0 && upd->timestamp > txn->read_timestamp)
+		return (0);
+
+	return (__wt_txn_visible(session, upd->txnid));
+}
+
 /*
  * __wt_txn_read --
  *	Get the first visible update in a list (or NULL if none are visible).
@@ -197,8 +261,20 @@ __wt_txn_visible(WT_SESSION_IMPL *session, uint64_t id)
 static inline WT_UPDATE *
 __wt_txn_read(WT_SESSION_IMPL *session, WT_UPDATE *upd)
 {
-	while (upd != NULL && !__wt_txn_visible(session, upd->txnid))
-		upd = upd->next;
+	uint64_t entries;
+
+	if (upd == NULL)
+		return (NULL);
+
+	/*
+	 * Track the length of the update chains we walk: long chains of
+	 * updates no reader can see slow every read of the key.
+	 */
+	for (entries = 1; !__wt_txn_upd_visible(session, upd); ++entries)
+		if ((upd = upd->next) == NULL)
+			break;
+	WT_STAT_FAST_CONN_INCR(session, txn_read_chain);
+	WT_STAT_FAST_CONN_INCRV(session, txn_read_chain_entries, entries);
 
 	return (upd);
 }
@@ -237,6 +313,108 @@ __wt_txn_new_id(WT_SESSION_IMPL *session)
 	return (WT_ATOMIC_ADD8(S2C(session)->txn_global.current, 1) - 1);
 }
 
+/*
+ * __wt_txn_state_active --
+ *	Mark the session's transaction state as in use, before an ID, a
+ *	snap_min or a read timestamp is published in it.
+ */
+static inline void
+__wt_txn_state_active(WT_SESSION_IMPL *session)
+{
+	WT_TXN_GLOBAL *txn_global;
+
+	txn_global = &S2C(session)->txn_global;
+
+	/*
+	 * Threads building snapshots skip sessions not marked in the map: the
+	 * mark must be visible before anything is published in the state.
+	 */
+	if (txn_global->active[session->id] == 0) {
+		txn_global->active[session->id] = 1;
+		WT_WRITE_BARRIER();
+	}
+}
+
+/*
+ * __wt_txn_state_idle --
+ *	Clear the session's mark once nothing is published in its transaction
+ *	state.
+ */
+static inline void
+__wt_txn_state_idle(WT_SESSION_IMPL *session)
+{
+	WT_TXN_GLOBAL *txn_global;
+	WT_TXN_STATE *txn_state;
+
+	txn_global = &S2C(session)->txn_global;
+	txn_state = &txn_global->states[session->id];
+
+	if (txn_global->active[session->id] != 0 &&
+	    txn_state->id == WT_TXN_NONE &&
+	    txn_state->snap_min == WT_TXN_NONE &&
+	    txn_state->read_timestamp == 0)
+		WT_PUBLISH(txn_global->active[session->id], 0);
+}
+
+/*
+ * __wt_txn_state_next --
+ *	Return the next session at or after the given slot whose transaction
+ *	state is in use, or the session count if there are none.
+ */
+static inline uint32_t
+__wt_txn_state_next(
+    WT_TXN_GLOBAL *txn_global, uint32_t slot, uint32_t session_cnt)
+{
+	const volatile uint8_t *active;
+
+	active = txn_global->active;
+
+	/* Skip a word of idle sessions at a time. */
+	while (slot < session_cnt) {
+		if (slot % sizeof(uint64_t) == 0 &&
+		    *(const volatile uint64_t *)(active + slot) == 0) {
+			slot += (uint32_t)sizeof(uint64_t);
+			continue;
+		}
+		if (active[slot] != 0)
+			return (slot);
+		++slot;
+	}
+	return (session_cnt);
+}
+
+/*
+ * __wt_txn_upd_committed --
+ *	Check if a given update's transaction has committed: it has if it isn't
+ *	aborted and no running transaction has its ID.
+ */
+static inline int
+__wt_txn_upd_committed(WT_SESSION_IMPL *session, WT_UPDATE *upd)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_TXN_GLOBAL *txn_global;
+	uint64_t id;
+	uint32_t i, session_cnt;
+
+	if ((id = upd->txnid) == WT_TXN_ABORTED)
+		return (0);
+	if (__wt_txn_visible_all(session, id))
+		return (1);
+
+	conn = S2C(session);
+	txn_global = &conn->txn_global;
+	WT_ORDERED_READ(session_cnt, conn->session_cnt);
+	for (i = __wt_txn_state_next(txn_global, 0, session_cnt);
+	    i < session_cnt;
+	    i = __wt_txn_state_next(txn_global, i + 1, session_cnt))
+		if (txn_global->states[i].id == id)
+			return (0);
+
+	/* The transaction may have rolled back while we were looking. */
+	WT_READ_BARRIER();
+	return (upd->txnid != WT_TXN_ABORTED);
+}
+
 /*
  * __wt_txn_idle_cache_check --
  *	If there is no transaction active in this thread and we haven't checked
@@ -280,6 +458,15 @@ __wt_txn_id_check(WT_SESSION_IMPL *session)
 
 	WT_ASSERT(session, F_ISSET(txn, TXN_RUNNING));
 
+	if (F_ISSET(txn, TXN_READONLY)) {
+		WT_STAT_FAST_CONN_INCR(session, txn_readonly_update);
+		WT_RET_MSG(session, EINVAL,
+		    "read-only transactions cannot update data");
+	}
+	if (F_ISSET(txn, TXN_PREPARED))
+		WT_RET_MSG(session, EINVAL,
+		    "prepared transactions cannot update data");
+
 	/* If the transaction is idle, check that the cache isn't full. */
 	WT_RET(__wt_txn_idle_cache_check(session));
 
@@ -301,23 +488,27 @@ __wt_txn_id_check(WT_SESSION_IMPL *session)
 		 * will proceed.  The winning thread can be sure its snapshot
 		 * contains all of the earlier active IDs.  Threads that race
 		 * and get an earlier ID may not appear in the snapshot, but
-		 * they will loop and allocate a new ID before proceeding to
-		 * make any updates.
+		 * they will allocate a new ID before proceeding to make any
+		 * updates.
 		 *
-		 * This potentially wastes transaction IDs when threads race to
-		 * begin transactions: that is the price we pay to keep this
-		 * path latch free.
+		 * Threads that lose the race, or find a batch being allocated,
+		 * join a batch rather than retrying: the global counter is a
+		 * single cache line, and retries from many threads at once
+		 * cost more than waiting for another thread to allocate IDs on
+		 * their behalf.
 		 */
-		do {
-			txn_state->id = txn->id = txn_global->current;
-		} while (!WT_ATOMIC_CAS8(
-		    txn_global->current, txn->id, txn->id + 1));
+		__wt_txn_state_active(session);
+		txn_state->priority = txn->priority;
+		txn_state->id = txn->id = txn_global->current;
+		if (txn_global->id_batch_lock != 0 || !WT_ATOMIC_CAS8(
+		    txn_global->current, txn->id, txn->id + 1))
+			txn->id = __wt_txn_id_batch(session);
 
 		/*
 		 * If we have used 64-bits of transaction IDs, there is nothing
 		 * more we can do.
 		 */
-		if (txn->id == WT_TXN_ABORTED)
+		if (TXNID_LE(WT_TXN_PENDING, txn->id))
 			WT_RET_MSG(session, ENOMEM, "Out of transaction IDs");
 		F_SET(txn, TXN_HAS_ID);
 	}
@@ -325,6 +516,23 @@ __wt_txn_id_check(WT_SESSION_IMPL *session)
 	return (0);
 }
 
+/*
+ * __wt_txn_wounded_check --
+ *	Check if a conflicting transaction with a higher precedence has asked
+ *	the running transaction to roll back.
+ */
+static inline int
+__wt_txn_wounded_check(WT_SESSION_IMPL *session)
+{
+	WT_TXN *txn;
+
+	txn = &session->txn;
+	if (F_ISSET(txn, TXN_HAS_ID) &&
+	    WT_SESSION_TXN_STATE(session)->wounded == txn->id)
+		return (WT_ROLLBACK);
+	return (0);
+}
+
 /*
  * __wt_txn_update_check --
  *	Check if the current transaction can update an item.
@@ -336,11 +544,22 @@ __wt_txn_update_check(WT_SESSION_IMPL *session, WT_UPDATE *upd)
 
 	txn = &session->txn;
 	if (txn->isolation == TXN_ISO_SNAPSHOT)
-		while (upd != NULL && !__wt_txn_visible(session, upd->txnid)) {
+		while (upd != NULL && !__wt_txn_upd_visible(session, upd)) {
 			if (upd->txnid != WT_TXN_ABORTED) {
+				WT_STAT_FAST_CONN_INCR(
+				    session, txn_update_conflict);
 				WT_STAT_FAST_DATA_INCR(
 				    session, txn_update_conflict);
-				return (WT_ROLLBACK);
+				if (txn->conflict_timeout == 0)
+					return (WT_ROLLBACK);
+
+				/*
+				 * Wait for the transaction that made the
+				 * update to resolve: if it rolled back, check
+				 * the update again.
+				 */
+				WT_RET(__wt_txn_conflict_wait(session, upd));
+				continue;
 			}
 			upd = upd->next;
 		}
@@ -398,8 +617,10 @@ __wt_txn_cursor_op(WT_SESSION_IMPL *session)
 	 */
 	if (txn->isolation == TXN_ISO_READ_UNCOMMITTED &&
 	    !F_ISSET(txn, TXN_HAS_ID) &&
-	    TXNID_LT(txn_state->snap_min, txn_global->last_running))
+	    TXNID_LT(txn_state->snap_min, txn_global->last_running)) {
+		__wt_txn_state_active(session);
 		txn_state->snap_min = txn_global->last_running;
+	}
 
 	if (txn->isolation != TXN_ISO_READ_UNCOMMITTED &&
 	    !F_ISSET(txn, TXN_HAS_SNAPSHOT))
@@ -428,9 +649,13 @@ __wt_txn_am_oldest(WT_SESSION_IMPL *session)
 		return (0);
 
 	WT_ORDERED_READ(session_cnt, conn->session_cnt);
-	for (i = 0, s = txn_global->states; i < session_cnt; i++, s++)
+	for (i = __wt_txn_state_next(txn_global, 0, session_cnt);
+	    i < session_cnt;
+	    i = __wt_txn_state_next(txn_global, i + 1, session_cnt)) {
+		s = &txn_global->states[i];
 		if ((id = s->id) != WT_TXN_NONE && TXNID_LT(id, txn->id))
 			return (0);
+	}
 
 	return (1);
 }
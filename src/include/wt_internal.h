@@ -81,6 +81,10 @@ struct __wt_async_worker_state;
     typedef struct __wt_async_worker_state WT_ASYNC_WORKER_STATE;
 struct __wt_block;
     typedef struct __wt_block WT_BLOCK;
+struct __wt_block_cache;
+    typedef struct __wt_block_cache WT_BLOCK_CACHE;
+struct __wt_block_cache_item;
+    typedef struct __wt_block_cache_item WT_BLOCK_CACHE_ITEM;
 struct __wt_block_ckpt;
     typedef struct __wt_block_ckpt WT_BLOCK_CKPT;
 struct __wt_block_desc;
@@ -97,8 +101,12 @@ struct __wt_btree;
     typedef struct __wt_btree WT_BTREE;
 struct __wt_cache;
     typedef struct __wt_cache WT_CACHE;
+struct __wt_cache_node;
+    typedef struct __wt_cache_node WT_CACHE_NODE;
 struct __wt_cache_pool;
     typedef struct __wt_cache_pool WT_CACHE_POOL;
+struct __wt_cache_warmup_file;
+    typedef struct __wt_cache_warmup_file WT_CACHE_WARMUP_FILE;
 struct __wt_cell;
     typedef struct __wt_cell WT_CELL;
 struct __wt_cell_unpack;
@@ -167,6 +175,8 @@ struct __wt_dsrc_stats;
     typedef struct __wt_dsrc_stats WT_DSRC_STATS;
 struct __wt_evict_entry;
     typedef struct __wt_evict_entry WT_EVICT_ENTRY;
+struct __wt_evict_queue;
+    typedef struct __wt_evict_queue WT_EVICT_QUEUE;
 struct __wt_evict_worker;
     typedef struct __wt_evict_worker WT_EVICT_WORKER;
 struct __wt_ext;
@@ -257,8 +267,14 @@ struct __wt_txn;
     typedef struct __wt_txn WT_TXN;
 struct __wt_txn_global;
     typedef struct __wt_txn_global WT_TXN_GLOBAL;
+struct __wt_txn_log_key;
+    typedef struct __wt_txn_log_key WT_TXN_LOG_KEY;
+struct __wt_txn_log_keys;
+    typedef struct __wt_txn_log_keys WT_TXN_LOG_KEYS;
 struct __wt_txn_op;
     typedef struct __wt_txn_op WT_TXN_OP;
+struct __wt_txn_prepared;
+    typedef struct __wt_txn_prepared WT_TXN_PREPARED;
 struct __wt_txn_state;
     typedef struct __wt_txn_state WT_TXN_STATE;
 struct __wt_upd_skipped;
@@ -262,12 +262,12 @@ __log_size_fit(WT_SESSION_IMPL *session, WT_LSN *lsn, uint64_t recsize)
 }
 
 /*
- * __log_acquire --
+ * __wt_log_acquire --
  *	Called with the log slot lock held.  Can be called recursively
  *	from __wt_log_newfile when we change log files.
  */
-static int
-__log_acquire(WT_SESSION_IMPL *session, uint64_t recsize, WT_LOGSLOT *slot)
+int
+__wt_log_acquire(WT_SESSION_IMPL *session, uint64_t recsize, WT_LOGSLOT *slot)
 {
 	WT_CONNECTION_IMPL *conn;
 	WT_LOG *log;
@@ -286,7 +286,7 @@ __log_acquire(WT_SESSION_IMPL *session, uint64_t recsize, WT_LOGSLOT *slot)
 	if (!__log_size_fit(session, &log->alloc_lsn, recsize)) {
 		WT_RET(__wt_log_newfile(session, 0, &created_log));
 		if (log->log_close_fh != NULL)
-			F_SET(slot, SLOT_CLOSEFH);
+			F_SET_ATOMIC(slot, SLOT_CLOSEFH);
 	}
 
 	/*
@@ -448,9 +448,9 @@ __log_file_header(
 	myslot.offset = 0;
 
 	/*
-	 * We may recursively call __log_acquire to allocate log space for the
-	 * log descriptor record.  Call __log_fill to write it, but we
-	 * do not need to call __log_release because we're not waiting for
+	 * We may recursively call __wt_log_acquire to allocate log space for
+	 * the log descriptor record.  Call __log_fill to write it, but we
+	 * do not need to call __wt_log_release because we're not waiting for
 	 * any earlier operations to complete.
 	 */
 	if (prealloc) {
@@ -459,7 +459,7 @@ __log_file_header(
 	} else {
 		WT_ASSERT(session, fh == NULL);
 		log->prep_missed++;
-		WT_ERR(__log_acquire(session, logrec->len, &tmp));
+		WT_ERR(__wt_log_acquire(session, logrec->len, &tmp));
 	}
 	WT_ERR(__log_fill(session, &myslot, 1, buf, NULL));
 	/*
@@ -831,8 +831,8 @@ __log_filesize(WT_SESSION_IMPL *session, WT_FH *fh, wt_off_t *eof)
 	WT_CONNECTION_IMPL *conn;
 	WT_DECL_RET;
 	WT_LOG *log;
-	wt_off_t log_size, off, off1;
-	uint32_t allocsize, bufsz;
+	wt_off_t log_size, off, off1, rec_end;
+	uint32_t allocsize, bufsz, reclen;
 	char *buf, *zerobuf;
 
 	conn = S2C(session);
@@ -895,12 +895,19 @@ __log_filesize(WT_SESSION_IMPL *session, WT_FH *fh, wt_off_t *eof)
 	    off1 > 0; off1 -= (wt_off_t)allocsize)
 		if (memcmp(buf + off1, zerobuf, sizeof(uint32_t)) != 0)
 			break;
+	reclen = *(uint32_t *)(buf + off1);
 	off = off + off1;
 
 	/*
-	 * Set EOF to the last zero-filled record we saw.
+	 * Set EOF to the last zero-filled record we saw.  If that's the start
+	 * of a record longer than the allocation size, the end of the record
+	 * can be entirely zero: the padding of a record, and the last bytes of
+	 * its data, can be zero.  Include the whole record.
 	 */
 	*eof = off + (wt_off_t)allocsize;
+	if (reclen > allocsize && (rec_end =
+	    off + (wt_off_t)__wt_rduppo2(reclen, allocsize)) > *eof)
+		*eof = WT_MIN(rec_end, log_size);
 err:
 	if (buf != NULL)
 		__wt_free(session, buf);
@@ -910,50 +917,71 @@ err:
 }
 
 /*
- * __log_release --
+ * __wt_log_error --
+ *	Record a failed write or sync of the log.  The log can't be trusted to
+ *	hold records following the failure: no more records are written, and
+ *	threads waiting for the log to be written or synced return the error
+ *	rather than waiting for I/O that won't happen.
+ */
+void
+__wt_log_error(WT_SESSION_IMPL *session, int error)
+{
+	WT_LOG *log;
+
+	log = S2C(session)->log;
+	if (WT_ATOMIC_CAS4(log->log_error, 0, error)) {
+		(void)__wt_cond_signal(session, log->log_sync_cond);
+		(void)__wt_cond_signal(session, log->log_write_cond);
+	}
+}
+
+/*
+ * __wt_log_release --
  *	Release a log slot.
  */
-static int
-__log_release(WT_SESSION_IMPL *session, WT_LOGSLOT *slot, int *freep)
+int
+__wt_log_release(WT_SESSION_IMPL *session, WT_LOGSLOT *slot, int *freep)
 {
 	WT_CONNECTION_IMPL *conn;
 	WT_DECL_RET;
 	WT_LOG *log;
-	WT_LSN sync_lsn;
 	size_t write_size;
-	int locked, yield_count;
-	WT_DECL_SPINLOCK_ID(id);			/* Must appear last */
+	int yield_count;
 
 	conn = S2C(session);
 	log = conn->log;
-	locked = yield_count = 0;
+	yield_count = 0;
 	*freep = 1;
 
-	/* Write the buffered records */
-	if (F_ISSET(slot, SLOT_BUFFERED)) {
-		write_size = (size_t)
-		    (slot->slot_end_lsn.offset - slot->slot_start_offset);
-		WT_ERR(__wt_write(session, slot->slot_fh,
-		    slot->slot_start_offset, write_size, slot->slot_buf.mem));
-	}
-
 	/*
-	 * If this is not a buffered write, meaning the slot we have is a
-	 * dummy constructed slot, not from the slot pool, or we have to wait
-	 * for a synchronous operation, we do not pass handling of this slot
-	 * off to the worker thread.  The caller is responsible for freeing
-	 * the slot in that case.  Otherwise the worker thread will free it.
+	 * Slots from the pool are handed off to the log writer thread, which
+	 * writes them and frees them once the write LSN moves past them, while
+	 * threads fill the next slots.  Records written without using the
+	 * slot pool, or written before the log threads are started, are
+	 * written here: the caller is responsible for freeing the slot in
+	 * that case.
 	 */
-	if (F_ISSET(slot, SLOT_BUFFERED) &&
-	    !F_ISSET(slot, SLOT_SYNC | SLOT_SYNC_DIR)) {
+	if (F_ISSET_ATOMIC(slot, SLOT_BUFFERED) && conn->log_wrlsn_tid_set) {
 		*freep = 0;
-		slot->slot_state = WT_LOG_SLOT_WRITTEN;
 		/*
-		 * After this point the worker thread owns the slot.  There
+		 * After this point the writer thread owns the slot.  There
 		 * is nothing more to do but return.
 		 */
-		WT_ERR(__wt_cond_signal(session, conn->log_wrlsn_cond));
-		goto done;
+		WT_PUBLISH(slot->slot_state, WT_LOG_SLOT_READY);
+		return (__wt_cond_signal(session, conn->log_wrlsn_cond));
+	}
+
+	/*
+	 * Write the buffered records, unless log space couldn't be allocated
+	 * for them, or an earlier write or sync of the log failed.
+	 */
+	if (slot->slot_error == 0)
+		slot->slot_error = log->log_error;
+	if (F_ISSET_ATOMIC(slot, SLOT_BUFFERED) && slot->slot_error == 0) {
+		write_size = (size_t)
+		    (slot->slot_end_lsn.offset - slot->slot_start_offset);
+		WT_ERR(__wt_write(session, slot->slot_fh,
+		    slot->slot_start_offset, write_size, slot->slot_buf.mem));
 	}
 
 	/*
@@ -961,89 +989,111 @@ __log_release(WT_SESSION_IMPL *session, WT_LOGSLOT *slot, int *freep)
 	 * be holes in the log file.
 	 */
 	WT_STAT_FAST_CONN_INCR(session, log_release_write_lsn);
+	if (LOG_CMP(&log->write_lsn, &slot->slot_release_lsn) != 0)
+		WT_STAT_FAST_CONN_INCR(session, log_release_waits);
 	while (LOG_CMP(&log->write_lsn, &slot->slot_release_lsn) != 0) {
+		if ((ret = log->log_error) != 0)
+			goto err;
 		if (++yield_count < 1000)
 			__wt_yield();
 		else
 			WT_ERR(__wt_cond_wait(
 			    session, log->log_write_cond, 200));
 	}
+	__wt_spin_lock(session, &log->log_lock);
 	log->write_lsn = slot->slot_end_lsn;
+	__wt_spin_unlock(session, &log->log_lock);
 	WT_ERR(__wt_cond_signal(session, log->log_write_cond));
 
 	/*
 	 * Signal the close thread if needed.
 	 */
-	if (F_ISSET(slot, SLOT_CLOSEFH))
+	if (F_ISSET_ATOMIC(slot, SLOT_CLOSEFH))
 		WT_ERR(__wt_cond_signal(session, conn->log_close_cond));
 
+err:	if (ret != 0) {
+		if (slot->slot_error == 0)
+			slot->slot_error = ret;
+		__wt_log_error(session, ret);
+	}
+	return (ret);
+}
+
+/*
+ * __wt_log_flush_once --
+ *	Sync the log as far as it is written, if threads are waiting for
+ *	records in that part of the log to be durable.  A single sync covers
+ *	the requests for every record written before it starts.
+ */
+int
+__wt_log_flush_once(WT_SESSION_IMPL *session, int *syncedp)
+{
+	WT_DECL_RET;
+	WT_LOG *log;
+	WT_LSN sync_dir_req_lsn, sync_req_lsn, write_lsn;
+	uint32_t fileid;
+
+	log = S2C(session)->log;
+	*syncedp = 0;
+
+	__wt_spin_lock(session, &log->log_lock);
+	sync_dir_req_lsn = log->sync_dir_req_lsn;
+	sync_req_lsn = log->sync_req_lsn;
+	write_lsn = log->write_lsn;
+	__wt_spin_unlock(session, &log->log_lock);
+
 	/*
-	 * Try to consolidate calls to fsync to wait less.  Acquire a spin lock
-	 * so that threads finishing writing to the log will wait while the
-	 * current fsync completes and advance log->sync_lsn.
+	 * Once a write fails, the write LSN moves past records that weren't
+	 * written: never sync them.  We check after reading the write LSN, the
+	 * error is set before the write LSN moves past the failed write.
 	 */
-	while (F_ISSET(slot, SLOT_SYNC | SLOT_SYNC_DIR)) {
-		/*
-		 * We have to wait until earlier log files have finished their
-		 * sync operations.  The most recent one will set the LSN to the
-		 * beginning of our file.
-		 */
-		if (log->sync_lsn.file < slot->slot_end_lsn.file ||
-		    __wt_spin_trylock(session, &log->log_sync_lock, &id) != 0) {
-			WT_ERR(__wt_cond_wait(
-			    session, log->log_sync_cond, 10000));
-			continue;
-		}
-		locked = 1;
+	if ((ret = log->log_error) != 0)
+		return (ret);
 
-		/*
-		 * Record the current end of our update after the lock.
-		 * That is how far our calls can guarantee.
-		 */
-		sync_lsn = slot->slot_end_lsn;
-		/*
-		 * Check if we have to sync the parent directory.  Some
-		 * combinations of sync flags may result in the log file
-		 * not yet stable in its parent directory.  Do that
-		 * now if needed.
-		 */
-		if (F_ISSET(slot, SLOT_SYNC_DIR) &&
-		    (log->sync_dir_lsn.file < sync_lsn.file)) {
-			WT_ASSERT(session, log->log_dir_fh != NULL);
-			WT_ERR(__wt_verbose(session, WT_VERB_LOG,
-			    "log_release: sync directory %s",
-			    log->log_dir_fh->name));
-			WT_ERR(__wt_directory_sync_fh(
-			    session, log->log_dir_fh));
-			log->sync_dir_lsn = sync_lsn;
-			WT_STAT_FAST_CONN_INCR(session, log_sync_dir);
-		}
+	__wt_spin_lock(session, &log->log_sync_lock);
 
-		/*
-		 * Sync the log file if needed.
-		 */
-		if (F_ISSET(slot, SLOT_SYNC) &&
-		    LOG_CMP(&log->sync_lsn, &slot->slot_end_lsn) < 0) {
+	/*
+	 * Check if we have to sync the parent directory: a log file is
+	 * created before any LSN in it is allocated, so the directory can be
+	 * synced before the records are written.
+	 */
+	if (log->sync_dir_lsn.file < sync_dir_req_lsn.file) {
+		WT_ASSERT(session, log->log_dir_fh != NULL);
+		WT_ERR(__wt_verbose(session, WT_VERB_LOG,
+		    "log_flush: sync directory %s", log->log_dir_fh->name));
+		WT_ERR(__wt_directory_sync_fh(session, log->log_dir_fh));
+		log->sync_dir_lsn = sync_dir_req_lsn;
+		WT_STAT_FAST_CONN_INCR(session, log_sync_dir);
+		*syncedp = 1;
+	}
+
+	/*
+	 * Sync the log file if a request isn't covered by the last sync.  We
+	 * can only sync the file the write LSN is in once the close thread
+	 * has synced the earlier log files and moved the sync LSN into it, and
+	 * if that file has been replaced by a newer log file, the close thread
+	 * syncs it.
+	 */
+	if (LOG_CMP(&log->sync_lsn, &sync_req_lsn) < 0 &&
+	    LOG_CMP(&log->sync_lsn, &write_lsn) < 0 &&
+	    log->sync_lsn.file == write_lsn.file) {
+		WT_ERR(__wt_log_extract_lognum(
+		    session, log->log_fh->name, &fileid));
+		if (fileid == write_lsn.file) {
 			WT_ERR(__wt_verbose(session, WT_VERB_LOG,
-			    "log_release: sync log %s", log->log_fh->name));
+			    "log_flush: sync log %s", log->log_fh->name));
 			WT_STAT_FAST_CONN_INCR(session, log_sync);
 			WT_ERR(__wt_fsync(session, log->log_fh));
-			log->sync_lsn = sync_lsn;
-			WT_ERR(__wt_cond_signal(session, log->log_sync_cond));
+			log->sync_lsn = write_lsn;
+			*syncedp = 1;
 		}
-		/*
-		 * Clear the flags before leaving the loop.
-		 */
-		F_CLR(slot, SLOT_SYNC | SLOT_SYNC_DIR);
-		locked = 0;
-		__wt_spin_unlock(session, &log->log_sync_lock);
-		break;
 	}
-err:	if (locked)
-		__wt_spin_unlock(session, &log->log_sync_lock);
-	if (ret != 0 && slot->slot_error == 0)
-		slot->slot_error = ret;
-done:
+
+err:	__wt_spin_unlock(session, &log->log_sync_lock);
+	if (ret != 0)
+		__wt_log_error(session, ret);
+	else if (*syncedp)
+		ret = __wt_cond_signal(session, log->log_sync_cond);
 	return (ret);
 }
 
@@ -1068,9 +1118,11 @@ __wt_log_newfile(WT_SESSION_IMPL *session, int conn_create, int *created)
 	 * Set aside the log file handle to be closed later.  Other threads
 	 * may still be using it to write to the log.  If the log file size
 	 * is small we could fill a log file before the previous one is closed.
-	 * Wait for that to close.
+	 * Wait for that to close, unless a write or sync of the log failed:
+	 * the close thread may have given up.
 	 */
 	while (log->log_close_fh != NULL) {
+		WT_RET(log->log_error);
 		WT_STAT_FAST_CONN_INCR(session, log_close_yields);
 		__wt_yield();
 	}
@@ -1482,6 +1534,56 @@ err:	WT_STAT_FAST_CONN_INCR(session, log_scans);
 	return (ret);
 }
 
+/*
+ * __log_sync_wait --
+ *	Wait for the log to be durable up to the end of a record: ask the log
+ *	flush thread to sync it, and wait for the sync LSN to move past it.
+ */
+static int
+__log_sync_wait(WT_SESSION_IMPL *session, WT_LSN *end_lsn, uint32_t flags)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_LOG *log;
+	int synced;
+
+	conn = S2C(session);
+	log = conn->log;
+
+	/*
+	 * Without a sync of the log file, there's only something to do if the
+	 * record is in a log file created since the last directory sync.
+	 */
+	if (!LF_ISSET(WT_LOG_FSYNC) && log->sync_dir_lsn.file >= end_lsn->file)
+		return (0);
+
+	WT_STAT_FAST_CONN_INCR(session, log_sync_requests);
+	__wt_spin_lock(session, &log->log_lock);
+	if (LOG_CMP(&log->sync_dir_req_lsn, end_lsn) < 0)
+		log->sync_dir_req_lsn = *end_lsn;
+	if (LF_ISSET(WT_LOG_FSYNC) && LOG_CMP(&log->sync_req_lsn, end_lsn) < 0)
+		log->sync_req_lsn = *end_lsn;
+	__wt_spin_unlock(session, &log->log_lock);
+
+	if (conn->log_flush_tid_set)
+		WT_RET(__wt_cond_signal(session, conn->log_flush_cond));
+	while (log->sync_dir_lsn.file < end_lsn->file ||
+	    (LF_ISSET(WT_LOG_FSYNC) && LOG_CMP(&log->sync_lsn, end_lsn) < 0)) {
+		/* The log can't be synced after a failed write or sync. */
+		WT_RET(log->log_error);
+		/*
+		 * Until the log threads are started, the thread writing the
+		 * record syncs the log itself.
+		 */
+		if (!conn->log_flush_tid_set) {
+			WT_RET(__wt_log_flush_once(session, &synced));
+			if (synced)
+				continue;
+		}
+		WT_RET(__wt_cond_wait(session, log->log_sync_cond, 10000));
+	}
+	return (0);
+}
+
 /*
  * __log_direct_write --
  *	Write a log record without using the consolidation arrays.
@@ -1508,15 +1610,19 @@ __log_direct_write(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp,
 		return (EAGAIN);
 	locked = 1;
 
-	if (LF_ISSET(WT_LOG_DSYNC | WT_LOG_FSYNC))
-		F_SET(&tmp, SLOT_SYNC_DIR);
-	if (LF_ISSET(WT_LOG_FSYNC))
-		F_SET(&tmp, SLOT_SYNC);
-	WT_ERR(__log_acquire(session, record->size, &tmp));
+	WT_ERR(__wt_log_acquire(session, record->size, &tmp));
 	__wt_spin_unlock(session, &log->log_slot_lock);
 	locked = 0;
-	WT_ERR(__log_fill(session, &myslot, 1, record, lsnp));
-	WT_ERR(__log_release(session, &tmp, &dummy));
+	/*
+	 * If the write fails, the log has a hole where the record should be:
+	 * nothing can be written after it.
+	 */
+	if ((ret = __log_fill(session, &myslot, 1, record, lsnp)) != 0)
+		__wt_log_error(session, ret);
+	WT_ERR(ret);
+	WT_ERR(__wt_log_release(session, &tmp, &dummy));
+	if (LF_ISSET(WT_LOG_DSYNC | WT_LOG_FSYNC))
+		WT_ERR(__log_sync_wait(session, &tmp.slot_end_lsn, flags));
 
 err:	if (locked)
 		__wt_spin_unlock(session, &log->log_slot_lock);
@@ -1641,16 +1747,22 @@ __log_write_internal(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp,
 	WT_DECL_RET;
 	WT_LOG *log;
 	WT_LOG_RECORD *logrec;
-	WT_LSN lsn;
+	WT_LSN end_lsn, lsn;
 	WT_MYSLOT myslot;
+	int64_t release_state;
 	uint32_t rdup_len;
-	int free_slot, locked;
+	int free_slot;
 
 	conn = S2C(session);
 	log = conn->log;
-	free_slot = locked = 0;
+	free_slot = 0;
+	WT_INIT_LSN(&end_lsn);
 	WT_INIT_LSN(&lsn);
 	myslot.slot = NULL;
+
+	/* Nothing more is written after a failed write or sync of the log. */
+	WT_RET(log->log_error);
+
 	/*
 	 * Assume the WT_ITEM the caller passed is a WT_LOG_RECORD, which has a
 	 * header at the beginning for us to fill in.
@@ -1700,7 +1812,7 @@ __log_write_internal(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp,
 	 */
 	F_SET(log, WT_LOG_FORCE_CONSOLIDATE);
 	if ((ret = __wt_log_slot_join(
-	    session, rdup_len, flags, &myslot)) == ENOMEM) {
+	    session, rdup_len, &myslot)) == ENOMEM) {
 		/*
 		 * If we couldn't find a consolidated slot for this record
 		 * write the record directly.
@@ -1717,38 +1829,50 @@ __log_write_internal(WT_SESSION_IMPL *session, WT_ITEM *record, WT_LSN *lsnp,
 		return (0);
 	}
 	WT_ERR(ret);
+	/*
+	 * The first thread to join a slot closes it, after a pause to allow
+	 * other threads a chance to consolidate.  Other threads copy their
+	 * records into the slot buffer without waiting for it to be closed,
+	 * unless they need to know where their record is in the log.
+	 */
 	if (myslot.offset == 0) {
-		__wt_spin_lock(session, &log->log_slot_lock);
-		locked = 1;
-		WT_ERR(__wt_log_slot_close(session, myslot.slot));
-		WT_ERR(__log_acquire(
-		    session, myslot.slot->slot_group_size, myslot.slot));
-		__wt_spin_unlock(session, &log->log_slot_lock);
-		locked = 0;
-		WT_ERR(__wt_log_slot_notify(session, myslot.slot));
-	} else
-		WT_ERR(__wt_log_slot_wait(session, myslot.slot));
-	WT_ERR(__log_fill(session, &myslot, 0, record, &lsn));
-	if (__wt_log_slot_release(myslot.slot, rdup_len) == WT_LOG_SLOT_DONE) {
-		WT_ERR(__log_release(session, myslot.slot, &free_slot));
+		__wt_yield();
+		ret = __wt_log_slot_switch(session, myslot.slot);
+	}
+	/*
+	 * Always release our piece of the slot, even after an error, so the
+	 * slot can be written and reused.
+	 */
+	WT_TRET(__log_fill(session, &myslot, 0, record, NULL));
+	if (lsnp != NULL ||
+	    LF_ISSET(WT_LOG_DSYNC | WT_LOG_FLUSH | WT_LOG_FSYNC)) {
+		WT_TRET(__wt_log_slot_wait(session, myslot.slot));
+		lsn = myslot.slot->slot_start_lsn;
+		lsn.offset += (wt_off_t)myslot.offset;
+		end_lsn = myslot.slot->slot_end_lsn;
+	}
+	/*
+	 * Once our piece is released, the slot can be written and reused: we
+	 * wait for the write LSN or the sync LSN to move past our record, we
+	 * don't do the I/O ourselves.
+	 */
+	release_state = __wt_log_slot_release(myslot.slot, rdup_len);
+	if (WT_LOG_SLOT_DONE(release_state)) {
+		WT_TRET(__wt_log_release(session, myslot.slot, &free_slot));
 		if (free_slot)
-			WT_ERR(__wt_log_slot_free(session, myslot.slot));
-	} else if (LF_ISSET(WT_LOG_FSYNC)) {
-		/* Wait for our writes to reach disk */
-		while (LOG_CMP(&log->sync_lsn, &lsn) <= 0 &&
-		    myslot.slot->slot_error == 0)
-			(void)__wt_cond_wait(
-			    session, log->log_sync_cond, 10000);
-	} else if (LF_ISSET(WT_LOG_FLUSH)) {
-		/* Wait for our writes to reach the OS */
-		while (LOG_CMP(&log->write_lsn, &lsn) <= 0 &&
-		    myslot.slot->slot_error == 0)
-			(void)__wt_cond_wait(
-			    session, log->log_write_cond, 10000);
+			WT_TRET(__wt_log_slot_free(session, myslot.slot));
 	}
+	WT_ERR(ret);
+	if (LF_ISSET(WT_LOG_DSYNC | WT_LOG_FSYNC))
+		WT_ERR(__log_sync_wait(session, &end_lsn, flags));
+	if (LF_ISSET(WT_LOG_FLUSH | WT_LOG_DSYNC) && !LF_ISSET(WT_LOG_FSYNC))
+		/* Wait for our writes to reach the OS */
+		while (LOG_CMP(&log->write_lsn, &end_lsn) < 0) {
+			WT_ERR(log->log_error);
+			WT_ERR(__wt_cond_wait(
+			    session, log->log_write_cond, 10000));
+		}
 err:
-	if (locked)
-		__wt_spin_unlock(session, &log->log_slot_lock);
 	if (ret == 0 && lsnp != NULL)
 		*lsnp = lsn;
 	/*
@@ -1756,11 +1880,14 @@ err:
 	 * if our write made it out to the file or not.  The error could be
 	 * before or after us.  So, if anyone got an error, we report it.
 	 * If we're not synchronous, only report if our own operation got
-	 * an error.
+	 * an error.  If we waited for the log to be written, the write LSN
+	 * moves past records a failed write didn't write: report that too.
 	 */
 	if (LF_ISSET(WT_LOG_DSYNC | WT_LOG_FSYNC) && ret == 0 &&
 	    myslot.slot != NULL)
 		ret = myslot.slot->slot_error;
+	if (LF_ISSET(WT_LOG_DSYNC | WT_LOG_FLUSH | WT_LOG_FSYNC) && ret == 0)
+		ret = log->log_error;
 	return (ret);
 }
 
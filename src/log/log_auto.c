@@ -441,6 +441,133 @@ __wt_logop_row_truncate_print(
 	return (0);
 }
 
+int
+__wt_logop_row_put_compact_pack(
+    WT_SESSION_IMPL *session, WT_ITEM *logrec,
+    uint32_t fileid, uint32_t prefix, WT_ITEM *suffix, WT_ITEM *value)
+{
+	const char *fmt = WT_UNCHECKED_STRING(IIIIuu);
+	size_t size;
+	uint32_t optype, recsize;
+
+	optype = WT_LOGOP_ROW_PUT_COMPACT;
+	WT_RET(__wt_struct_size(session, &size, fmt,
+	    optype, 0, fileid, prefix, suffix, value));
+
+	__wt_struct_size_adjust(session, &size);
+	WT_RET(__wt_buf_extend(session, logrec, logrec->size + size));
+	recsize = (uint32_t)size;
+	WT_RET(__wt_struct_pack(session,
+	    (uint8_t *)logrec->data + logrec->size, size, fmt,
+	    optype, recsize, fileid, prefix, suffix, value));
+
+	logrec->size += (uint32_t)size;
+	return (0);
+}
+
+int
+__wt_logop_row_put_compact_unpack(
+    WT_SESSION_IMPL *session, const uint8_t **pp, const uint8_t *end,
+    uint32_t *fileidp, uint32_t *prefixp, WT_ITEM *suffixp, WT_ITEM *valuep)
+{
+	const char *fmt = WT_UNCHECKED_STRING(IIIIuu);
+	uint32_t optype, size;
+
+	WT_RET(__wt_struct_unpack(session, *pp, WT_PTRDIFF(end, *pp), fmt,
+	    &optype, &size, fileidp, prefixp, suffixp, valuep));
+	WT_ASSERT(session, optype == WT_LOGOP_ROW_PUT_COMPACT);
+
+	*pp += size;
+	return (0);
+}
+
+int
+__wt_logop_row_put_compact_print(
+    WT_SESSION_IMPL *session, const uint8_t **pp, const uint8_t *end, FILE *out)
+{
+	uint32_t fileid;
+	uint32_t prefix;
+	WT_ITEM suffix;
+	WT_ITEM value;
+	char *escaped;
+
+	escaped = NULL;
+	WT_RET(__wt_logop_row_put_compact_unpack(
+	    session, pp, end, &fileid, &prefix, &suffix, &value));
+
+	fprintf(out, " \"optype\": \"row_put_compact\",\n");
+	fprintf(out, "        \"fileid\": \"%" PRIu32 "\",\n", fileid);
+	fprintf(out, "        \"prefix\": \"%" PRIu32 "\",\n", prefix);
+	WT_RET(__logrec_jsonify_str(session, &escaped, &suffix));
+	fprintf(out, "        \"suffix\": \"%s\",\n", escaped);
+	WT_RET(__logrec_jsonify_str(session, &escaped, &value));
+	fprintf(out, "        \"value\": \"%s\"", escaped);
+	__wt_free(session, escaped);
+	return (0);
+}
+
+int
+__wt_logop_row_remove_compact_pack(
+    WT_SESSION_IMPL *session, WT_ITEM *logrec,
+    uint32_t fileid, uint32_t prefix, WT_ITEM *suffix)
+{
+	const char *fmt = WT_UNCHECKED_STRING(IIIIu);
+	size_t size;
+	uint32_t optype, recsize;
+
+	optype = WT_LOGOP_ROW_REMOVE_COMPACT;
+	WT_RET(__wt_struct_size(session, &size, fmt,
+	    optype, 0, fileid, prefix, suffix));
+
+	__wt_struct_size_adjust(session, &size);
+	WT_RET(__wt_buf_extend(session, logrec, logrec->size + size));
+	recsize = (uint32_t)size;
+	WT_RET(__wt_struct_pack(session,
+	    (uint8_t *)logrec->data + logrec->size, size, fmt,
+	    optype, recsize, fileid, prefix, suffix));
+
+	logrec->size += (uint32_t)size;
+	return (0);
+}
+
+int
+__wt_logop_row_remove_compact_unpack(
+    WT_SESSION_IMPL *session, const uint8_t **pp, const uint8_t *end,
+    uint32_t *fileidp, uint32_t *prefixp, WT_ITEM *suffixp)
+{
+	const char *fmt = WT_UNCHECKED_STRING(IIIIu);
+	uint32_t optype, size;
+
+	WT_RET(__wt_struct_unpack(session, *pp, WT_PTRDIFF(end, *pp), fmt,
+	    &optype, &size, fileidp, prefixp, suffixp));
+	WT_ASSERT(session, optype == WT_LOGOP_ROW_REMOVE_COMPACT);
+
+	*pp += size;
+	return (0);
+}
+
+int
+__wt_logop_row_remove_compact_print(
+    WT_SESSION_IMPL *session, const uint8_t **pp, const uint8_t *end, FILE *out)
+{
+	uint32_t fileid;
+	uint32_t prefix;
+	WT_ITEM suffix;
+	char *escaped;
+
+	escaped = NULL;
+	WT_RET(__wt_logop_row_remove_compact_unpack(
+	    session, pp, end, &fileid, &prefix, &suffix));
+
+	fprintf(out, " \"optype\": \"row_remove_compact\",\n");
+	fprintf(out, "        \"fileid\": \"%" PRIu32 "\",\n", fileid);
+	fprintf(out, "        \"prefix\": \"%" PRIu32 "\",\n", prefix);
+	WT_RET(__logrec_jsonify_str(session, &escaped, &suffix));
+	fprintf(out, "        \"suffix\": \"%s\"", escaped);
+	__wt_free(session, escaped);
+	return (0);
+}
+
 int
 __wt_txn_op_printlog(
     WT_SESSION_IMPL *session, const uint8_t **pp, const uint8_t *end, FILE *out)
@@ -476,6 +603,15 @@ __wt_txn_op_printlog(
 		WT_RET(__wt_logop_row_truncate_print(session, pp, end, out));
 		break;
 
+	case WT_LOGOP_ROW_PUT_COMPACT:
+		WT_RET(__wt_logop_row_put_compact_print(session, pp, end, out));
+		break;
+
+	case WT_LOGOP_ROW_REMOVE_COMPACT:
+		WT_RET(__wt_logop_row_remove_compact_print(
+		    session, pp, end, out));
+		break;
+
 	WT_ILLEGAL_VALUE(session);
 	}
 
@@ -30,25 +30,20 @@ __wt_log_slot_init(WT_SESSION_IMPL *session)
 	WT_CONNECTION_IMPL *conn;
 	WT_DECL_RET;
 	WT_LOG *log;
-	WT_LOGSLOT *slot;
 	int32_t i;
 
 	conn = S2C(session);
 	log = conn->log;
 	for (i = 0; i < SLOT_POOL; i++) {
 		log->slot_pool[i].slot_state = WT_LOG_SLOT_FREE;
-		log->slot_pool[i].slot_index = SLOT_INVALID_INDEX;
+		log->slot_pool[i].slot_index = (uint32_t)i;
 	}
 
 	/*
-	 * Set up the available slots from the pool the first time.
+	 * Threads join the first slot in the pool the first time.
 	 */
-	for (i = 0; i < SLOT_ACTIVE; i++) {
-		slot = &log->slot_pool[i];
-		slot->slot_index = (uint32_t)i;
-		slot->slot_state = WT_LOG_SLOT_READY;
-		log->slot_array[i] = slot;
-	}
+	log->active_slot = &log->slot_pool[0];
+	log->active_slot->slot_state = WT_LOG_SLOT_ACTIVE;
 
 	/*
 	 * Allocate memory for buffers now that the arrays are setup. Split
@@ -57,7 +52,7 @@ __wt_log_slot_init(WT_SESSION_IMPL *session)
 	for (i = 0; i < SLOT_POOL; i++) {
 		WT_ERR(__wt_buf_init(session,
 		    &log->slot_pool[i].slot_buf, WT_LOG_SLOT_BUF_INIT_SIZE));
-		F_SET(&log->slot_pool[i], SLOT_INIT_FLAGS);
+		F_SET_ATOMIC(&log->slot_pool[i], SLOT_INIT_FLAGS);
 	}
 	WT_STAT_FAST_CONN_INCRV(session,
 	    log_buffer_size, WT_LOG_SLOT_BUF_INIT_SIZE * SLOT_POOL);
@@ -89,143 +84,130 @@ __wt_log_slot_destroy(WT_SESSION_IMPL *session)
 
 /*
  * __wt_log_slot_join --
- *	Join a consolidated logging slot. Callers should be prepared to deal
- *	with a ENOMEM return - which indicates no slots could accommodate
- *	the log record.
+ *	Join the active consolidated logging slot. Callers should be prepared
+ *	to deal with a ENOMEM return - which indicates the slot's buffer can't
+ *	accommodate the log record.
  */
 int
 __wt_log_slot_join(WT_SESSION_IMPL *session, uint64_t mysize,
-    uint32_t flags, WT_MYSLOT *myslotp)
+    WT_MYSLOT *myslotp)
 {
 	WT_CONNECTION_IMPL *conn;
 	WT_LOG *log;
 	WT_LOGSLOT *slot;
-	int64_t cur_state, new_state, old_state;
-	uint32_t allocated_slot, slot_grow_attempts;
+	int64_t new_state, old_state;
+	uint64_t limit, retries;
 
 	conn = S2C(session);
 	log = conn->log;
-	slot_grow_attempts = 0;
-find_slot:
-	allocated_slot = __wt_random(session->rnd) % SLOT_ACTIVE;
-	slot = log->slot_array[allocated_slot];
-	old_state = slot->slot_state;
-join_slot:
-	/*
-	 * WT_LOG_SLOT_READY and higher means the slot is available for
-	 * joining.  Any other state means it is in use and transitioning
-	 * from the active array.
-	 */
-	if (old_state < WT_LOG_SLOT_READY) {
-		WT_STAT_FAST_CONN_INCR(session, log_slot_transitions);
-		goto find_slot;
-	}
-	/*
-	 * Add in our size to the state and then atomically swap that
-	 * into place if it is still the same value.
-	 */
-	new_state = old_state + (int64_t)mysize;
-	if (new_state < old_state) {
-		/* Our size doesn't fit here. */
-		WT_STAT_FAST_CONN_INCR(session, log_slot_toobig);
-		goto find_slot;
-	}
-	/*
-	 * If the slot buffer isn't big enough to hold this update, mark
-	 * the slot for a buffer size increase and find another slot.
-	 */
-	if (new_state > (int64_t)slot->slot_buf.memsize) {
-		F_SET(slot, SLOT_BUF_GROW);
-		if (++slot_grow_attempts > 5) {
+	for (retries = 0;; ++retries) {
+		slot = log->active_slot;
+		old_state = slot->slot_state;
+		/*
+		 * A closed slot is about to be replaced by the next slot in
+		 * the pool, and a slot that isn't active has just been
+		 * replaced or is having its buffer grown: try again.
+		 */
+		if (old_state < WT_LOG_SLOT_ACTIVE ||
+		    (old_state & WT_LOG_SLOT_CLOSE) != 0) {
+			/*
+			 * After a failed write or sync of the log, a closed
+			 * slot may never be replaced.
+			 */
+			WT_RET(log->log_error);
+			__wt_yield();
+			continue;
+		}
+
+		/*
+		 * If the slot buffer can't hold this record, mark the slot for
+		 * a buffer size increase, the caller writes the record itself.
+		 * If the record doesn't fit in what's left of the buffer, close
+		 * the slot so the record can be written into the next one.
+		 */
+		limit = WT_MIN(
+		    slot->slot_buf.memsize, (uint64_t)WT_LOG_SLOT_BUF_MAX);
+		if (mysize > limit) {
+			F_SET_ATOMIC(slot, SLOT_BUF_GROW);
 			WT_STAT_FAST_CONN_INCR(session, log_slot_toosmall);
 			return (ENOMEM);
 		}
-		goto find_slot;
-	}
-	cur_state = WT_ATOMIC_CAS_VAL8(slot->slot_state, old_state, new_state);
-	/*
-	 * We lost a race to add our size into this slot.  Check the state
-	 * and try again.
-	 */
-	if (cur_state != old_state) {
-		old_state = cur_state;
-		WT_STAT_FAST_CONN_INCR(session, log_slot_races);
-		goto join_slot;
+		if ((uint64_t)WT_LOG_SLOT_JOINED(old_state) + mysize > limit) {
+			WT_RET(__wt_log_slot_switch(session, slot));
+			continue;
+		}
+
+		/*
+		 * Add in our size to the state and then atomically swap that
+		 * into place if it is still the same value.
+		 */
+		new_state = old_state + (int64_t)mysize;
+		if (WT_ATOMIC_CAS8(slot->slot_state, old_state, new_state))
+			break;
 	}
-	WT_ASSERT(session, myslotp != NULL);
+
 	/*
 	 * We joined this slot.  Fill in our information to return to
 	 * the caller.
 	 */
 	WT_STAT_FAST_CONN_INCR(session, log_slot_joins);
-	if (LF_ISSET(WT_LOG_DSYNC | WT_LOG_FSYNC))
-		F_SET(slot, SLOT_SYNC_DIR);
-	if (LF_ISSET(WT_LOG_FSYNC))
-		F_SET(slot, SLOT_SYNC);
+	WT_STAT_FAST_CONN_INCRV(session, log_slot_join_retries, retries);
 	myslotp->slot = slot;
-	myslotp->offset = (wt_off_t)old_state - WT_LOG_SLOT_READY;
+	myslotp->offset = (wt_off_t)WT_LOG_SLOT_JOINED(old_state);
 	return (0);
 }
 
 /*
- * __wt_log_slot_close --
- *	Close a slot and do not allow any other threads to join this slot.
- *	Remove this from the active slot array and move a new slot from
- *	the pool into its place.  Set up the size of this group;
- *	Must be called with the logging spinlock held.
+ * __wt_log_slot_switch --
+ *	Close a slot so no other threads join it, allocate log space for the
+ *	records joined, and replace it with the next slot in the pool.  The
+ *	slot's records are written when the last thread releases its piece,
+ *	while threads join the next slot.
  */
 int
-__wt_log_slot_close(WT_SESSION_IMPL *session, WT_LOGSLOT *slot)
+__wt_log_slot_switch(WT_SESSION_IMPL *session, WT_LOGSLOT *slot)
 {
 	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
 	WT_LOG *log;
 	WT_LOGSLOT *newslot;
-	int64_t old_state;
-	int32_t yields;
-	uint32_t pool_i, switch_fails;
+	int64_t new_state, old_state;
+	int free_slot, waited, yield_count;
+	WT_DECL_SPINLOCK_ID(id);			/* Must appear last */
 
 	conn = S2C(session);
 	log = conn->log;
-	switch_fails = 0;
-retry:
+
 	/*
-	 * Find an unused slot in the pool.
+	 * The caller may have joined the slot: once another thread has closed
+	 * it, don't wait for the lock, the thread holding it may be waiting
+	 * for the slot to be written so it can be reused.
 	 */
-	pool_i = log->pool_index;
-	newslot = &log->slot_pool[pool_i];
-	if (++log->pool_index >= SLOT_POOL)
-		log->pool_index = 0;
-	if (newslot->slot_state != WT_LOG_SLOT_FREE) {
-		WT_STAT_FAST_CONN_INCR(session, log_slot_switch_fails);
-		/*
-		 * If it takes a number of attempts to find an available slot
-		 * it's likely all slots are waiting to be released. This
-		 * churn is used to change how long we pause before closing
-		 * the slot - which leads to more consolidation and less churn.
-		 */
-		if (++switch_fails % SLOT_POOL == 0 && slot->slot_churn < 5)
-			++slot->slot_churn;
+	while (__wt_spin_trylock(session, &log->log_slot_lock, &id) != 0) {
+		old_state = slot->slot_state;
+		if (old_state < WT_LOG_SLOT_ACTIVE ||
+		    (old_state & WT_LOG_SLOT_CLOSE) != 0)
+			return (0);
 		__wt_yield();
-		goto retry;
-	} else if (slot->slot_churn > 0) {
-		--slot->slot_churn;
-		WT_ASSERT(session, slot->slot_churn >= 0);
 	}
 
-	/* Pause to allow other threads a chance to consolidate. */
-	for (yields = slot->slot_churn; yields >= 0; yields--)
-		__wt_yield();
+	/* Another thread may have already switched the slot. */
+	if (log->active_slot != slot) {
+		__wt_spin_unlock(session, &log->log_slot_lock);
+		return (0);
+	}
 
 	/*
-	 * Swap out the slot we're going to use and put a free one in the
-	 * slot array in its place so that threads can use it right away.
+	 * Close the slot: the joined size can't change after this, allocate
+	 * log space for it.  Threads that joined are filling in their records
+	 * while we do.
 	 */
+	do {
+		old_state = slot->slot_state;
+	} while (!WT_ATOMIC_CAS8(
+	    slot->slot_state, old_state, old_state | WT_LOG_SLOT_CLOSE));
 	WT_STAT_FAST_CONN_INCR(session, log_slot_closes);
-	newslot->slot_state = WT_LOG_SLOT_READY;
-	newslot->slot_index = slot->slot_index;
-	log->slot_array[newslot->slot_index] = &log->slot_pool[pool_i];
-	old_state = WT_ATOMIC_STORE8(slot->slot_state, WT_LOG_SLOT_PENDING);
-	slot->slot_group_size = (uint64_t)(old_state - WT_LOG_SLOT_READY);
+	slot->slot_group_size = (uint64_t)WT_LOG_SLOT_JOINED(old_state);
 	/*
 	 * Note that this statistic may be much bigger than in reality,
 	 * especially when compared with the total bytes written in
@@ -234,41 +216,87 @@ retry:
 	 * is the amount of user bytes.
 	 */
 	WT_STAT_FAST_CONN_INCRV(session,
-	    log_slot_consolidated, (uint64_t)slot->slot_group_size);
-	return (0);
-}
+	    log_slot_consolidated, slot->slot_group_size);
+	if ((ret = __wt_log_acquire(
+	    session, slot->slot_group_size, slot)) != 0) {
+		/*
+		 * Nothing can be written for the slot: write nothing at the
+		 * current end of the log, and report the error to the threads
+		 * that joined.
+		 */
+		slot->slot_error = ret;
+		slot->slot_release_lsn =
+		    slot->slot_start_lsn = slot->slot_end_lsn = log->alloc_lsn;
+		slot->slot_start_offset = log->alloc_lsn.offset;
+	}
 
-/*
- * __wt_log_slot_notify --
- *	Notify all threads waiting for the state to be < WT_LOG_SLOT_DONE.
- */
-int
-__wt_log_slot_notify(WT_SESSION_IMPL *session, WT_LOGSLOT *slot)
-{
-	WT_UNUSED(session);
+	/*
+	 * Replace the slot with the next one in the pool.  The next slot is
+	 * the oldest: if it isn't free, wait for its write to complete.  After
+	 * a failed write or sync of the log, give up: nothing more is written,
+	 * threads that joined the slot return the error.
+	 */
+	newslot = &log->slot_pool[(slot->slot_index + 1) % SLOT_POOL];
+	for (waited = yield_count = 0;
+	    newslot->slot_state != WT_LOG_SLOT_FREE; waited = 1) {
+		if ((ret = log->log_error) != 0) {
+			__wt_spin_unlock(session, &log->log_slot_lock);
+			return (ret);
+		}
+		if (++yield_count < 1000)
+			__wt_yield();
+		else
+			__wt_sleep(0, 200);
+	}
+	if (waited)
+		WT_STAT_FAST_CONN_INCR(session, log_slot_switch_waits);
+	newslot->slot_state = WT_LOG_SLOT_ACTIVE;
+	WT_PUBLISH(log->active_slot, newslot);
+	__wt_spin_unlock(session, &log->log_slot_lock);
 
-	slot->slot_state =
-	    (int64_t)WT_LOG_SLOT_DONE - (int64_t)slot->slot_group_size;
-	return (0);
+	/*
+	 * Tell threads that joined the slot its log space is allocated.  If
+	 * they have all released their piece, it's up to us to write it.
+	 */
+	new_state = WT_ATOMIC_ADD8(slot->slot_state, WT_LOG_SLOT_ALLOCATED);
+	if (WT_LOG_SLOT_DONE(new_state)) {
+		WT_TRET(__wt_log_release(session, slot, &free_slot));
+		if (free_slot)
+			WT_TRET(__wt_log_slot_free(session, slot));
+	}
+	return (ret);
 }
 
 /*
  * __wt_log_slot_wait --
- *	Wait for slot leader to allocate log area and tell us our log offset.
+ *	Wait for log space to be allocated for a slot we joined, the slot can
+ *	be closed by another thread.
  */
 int
 __wt_log_slot_wait(WT_SESSION_IMPL *session, WT_LOGSLOT *slot)
 {
+	WT_LOG *log;
 	int yield_count;
 
-	yield_count = 0;
-	WT_UNUSED(session);
+	log = S2C(session)->log;
+
+	if ((slot->slot_state & WT_LOG_SLOT_ALLOCATED) != 0)
+		return (0);
 
-	while (slot->slot_state > WT_LOG_SLOT_DONE)
+	WT_STAT_FAST_CONN_INCR(session, log_slot_allocate_waits);
+	for (yield_count = 0;
+	    (slot->slot_state & WT_LOG_SLOT_ALLOCATED) == 0;) {
+		/*
+		 * The thread closing the slot gives up after a failed write or
+		 * sync of the log.
+		 */
+		WT_RET(log->log_error);
 		if (++yield_count < 1000)
 			__wt_yield();
 		else
 			__wt_sleep(0, 200);
+	}
+	WT_READ_BARRIER();
 	return (0);
 }
 
@@ -280,14 +308,12 @@ __wt_log_slot_wait(WT_SESSION_IMPL *session, WT_LOGSLOT *slot)
 int64_t
 __wt_log_slot_release(WT_LOGSLOT *slot, uint64_t size)
 {
-	int64_t newsize;
-
 	/*
-	 * Add my size into the state.  When it reaches WT_LOG_SLOT_DONE
-	 * all participatory threads have completed copying their piece.
+	 * Add my size into the released bytes.  When the slot is allocated
+	 * and that matches the joined bytes, all participatory threads have
+	 * completed copying their piece.
 	 */
-	newsize = WT_ATOMIC_ADD8(slot->slot_state, (int64_t)size);
-	return (newsize);
+	return (WT_ATOMIC_ADD8(slot->slot_state, WT_LOG_SLOT_RELEASE(size)));
 }
 
 /*
@@ -303,7 +329,8 @@ __wt_log_slot_free(WT_SESSION_IMPL *session, WT_LOGSLOT *slot)
 	/*
 	 * Grow the buffer if needed before returning it to the pool.
 	 */
-	if (F_ISSET(slot, SLOT_BUF_GROW)) {
+	if (F_ISSET_ATOMIC(slot, SLOT_BUF_GROW) &&
+	    slot->slot_buf.memsize < (size_t)WT_LOG_SLOT_BUF_MAX) {
 		WT_STAT_FAST_CONN_INCR(session, log_buffer_grow);
 		WT_STAT_FAST_CONN_INCRV(session,
 		    log_buffer_size, slot->slot_buf.memsize);
@@ -320,17 +347,17 @@ err:
 	 * We have to reset them them here because multiple threads may
 	 * change the flags when joining the slot.
 	 */
-	slot->flags = SLOT_INIT_FLAGS;
-	slot->slot_state = WT_LOG_SLOT_FREE;
+	slot->flags_atomic = SLOT_INIT_FLAGS;
+	WT_PUBLISH(slot->slot_state, WT_LOG_SLOT_FREE);
 	return (ret);
 }
 
 /*
  * __wt_log_slot_grow_buffers --
  *	Increase the buffer size of all available slots in the buffer pool.
- *	Go to some lengths to include active (but unused) slots to handle
- *	the case where all log write record sizes exceed the size of the
- *	active buffer.
+ *	Go to some lengths to include the active slot if no thread has joined
+ *	it, to handle the case where all log write record sizes exceed the
+ *	size of the active buffer.
  */
 int
 __wt_log_slot_grow_buffers(WT_SESSION_IMPL *session, size_t newsize)
@@ -347,6 +374,11 @@ __wt_log_slot_grow_buffers(WT_SESSION_IMPL *session, size_t newsize)
 	log = conn->log;
 	total_growth = 0;
 	WT_STAT_FAST_CONN_INCR(session, log_buffer_grow);
+	/*
+	 * Records bigger than the largest slot buffer are always written
+	 * directly.
+	 */
+	newsize = WT_MIN(newsize, (size_t)WT_LOG_SLOT_BUF_MAX);
 	/*
 	 * Take the log slot lock to prevent other threads growing buffers
 	 * at the same time. Could tighten the scope of this lock, or have
@@ -357,27 +389,29 @@ __wt_log_slot_grow_buffers(WT_SESSION_IMPL *session, size_t newsize)
 		slot = &log->slot_pool[i];
 		/* Avoid atomic operations if they won't succeed. */
 		if (slot->slot_state != WT_LOG_SLOT_FREE &&
-		    slot->slot_state != WT_LOG_SLOT_READY)
+		    slot->slot_state != WT_LOG_SLOT_ACTIVE)
 			continue;
 		/* Don't keep growing unrelated buffers. */
 		if (slot->slot_buf.memsize > (10 * newsize) &&
-		    !F_ISSET(slot, SLOT_BUF_GROW))
+		    !F_ISSET_ATOMIC(slot, SLOT_BUF_GROW))
 			continue;
 		orig_state = WT_ATOMIC_CAS_VAL8(
 		    slot->slot_state, WT_LOG_SLOT_FREE, WT_LOG_SLOT_PENDING);
 		if (orig_state != WT_LOG_SLOT_FREE) {
 			orig_state = WT_ATOMIC_CAS_VAL8(slot->slot_state,
-			    WT_LOG_SLOT_READY, WT_LOG_SLOT_PENDING);
-			if (orig_state != WT_LOG_SLOT_READY)
+			    WT_LOG_SLOT_ACTIVE, WT_LOG_SLOT_PENDING);
+			if (orig_state != WT_LOG_SLOT_ACTIVE)
 				continue;
 		}
 
 		/* We have a slot - now go ahead and grow the buffer. */
 		old_size = slot->slot_buf.memsize;
-		F_CLR(slot, SLOT_BUF_GROW);
-		WT_ERR(__wt_buf_grow(session, &slot->slot_buf,
-		    WT_MAX(slot->slot_buf.memsize * 2, newsize)));
-		slot->slot_state = orig_state;
+		F_CLR_ATOMIC(slot, SLOT_BUF_GROW);
+		ret = __wt_buf_grow(session, &slot->slot_buf,
+		    WT_MIN(WT_MAX(slot->slot_buf.memsize * 2, newsize),
+		    (size_t)WT_LOG_SLOT_BUF_MAX));
+		WT_PUBLISH(slot->slot_state, orig_state);
+		WT_ERR(ret);
 		total_growth += slot->slot_buf.memsize - old_size;
 	}
 err:	__wt_spin_unlock(session, &log->log_slot_lock);
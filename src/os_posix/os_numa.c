@@ -0,0 +1,173 @@
+/*-
+ * Copyright (c) 2014-2015 MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+#if defined(__linux__)
+#include <sched.h>
+
+/*
+ * __numa_cpulist --
+ *	Parse a Linux CPU list ("0-3,8-11"), setting the node of each CPU.
+ */
+static int
+__numa_cpulist(WT_SESSION_IMPL *session,
+    const char *list, uint8_t node, uint8_t **cpu_nodep, u_int *cpusp)
+{
+	size_t bytes;
+	u_long first, last;
+	u_int cpu;
+	char *p;
+
+	for (p = (char *)list; *p != '\0' && *p != '\n';) {
+		first = last = strtoul(p, &p, 10);
+		if (*p == '-')
+			last = strtoul(p + 1, &p, 10);
+		if (*p == ',')
+			++p;
+		else if (*p != '\0' && *p != '\n')
+			goto format;
+		if (last < first || last >= CPU_SETSIZE)
+			goto format;
+
+		/* Grow the map as necessary, unknown CPUs map to node 0. */
+		if (last >= *cpusp) {
+			bytes = *cpusp;
+			WT_RET(__wt_realloc(
+			    session, &bytes, last + 1, cpu_nodep));
+			*cpusp = (u_int)last + 1;
+		}
+		for (cpu = (u_int)first; cpu <= last; ++cpu)
+			(*cpu_nodep)[cpu] = node;
+	}
+	return (0);
+
+format:	WT_RET_MSG(session, EINVAL, "unexpected NUMA CPU list: %s", list);
+}
+#endif
+
+/*
+ * __wt_numa_topology --
+ *	Return the number of NUMA nodes and a map from each CPU to its node.
+ * If the number of nodes is configured, CPUs are assigned to the nodes in
+ * turn.  Systems without NUMA information are treated as a single node.
+ */
+int
+__wt_numa_topology(WT_SESSION_IMPL *session,
+    u_int nodes_config, uint8_t **cpu_nodep, u_int *cpusp, u_int *nodesp)
+{
+	WT_DECL_RET;
+	u_int nodes;
+
+	*cpu_nodep = NULL;
+	*cpusp = 0;
+	nodes = 1;
+
+#if defined(__linux__)
+	{
+	FILE *fp;
+	long ncpus;
+	u_int cpu;
+	char buf[1024], path[64];
+
+	if (nodes_config != 0) {
+		if ((ncpus = sysconf(_SC_NPROCESSORS_CONF)) < 1)
+			ncpus = 1;
+		WT_RET(__wt_calloc_def(session, (size_t)ncpus, cpu_nodep));
+		*cpusp = (u_int)ncpus;
+		for (cpu = 0; cpu < *cpusp; ++cpu)
+			(*cpu_nodep)[cpu] = (uint8_t)(cpu % nodes_config);
+		nodes = nodes_config;
+	} else
+		for (nodes = 0; nodes < UINT8_MAX; ++nodes) {
+			(void)snprintf(path, sizeof(path),
+			    "/sys/devices/system/node/node%u/cpulist", nodes);
+			if ((fp = fopen(path, "r")) == NULL)
+				break;
+			if (fgets(buf, (int)sizeof(buf), fp) == NULL)
+				buf[0] = '\0';
+			(void)fclose(fp);
+			WT_ERR(__numa_cpulist(
+			    session, buf, (uint8_t)nodes, cpu_nodep, cpusp));
+		}
+	if (nodes == 0)
+		nodes = 1;
+	}
+#else
+	WT_UNUSED(session);
+	WT_UNUSED(nodes_config);
+#endif
+
+	*nodesp = nodes;
+	if (0) {
+#if defined(__linux__)
+err:		__wt_free(session, *cpu_nodep);
+		*cpusp = 0;
+#endif
+	}
+	return (ret);
+}
+
+/*
+ * __wt_numa_node --
+ *	Return the NUMA node of the CPU the calling thread is running on.
+ */
+u_int
+__wt_numa_node(WT_SESSION_IMPL *session)
+{
+	WT_CACHE *cache;
+
+	cache = S2C(session)->cache;
+
+#if defined(__linux__)
+	{
+	int cpu;
+
+	if ((cpu = sched_getcpu()) >= 0 && (u_int)cpu < cache->numa_cpus)
+		return (cache->numa_cpu_node[cpu]);
+	}
+#else
+	WT_UNUSED(cache);
+#endif
+	return (0);
+}
+
+/*
+ * __wt_numa_bind --
+ *	Bind the calling thread to the CPUs of a NUMA node.
+ */
+int
+__wt_numa_bind(WT_SESSION_IMPL *session, u_int node)
+{
+	WT_CACHE *cache;
+
+	cache = S2C(session)->cache;
+
+#if defined(__linux__)
+	{
+	cpu_set_t set;
+	u_int cpu, cpus;
+
+	CPU_ZERO(&set);
+	for (cpus = cpu = 0; cpu < cache->numa_cpus; ++cpu)
+		if (cache->numa_cpu_node[cpu] == node) {
+			CPU_SET(cpu, &set);
+			++cpus;
+		}
+
+	/* A node without CPUs has nothing to bind to. */
+	if (cpus != 0 && sched_setaffinity(0, sizeof(set), &set) != 0)
+		WT_RET_MSG(session, __wt_errno(),
+		    "unable to bind thread to NUMA node %u", node);
+	}
+#else
+	WT_UNUSED(cache);
+	WT_UNUSED(node);
+#endif
+	return (0);
+}
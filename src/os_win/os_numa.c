@@ -0,0 +1,52 @@
+/*-
+ * Copyright (c) 2014-2015 MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * __wt_numa_topology --
+ *	Return the number of NUMA nodes and a map from each CPU to its node,
+ * Windows is treated as a single node.
+ */
+int
+__wt_numa_topology(WT_SESSION_IMPL *session,
+    u_int nodes_config, uint8_t **cpu_nodep, u_int *cpusp, u_int *nodesp)
+{
+	WT_UNUSED(session);
+	WT_UNUSED(nodes_config);
+
+	*cpu_nodep = NULL;
+	*cpusp = 0;
+	*nodesp = 1;
+	return (0);
+}
+
+/*
+ * __wt_numa_node --
+ *	Return the NUMA node of the CPU the calling thread is running on.
+ */
+u_int
+__wt_numa_node(WT_SESSION_IMPL *session)
+{
+	WT_UNUSED(session);
+
+	return (0);
+}
+
+/*
+ * __wt_numa_bind --
+ *	Bind the calling thread to the CPUs of a NUMA node.
+ */
+int
+__wt_numa_bind(WT_SESSION_IMPL *session, u_int node)
+{
+	WT_UNUSED(session);
+	WT_UNUSED(node);
+
+	return (0);
+}
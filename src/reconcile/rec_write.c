@@ -624,6 +624,9 @@ __rec_write_init(WT_SESSION_IMPL *session,
 	/* Track if the page can be marked clean. */
 	r->leave_dirty = 0;
 
+	/* Track the maximum transaction ID written. */
+	r->max_txn = WT_TXN_NONE;
+
 	/* Raw compression. */
 	r->raw_compression =
 	    __rec_raw_compression_config(session, page, salvage);
@@ -828,6 +831,74 @@ __rec_skip_update_move(
 	return (0);
 }
 
+/*
+ * __rec_txn_read_las --
+ *	Evicting with the lookaside table: return the newest update in a list,
+ *	and save the list so the updates readers may still need are copied into
+ *	the lookaside table when the block is written.
+ */
+static int
+__rec_txn_read_las(WT_SESSION_IMPL *session, WT_RECONCILE *r,
+    WT_INSERT *ins, WT_ROW *rip, WT_CELL_UNPACK *vpack, WT_UPDATE **updp)
+{
+	WT_DECL_ITEM(tmp);
+	WT_DECL_RET;
+	WT_PAGE *page;
+	WT_UPDATE *upd, *upd_list, *upd_orig;
+	size_t notused;
+
+	page = r->page;
+
+	/* Eviction may have stopped using the lookaside table. */
+	if (!__wt_cache_lookaside(session, page))
+		return (EBUSY);
+
+	/*
+	 * Every update readers may need must be committed: an update that may
+	 * still be rolled back can't be moved out of memory.  The newest update
+	 * is written to the page, updates older than the first globally visible
+	 * update are never read.
+	 */
+	upd_list = ins == NULL ? WT_ROW_UPDATE(page, rip) : ins->upd;
+	for (upd = upd_list; upd != NULL; upd = upd->next) {
+		if (upd->txnid == WT_TXN_ABORTED)
+			continue;
+		if (!__wt_txn_upd_committed(session, upd))
+			return (EBUSY);
+		if (*updp == NULL)
+			*updp = upd;
+		if (__wt_txn_upd_visible_all(session, upd))
+			break;
+	}
+	if (*updp == NULL)
+		return (0);
+
+	/*
+	 * If no update is globally visible, readers may need the original value
+	 * the updates replaced, which isn't being written: append an update
+	 * with the original value (or a deleted update if there was no original
+	 * value), visible to every transaction, to the list.
+	 */
+	if (upd == NULL) {
+		if (vpack != NULL && vpack->type != WT_CELL_DEL) {
+			WT_ERR(__wt_scr_alloc(session, 0, &tmp));
+			WT_ERR(__wt_page_cell_data_ref(
+			    session, page, vpack, tmp));
+		} else if (vpack == NULL && rip != NULL)
+			WT_ERR(__wt_scr_alloc(session, 0, &tmp));
+		WT_ERR(__wt_update_alloc(session, tmp, &upd_orig, &notused));
+		upd_orig->txnid = WT_TXN_NONE;
+		for (upd = upd_list; upd->next != NULL; upd = upd->next)
+			;
+		upd->next = upd_orig;
+	}
+
+	ret = __rec_skip_update_save(session, r, ins, rip);
+
+err:	__wt_scr_free(session, &tmp);
+	return (ret);
+}
+
 /*
  * __rec_txn_read --
  *	Return the first visible update in a list (or NULL if none are visible),
@@ -842,7 +913,7 @@ __rec_txn_read(WT_SESSION_IMPL *session, WT_RECONCILE *r,
 	WT_PAGE *page;
 	WT_UPDATE *upd, *upd_list, *upd_ovfl;
 	size_t notused;
-	uint64_t max_txn, min_txn, txnid;
+	uint64_t max_ts, max_txn, min_txn, txnid;
 	int skipped;
 
 	*updp = NULL;
@@ -856,16 +927,21 @@ __rec_txn_read(WT_SESSION_IMPL *session, WT_RECONCILE *r,
 	upd_list = ins == NULL ? WT_ROW_UPDATE(page, rip) : ins->upd;
 	skipped = 0;
 
-	for (max_txn = WT_TXN_NONE, min_txn = UINT64_MAX, upd = upd_list;
-	    upd != NULL; upd = upd->next) {
+	for (max_ts = 0, max_txn = WT_TXN_NONE, min_txn = UINT64_MAX,
+	    upd = upd_list; upd != NULL; upd = upd->next) {
 		if ((txnid = upd->txnid) == WT_TXN_ABORTED)
 			continue;
 
-		/* Track the largest/smallest transaction IDs on the list. */
+		/*
+		 * Track the largest/smallest transaction IDs on the list, and
+		 * the largest commit timestamp.
+		 */
 		if (TXNID_LT(max_txn, txnid))
 			max_txn = txnid;
 		if (TXNID_LT(txnid, min_txn))
 			min_txn = txnid;
+		if (upd->timestamp > max_ts)
+			max_ts = upd->timestamp;
 		if (TXNID_LT(txnid, r->skipped_txn) &&
 		    !__wt_txn_visible_all(session, txnid))
 			r->skipped_txn = txnid;
@@ -881,7 +957,7 @@ __rec_txn_read(WT_SESSION_IMPL *session, WT_RECONCILE *r,
 		 * reconciled until modified again.
 		 */
 		if (*updp == NULL) {
-			if (__wt_txn_visible(session, txnid))
+			if (__wt_txn_upd_visible(session, upd))
 				*updp = upd;
 			else
 				skipped = 1;
@@ -898,17 +974,28 @@ __rec_txn_read(WT_SESSION_IMPL *session, WT_RECONCILE *r,
 		r->max_txn = max_txn;
 
 	/*
-	 * If all updates are globally visible and no updates were skipped, the
-	 * page can be marked clean and we're done, regardless of whether we're
-	 * evicting or checkpointing.
+	 * If all updates are globally visible (including to readers at the
+	 * oldest timestamp) and no updates were skipped, the page can be marked
+	 * clean and we're done, regardless of whether we're evicting or
+	 * checkpointing.
 	 *
 	 * The oldest transaction ID may have moved while we were scanning the
 	 * page, so it is possible to skip an update but then find that by the
 	 * end of the scan, all updates are stable.
 	 */
-	if (__wt_txn_visible_all(session, max_txn) && !skipped)
+	if (__wt_txn_visible_all(session, max_txn) &&
+	    __wt_txn_timestamp_visible_all(session, max_ts) && !skipped)
 		return (0);
 
+	/*
+	 * If evicting with the lookaside table, the page is written as if all
+	 * updates were visible, and can be marked clean.
+	 */
+	if (F_ISSET(r, WT_SKIP_UPDATE_LOOKASIDE)) {
+		*updp = NULL;
+		return (__rec_txn_read_las(session, r, ins, rip, vpack, updp));
+	}
+
 	/*
 	 * If some updates are not globally visible, or were skipped, the page
 	 * cannot be marked clean.
@@ -2721,6 +2808,106 @@ err:	__wt_scr_free(session, &tmp);
 	return (ret);
 }
 
+/*
+ * __rec_update_las --
+ *	Copy a written block's skipped updates into the lookaside table.
+ */
+static int
+__rec_update_las(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_BOUNDARY *bnd)
+{
+	WT_BTREE *btree;
+	WT_CONNECTION_IMPL *conn;
+	WT_CURSOR *cursor;
+	WT_DECL_ITEM(key);
+	WT_DECL_RET;
+	WT_ITEM las_addr, las_value;
+	WT_PAGE *page;
+	WT_UPDATE *upd, *upd_onpage;
+	WT_UPD_SKIPPED *skip;
+	uint32_t i;
+	uint8_t *p;
+
+	btree = S2BT(session);
+	conn = S2C(session);
+	page = r->page;
+
+	WT_CLEAR(las_addr);
+	las_addr.data = bnd->addr.addr;
+	las_addr.size = bnd->addr.size;
+	WT_CLEAR(las_value);
+	upd = NULL;
+
+	WT_RET(__wt_scr_alloc(session, WT_INTPACK64_MAXSIZE, &key));
+
+	__wt_las_cursor(session, &cursor);
+	if (cursor == NULL)
+		WT_ERR(EBUSY);
+
+	/* Once records are written, reads of the tree must check for them. */
+	btree->lookaside = 1;
+	conn->las_written = 1;
+
+	for (i = 0, skip = bnd->skip; i < bnd->skip_next; ++i, ++skip) {
+		switch (page->type) {
+		case WT_PAGE_COL_VAR:
+			p = key->mem;
+			WT_ERR(__wt_vpack_uint(
+			    &p, 0, WT_INSERT_RECNO(skip->ins)));
+			key->size = WT_PTRDIFF(p, key->data);
+			upd = skip->ins->upd;
+			break;
+		case WT_PAGE_ROW_LEAF:
+			if (skip->ins == NULL) {
+				WT_ERR(__wt_row_leaf_key(
+				    session, page, skip->rip, key, 0));
+				upd = WT_ROW_UPDATE(page, skip->rip);
+			} else {
+				key->data = WT_INSERT_KEY(skip->ins);
+				key->size = WT_INSERT_KEY_SIZE(skip->ins);
+				upd = skip->ins->upd;
+			}
+			break;
+		WT_ILLEGAL_VALUE_ERR(session);
+		}
+
+		/*
+		 * The first update that wasn't aborted was written to the page,
+		 * every record is kept until it's globally visible.  Records
+		 * are inserted newest first, up to the first globally visible
+		 * update, older updates can't be read.
+		 */
+		while (upd->txnid == WT_TXN_ABORTED)
+			upd = upd->next;
+		for (upd_onpage = upd; upd != NULL; upd = upd->next) {
+			if (upd->txnid == WT_TXN_ABORTED)
+				continue;
+
+			if (WT_UPDATE_DELETED_ISSET(upd))
+				las_value.size = 0;
+			else {
+				las_value.data = WT_UPDATE_DATA(upd);
+				las_value.size = upd->size;
+			}
+			cursor->set_key(cursor,
+			    btree->id, &las_addr, ++conn->las_counter);
+			cursor->set_value(cursor,
+			    upd_onpage->txnid, upd_onpage->timestamp,
+			    upd->txnid, upd->timestamp,
+			    WT_UPDATE_DELETED_ISSET(upd) ? 1 : 0,
+			    key, &las_value);
+			WT_ERR(cursor->insert(cursor));
+			WT_STAT_FAST_CONN_INCR(session, cache_lookaside_insert);
+
+			if (__wt_txn_upd_visible_all(session, upd))
+				break;
+		}
+	}
+
+err:	WT_TRET(__wt_las_cursor_close(session, &cursor));
+	__wt_scr_free(session, &key);
+	return (ret);
+}
+
 /*
  * __rec_split_write --
  *	Write a disk block out for the split helper functions.
@@ -2838,8 +3025,16 @@ skip_check_complete:
 	 * If we had to skip updates in order to build this disk image, we can't
 	 * actually write it. Instead, we will re-instantiate the page using the
 	 * disk image and the list of updates we skipped.
+	 *
+	 * The exception is evicting with the lookaside table: the block is
+	 * written, and the updates are copied into the lookaside table keyed by
+	 * the block's address.  A block with no entries has no address, in
+	 * that case the page can't be evicted.
 	 */
-	if (bnd->skip != NULL) {
+	if (bnd->skip != NULL && F_ISSET(r, WT_SKIP_UPDATE_LOOKASIDE)) {
+		if (dsk->u.entries == 0)
+			WT_ERR(EBUSY);
+	} else if (bnd->skip != NULL) {
 		/*
 		 * If the buffer is compressed (raw compression was configured),
 		 * we have to decompress it so we can instantiate it later. It's
@@ -2873,8 +3068,8 @@ skip_check_complete:
 	 * the first time the page splits.
 	 */
 	bnd_slot = (uint32_t)(bnd - r->bnd);
-	if (bnd_slot > 1 ||
-	    (F_ISSET(mod, WT_PM_REC_MULTIBLOCK) && mod->mod_multi != NULL)) {
+	if (bnd->skip == NULL && (bnd_slot > 1 ||
+	    (F_ISSET(mod, WT_PM_REC_MULTIBLOCK) && mod->mod_multi != NULL))) {
 		/*
 		 * There are page header fields which need to be cleared to get
 		 * consistent checksums: specifically, the write generation and
@@ -2905,6 +3100,18 @@ skip_check_complete:
 	WT_ERR(__wt_strndup(session, addr, addr_size, &bnd->addr.addr));
 	bnd->addr.size = (uint8_t)addr_size;
 
+	/*
+	 * If evicting with the lookaside table, copy the skipped updates into
+	 * the table, then discard the list: the block is otherwise handled as
+	 * if no updates were skipped.
+	 */
+	if (bnd->skip != NULL) {
+		WT_ERR(__rec_update_las(session, r, bnd));
+		__wt_free(session, bnd->skip);
+		bnd->skip_next = 0;
+		bnd->skip_allocated = 0;
+	}
+
 done:
 err:	__wt_scr_free(session, &key);
 	return (ret);
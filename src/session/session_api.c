@@ -72,7 +72,7 @@ __session_clear(WT_SESSION_IMPL *session)
 	 * For these reasons, be careful when clearing the session structure.
 	 */
 	memset(session, 0, WT_SESSION_CLEAR_SIZE(session));
-	session->hazard_size = 0;
+	session->hazard_inuse = 0;
 	session->nhazard = 0;
 }
 
@@ -198,6 +198,16 @@ __session_reconfigure(WT_SESSION *wt_session, const char *config)
 
 	WT_TRET(__wt_session_reset_cursors(session));
 
+	WT_ERR(__wt_config_gets_def(
+	    session, cfg, "eviction_pages_max", 0, &cval));
+	if (cval.len != 0)
+		session->evict_pages_max = (u_int)cval.val;
+
+	WT_ERR(
+	    __wt_config_gets_def(session, cfg, "eviction_wait_max", 0, &cval));
+	if (cval.len != 0)
+		session->evict_wait_max = (uint64_t)cval.val;
+
 	WT_ERR(__wt_config_gets_def(session, cfg, "isolation", 0, &cval));
 	if (cval.len != 0)
 		session->isolation = session->txn.isolation =
@@ -703,6 +713,27 @@ err:	TXN_API_END_RETRY(session, ret, 0);
 	return (ret == WT_NOTFOUND && uri != NULL ? ENOENT : ret);
 }
 
+/*
+ * __session_write_batch --
+ *	WT_SESSION->write_batch method.
+ */
+static int
+__session_write_batch(WT_SESSION *wt_session,
+    WT_BATCH_OP *ops, uint32_t count, const char *config)
+{
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+
+	session = (WT_SESSION_IMPL *)wt_session;
+	SESSION_TXN_API_CALL(session, write_batch, config, cfg);
+	WT_UNUSED(cfg);
+
+	ret = __wt_session_write_batch(session, ops, count);
+
+err:	TXN_API_END_RETRY(session, ret, 0);
+	return (ret);
+}
+
 /*
  * __session_upgrade --
  *	WT_SESSION->upgrade method.
@@ -771,6 +802,24 @@ __session_begin_transaction(WT_SESSION *wt_session, const char *config)
 err:	API_END_RET(session, ret);
 }
 
+/*
+ * __session_prepare_transaction --
+ *	WT_SESSION->prepare_transaction method.
+ */
+static int
+__session_prepare_transaction(WT_SESSION *wt_session, const char *config)
+{
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+
+	session = (WT_SESSION_IMPL *)wt_session;
+	SESSION_API_CALL(session, prepare_transaction, config, cfg);
+
+	ret = __wt_txn_prepare(session, cfg);
+
+err:	API_END_RET(session, ret);
+}
+
 /*
  * __session_commit_transaction --
  *	WT_SESSION->commit_transaction method.
@@ -778,6 +827,7 @@ err:	API_END_RET(session, ret);
 static int
 __session_commit_transaction(WT_SESSION *wt_session, const char *config)
 {
+	WT_CONFIG_ITEM cval;
 	WT_DECL_RET;
 	WT_SESSION_IMPL *session;
 	WT_TXN *txn;
@@ -786,6 +836,14 @@ __session_commit_transaction(WT_SESSION *wt_session, const char *config)
 	SESSION_API_CALL(session, commit_transaction, config, cfg);
 	WT_STAT_FAST_CONN_INCR(session, txn_commit);
 
+	/* Commit a prepared transaction recovered by its identifier. */
+	WT_ERR(__wt_config_gets_def(session, cfg, "prepare_id", 0, &cval));
+	if (cval.val != 0) {
+		ret = __wt_txn_prepare_resolve(
+		    session, (uint64_t)cval.val, cfg, 1);
+		goto err;
+	}
+
 	txn = &session->txn;
 	if (F_ISSET(txn, TXN_ERROR)) {
 		__wt_errx(session, "failed transaction requires rollback");
@@ -809,6 +867,7 @@ err:	API_END_RET(session, ret);
 static int
 __session_rollback_transaction(WT_SESSION *wt_session, const char *config)
 {
+	WT_CONFIG_ITEM cval;
 	WT_DECL_RET;
 	WT_SESSION_IMPL *session;
 
@@ -816,6 +875,14 @@ __session_rollback_transaction(WT_SESSION *wt_session, const char *config)
 	SESSION_API_CALL(session, rollback_transaction, config, cfg);
 	WT_STAT_FAST_CONN_INCR(session, txn_rollback);
 
+	/* Roll back a prepared transaction recovered by its identifier. */
+	WT_ERR(__wt_config_gets_def(session, cfg, "prepare_id", 0, &cval));
+	if (cval.val != 0) {
+		ret = __wt_txn_prepare_resolve(
+		    session, (uint64_t)cval.val, cfg, 0);
+		goto err;
+	}
+
 	WT_TRET(__wt_session_reset_cursors(session));
 
 	WT_TRET(__wt_txn_rollback(session, cfg));
@@ -1012,9 +1079,11 @@ __wt_open_session(WT_CONNECTION_IMPL *conn,
 		__session_rename,
 		__session_salvage,
 		__session_truncate,
+		__session_write_batch,
 		__session_upgrade,
 		__session_verify,
 		__session_begin_transaction,
+		__session_prepare_transaction,
 		__session_commit_transaction,
 		__session_rollback_transaction,
 		__session_checkpoint,
@@ -1099,14 +1168,6 @@ __wt_open_session(WT_CONNECTION_IMPL *conn,
 		WT_ERR(__wt_calloc_def(
 		    session, conn->hazard_max, &session_ret->hazard));
 
-	/*
-	 * Set an initial size for the hazard array. It will be grown as
-	 * required up to hazard_max. The hazard_size is reset on close, since
-	 * __wt_hazard_close ensures the array is cleared - so it is safe to
-	 * reset the starting size on each open.
-	 */
-	session_ret->hazard_size = WT_HAZARD_INCR;
-
 	/*
 	 * Configuration: currently, the configuration for open_session is the
 	 * same as session.reconfigure, so use that function.
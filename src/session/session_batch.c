@@ -0,0 +1,170 @@
+/*-
+ * Copyright (c) 2014-2015 MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * A write batch applies many insert, update and remove operations in a single
+ * call and a single transaction.  When every operation is on a row-store tree
+ * using the default collator, the operations are sorted by tree and key, and
+ * applied directly to the trees: each operation leaves its cursor positioned,
+ * and if the next key is on the same leaf page, only that page is searched.
+ * Otherwise, the operations are applied in batch order through their cursors'
+ * methods.
+ */
+
+/*
+ * __batch_compare --
+ *	Qsort function: sort write batch operations by tree and key, keeping
+ *	operations on the same key in batch order.
+ */
+static int
+__batch_compare(const void *a, const void *b)
+{
+	WT_BATCH_OP *aop, *bop;
+	uintptr_t abtree, bbtree;
+	int cmp;
+
+	aop = *(WT_BATCH_OP **)a;
+	bop = *(WT_BATCH_OP **)b;
+
+	abtree = (uintptr_t)((WT_CURSOR_BTREE *)aop->cursor)->btree;
+	bbtree = (uintptr_t)((WT_CURSOR_BTREE *)bop->cursor)->btree;
+	if (abtree != bbtree)
+		return (abtree < bbtree ? -1 : 1);
+	if ((cmp = __wt_lex_compare(&aop->key, &bop->key)) != 0)
+		return (cmp);
+	return ((uintptr_t)aop < (uintptr_t)bop ? -1 : 1);
+}
+
+/*
+ * __batch_reset --
+ *	Reset the cursors referenced by a write batch.
+ */
+static int
+__batch_reset(WT_BATCH_OP *ops, uint32_t count)
+{
+	WT_CURSOR *cursor;
+	WT_DECL_RET;
+	uint32_t i;
+
+	for (cursor = NULL, i = 0; i < count; ++i)
+		if (ops[i].cursor != cursor) {
+			cursor = ops[i].cursor;
+			WT_TRET(cursor->reset(cursor));
+		}
+	return (ret);
+}
+
+/*
+ * __batch_apply --
+ *	Apply a write batch operation through its cursor's methods.
+ */
+static int
+__batch_apply(WT_SESSION_IMPL *session, WT_BATCH_OP *op)
+{
+	WT_CURSOR *cursor;
+
+	cursor = op->cursor;
+	__wt_cursor_set_raw_key(cursor, &op->key);
+	switch (op->type) {
+	case WT_BATCH_INSERT:
+		__wt_cursor_set_raw_value(cursor, &op->value);
+		return (cursor->insert(cursor));
+	case WT_BATCH_REMOVE:
+		return (cursor->remove(cursor));
+	case WT_BATCH_UPDATE:
+		__wt_cursor_set_raw_value(cursor, &op->value);
+		return (cursor->update(cursor));
+	WT_ILLEGAL_VALUE(session);
+	}
+	/* NOTREACHED */
+}
+
+/*
+ * __wt_session_write_batch --
+ *	WT_SESSION.write_batch.
+ */
+int
+__wt_session_write_batch(
+    WT_SESSION_IMPL *session, WT_BATCH_OP *ops, uint32_t count)
+{
+	WT_BATCH_OP *op, **sorted;
+	WT_DECL_RET;
+	size_t logsize;
+	uint32_t i;
+	int sort;
+
+	sorted = NULL;
+
+	/* Check the batch before changing anything. */
+	logsize = 0;
+	sort = 1;
+	for (i = 0, op = ops; i < count; ++i, ++op) {
+		if (op->cursor == NULL ||
+		    op->cursor->session != &session->iface)
+			WT_RET_MSG(session, EINVAL,
+			    "write batch operation %" PRIu32 " does not "
+			    "reference a cursor open in this session", i);
+		switch (op->type) {
+		case WT_BATCH_REMOVE:
+			logsize += op->key.size;
+			break;
+		case WT_BATCH_INSERT:
+		case WT_BATCH_UPDATE:
+			logsize += op->key.size + op->value.size;
+			break;
+		default:
+			WT_RET_MSG(session, EINVAL,
+			    "write batch operation %" PRIu32 " has an unknown "
+			    "type", i);
+		}
+		logsize += 4 * WT_INTPACK32_MAXSIZE;
+		if (sort && !__wt_curfile_batch_sorted(op->cursor))
+			sort = 0;
+	}
+	if (count == 0)
+		return (0);
+
+	WT_STAT_FAST_CONN_INCR(session, cursor_write_batch);
+	WT_STAT_FAST_CONN_INCRV(session, cursor_write_batch_ops, count);
+
+	/*
+	 * Start the transaction if the call is auto-committed, and make room
+	 * for the batch's updates.
+	 */
+	WT_RET(__wt_txn_autocommit_check(session));
+	WT_RET(__wt_txn_reserve(session, count, logsize));
+
+	WT_RET(__wt_calloc_def(session, count, &sorted));
+	for (i = 0; i < count; ++i)
+		sorted[i] = &ops[i];
+	if (sort)
+		qsort(sorted, count, sizeof(WT_BATCH_OP *), __batch_compare);
+
+	/*
+	 * Sorted operations reuse the leaf page of the cursor's previous key:
+	 * discard any position the cursors had before the batch.
+	 */
+	WT_ERR(__batch_reset(ops, count));
+
+	for (i = 0; i < count; ++i)
+		WT_ERR(sort ? __wt_curfile_batch(sorted[i]->cursor, sorted[i]) :
+		    __batch_apply(session, sorted[i]));
+
+	/*
+	 * A failed batch may have applied some of its operations, the
+	 * transaction can only be rolled back.
+	 */
+err:	WT_TRET(__batch_reset(ops, count));
+	if (ret != 0)
+		F_SET(&session->txn, TXN_ERROR);
+
+	__wt_free(session, sorted);
+	return (ret);
+}
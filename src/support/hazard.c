@@ -26,7 +26,7 @@ __wt_hazard_set(WT_SESSION_IMPL *session, WT_REF *ref, int *busyp
 	WT_BTREE *btree;
 	WT_CONNECTION_IMPL *conn;
 	WT_HAZARD *hp;
-	int restarts = 0;
+	uint32_t slot;
 
 	btree = S2BT(session);
 	conn = S2C(session);
@@ -36,6 +36,30 @@ __wt_hazard_set(WT_SESSION_IMPL *session, WT_REF *ref, int *busyp
 	if (F_ISSET(btree, WT_BTREE_NO_HAZARD))
 		return (0);
 
+	/*
+	 * Find a free slot.  Hazard pointers are almost always released in
+	 * LIFO order, so there are rarely unused slots below the last slot in
+	 * use: if there are none, take the next slot and publish the new
+	 * in-use count, otherwise search for the unused slot.  Either way,
+	 * the search never goes past the slots in use.
+	 */
+	if (session->nhazard < session->hazard_inuse) {
+		for (hp = session->hazard; hp->page != NULL; ++hp)
+			;
+		slot = (uint32_t)(hp - session->hazard);
+	} else {
+		slot = session->hazard_inuse;
+		if (slot >= conn->hazard_max) {
+			__wt_errx(session,
+			    "session %p: hazard pointer table full", session);
+#ifdef HAVE_DIAGNOSTIC
+			__hazard_dump(session);
+#endif
+			return (ENOMEM);
+		}
+		hp = session->hazard + slot;
+	}
+
 	/*
 	 * Do the dance:
 	 *
@@ -48,85 +72,52 @@ __wt_hazard_set(WT_SESSION_IMPL *session, WT_REF *ref, int *busyp
 	 * use the page because the page eviction server will see our hazard
 	 * pointer before it discards the page (the eviction server sets the
 	 * state to WT_REF_LOCKED, then flushes memory and checks the hazard
-	 * pointers).
-	 *
-	 * For sessions with many active hazard pointers, skip most of the
-	 * active slots: there may be a free slot in there, but checking is
-	 * expensive.  Most hazard pointers are released quickly: optimize
-	 * for that case.
+	 * pointers).  The in-use count is written before the flush, so a
+	 * thread checking the hazard pointers sees both or we see the new
+	 * page state.
 	 */
-	for (hp = session->hazard + session->nhazard;; ++hp) {
-		/*
-		 * If we get to the end of the array, either:
-		 * 1. If we know there are free slots somewhere, and this is
-		 *    the first time through, continue the search from the
-		 *    start.  Don't actually continue the loop because that
-		 *    will skip the first slot.
-		 * 2. If we have searched all the way through and we have
-		 *    allocated the maximum number of slots, give up.
-		 * 3. Allocate another increment of slots, up to the maximum.
-		 *    The slot we are on should now be available.
-		 */
-		if (hp >= session->hazard + session->hazard_size) {
-			if (session->nhazard < session->hazard_size &&
-			    restarts++ == 0)
-				hp = session->hazard;
-			else if (session->hazard_size >= conn->hazard_max)
-				break;
-			else
-				WT_PUBLISH(session->hazard_size, WT_MIN(
-				    session->hazard_size + WT_HAZARD_INCR,
-				    conn->hazard_max));
-		}
-
-		if (hp->page != NULL)
-			continue;
-
-		hp->page = ref->page;
+	hp->page = ref->page;
 #ifdef HAVE_DIAGNOSTIC
-		hp->file = file;
-		hp->line = line;
+	hp->file = file;
+	hp->line = line;
 #endif
-		/* Publish the hazard pointer before reading page's state. */
-		WT_FULL_BARRIER();
-
-		/*
-		 * Check if the page state is still valid, where valid means a
-		 * state of WT_REF_MEM and the pointer is unchanged.  (The
-		 * pointer can change, it means the page was evicted between
-		 * the time we set our hazard pointer and the publication.  It
-		 * would theoretically be possible for the page to be evicted
-		 * and a different page read into the same memory, so the
-		 * pointer hasn't changed but the contents have.  That's OK, we
-		 * found this page using the tree's key space, whatever page we
-		 * find here is the page for us to use.)
-		 */
-		if (ref->page == hp->page && ref->state == WT_REF_MEM) {
-			++session->nhazard;
-			return (0);
-		}
+	if (slot == session->hazard_inuse)
+		session->hazard_inuse = slot + 1;
+
+	/* Publish the hazard pointer before reading page's state. */
+	WT_FULL_BARRIER();
 
-		/*
-		 * The page isn't available, it's being considered for eviction
-		 * (or being evicted, for all we know).  If the eviction server
-		 * sees our hazard pointer before evicting the page, it will
-		 * return the page to use, no harm done, if it doesn't, it will
-		 * go ahead and complete the eviction.
-		 *
-		 * We don't bother publishing this update: the worst case is we
-		 * prevent some random page from being evicted.
-		 */
-		hp->page = NULL;
-		*busyp = 1;
+	/*
+	 * Check if the page state is still valid, where valid means a
+	 * state of WT_REF_MEM and the pointer is unchanged.  (The
+	 * pointer can change, it means the page was evicted between
+	 * the time we set our hazard pointer and the publication.  It
+	 * would theoretically be possible for the page to be evicted
+	 * and a different page read into the same memory, so the
+	 * pointer hasn't changed but the contents have.  That's OK, we
+	 * found this page using the tree's key space, whatever page we
+	 * find here is the page for us to use.)
+	 */
+	if (ref->page == hp->page && ref->state == WT_REF_MEM) {
+		++session->nhazard;
 		return (0);
 	}
 
-	__wt_errx(session, "session %p: hazard pointer table full", session);
-#ifdef HAVE_DIAGNOSTIC
-	__hazard_dump(session);
-#endif
-
-	return (ENOMEM);
+	/*
+	 * The page isn't available, it's being considered for eviction
+	 * (or being evicted, for all we know).  If the eviction server
+	 * sees our hazard pointer before evicting the page, it will
+	 * return the page to use, no harm done, if it doesn't, it will
+	 * go ahead and complete the eviction.
+	 *
+	 * We don't bother publishing this update: the worst case is we
+	 * prevent some random page from being evicted.
+	 */
+	hp->page = NULL;
+	if (slot == session->hazard_inuse - 1)
+		session->hazard_inuse = slot;
+	*busyp = 1;
+	return (0);
 }
 
 /*
@@ -149,7 +140,7 @@ __wt_hazard_clear(WT_SESSION_IMPL *session, WT_PAGE *page)
 	 * Clear the caller's hazard pointer.
 	 * The common pattern is LIFO, so do a reverse search.
 	 */
-	for (hp = session->hazard + session->hazard_size - 1;
+	for (hp = session->hazard + session->hazard_inuse - 1;
 	    hp >= session->hazard;
 	    --hp)
 		if (hp->page == page) {
@@ -168,6 +159,19 @@ __wt_hazard_clear(WT_SESSION_IMPL *session, WT_PAGE *page)
 			 * we may need to update our transactional context.
 			 */
 			--session->nhazard;
+
+			/*
+			 * Shrink the slots in use past any unused slots at the
+			 * end of the array.  Like the clear, there's no need to
+			 * publish: a thread seeing a larger count reviews some
+			 * unused slots, no harm done.
+			 */
+			if (session->nhazard == 0)
+				session->hazard_inuse = 0;
+			else
+				while (session->hazard[
+				    session->hazard_inuse - 1].page == NULL)
+					--session->hazard_inuse;
 			return (0);
 		}
 
@@ -195,7 +199,7 @@ __wt_hazard_close(WT_SESSION_IMPL *session)
 	 * diagnostic.
 	 */
 	for (found = 0, hp = session->hazard;
-	    hp < session->hazard + session->hazard_size; ++hp)
+	    hp < session->hazard + session->hazard_inuse; ++hp)
 		if (hp->page != NULL) {
 			found = 1;
 			break;
@@ -222,11 +226,12 @@ __wt_hazard_close(WT_SESSION_IMPL *session)
 	 * can't think of a reason it would be).
 	 */
 	for (hp = session->hazard;
-	    hp < session->hazard + session->hazard_size; ++hp)
+	    hp < session->hazard + session->hazard_inuse; ++hp)
 		if (hp->page != NULL) {
 			hp->page = NULL;
 			--session->nhazard;
 		}
+	session->hazard_inuse = 0;
 
 	if (session->nhazard != 0)
 		__wt_errx(session,
@@ -246,7 +251,7 @@ __hazard_dump(WT_SESSION_IMPL *session)
 	WT_HAZARD *hp;
 
 	for (hp = session->hazard;
-	    hp < session->hazard + session->hazard_size; ++hp)
+	    hp < session->hazard + session->hazard_inuse; ++hp)
 		if (hp->page != NULL)
 			__wt_errx(session,
 			    "session %p: hazard pointer %p: %s, line %d",
@@ -44,12 +44,15 @@ __wt_stat_init_dsrc_stats(WT_DSRC_STATS *stats)
 	    "btree: pages rewritten by compaction";
 	stats->btree_row_internal.desc = "btree: row-store internal pages";
 	stats->btree_row_leaf.desc = "btree: row-store leaf pages";
+	stats->cache_bytes_inuse.desc = "cache: bytes currently in the cache";
 	stats->cache_bytes_read.desc = "cache: bytes read into cache";
 	stats->cache_bytes_write.desc = "cache: bytes written from cache";
 	stats->cache_eviction_checkpoint.desc =
 	    "cache: checkpoint blocked page eviction";
 	stats->cache_eviction_fail.desc =
 	    "cache: data source pages selected for eviction unable to be evicted";
+	stats->cache_eviction_walk_passes.desc =
+	    "cache: eviction walk passes of a file";
 	stats->cache_eviction_hazard.desc =
 	    "cache: hazard pointer blocked page eviction";
 	stats->cache_inmem_split.desc = "cache: in-memory page splits";
@@ -61,9 +64,14 @@ __wt_stat_init_dsrc_stats(WT_DSRC_STATS *stats)
 	    "cache: overflow values cached in memory";
 	stats->cache_eviction_deepen.desc =
 	    "cache: page split during eviction deepened the tree";
+	stats->cache_eviction_walk_queued.desc =
+	    "cache: pages queued for eviction by walks";
 	stats->cache_read.desc = "cache: pages read into cache";
 	stats->cache_eviction_split.desc =
 	    "cache: pages split during eviction";
+	stats->cache_eviction_walk.desc = "cache: pages walked for eviction";
+	stats->cache_writeback.desc =
+	    "cache: pages written by write-back threads";
 	stats->cache_write.desc = "cache: pages written from cache";
 	stats->cache_eviction_clean.desc = "cache: unmodified pages evicted";
 	stats->compress_read.desc = "compression: compressed pages read";
@@ -175,6 +183,7 @@ __wt_stat_refresh_dsrc_stats(void *stats_arg)
 	stats->cache_bytes_write.v = 0;
 	stats->cache_eviction_checkpoint.v = 0;
 	stats->cache_eviction_fail.v = 0;
+	stats->cache_eviction_walk_passes.v = 0;
 	stats->cache_eviction_hazard.v = 0;
 	stats->cache_inmem_split.v = 0;
 	stats->cache_eviction_internal.v = 0;
@@ -182,8 +191,11 @@ __wt_stat_refresh_dsrc_stats(void *stats_arg)
 	stats->cache_read_overflow.v = 0;
 	stats->cache_overflow_value.v = 0;
 	stats->cache_eviction_deepen.v = 0;
+	stats->cache_eviction_walk_queued.v = 0;
 	stats->cache_read.v = 0;
 	stats->cache_eviction_split.v = 0;
+	stats->cache_eviction_walk.v = 0;
+	stats->cache_writeback.v = 0;
 	stats->cache_write.v = 0;
 	stats->cache_eviction_clean.v = 0;
 	stats->compress_read.v = 0;
@@ -260,10 +272,12 @@ __wt_stat_aggregate_dsrc_stats(const void *child, const void *parent)
 	p->btree_compact_rewrite.v += c->btree_compact_rewrite.v;
 	p->btree_row_internal.v += c->btree_row_internal.v;
 	p->btree_row_leaf.v += c->btree_row_leaf.v;
+	p->cache_bytes_inuse.v += c->cache_bytes_inuse.v;
 	p->cache_bytes_read.v += c->cache_bytes_read.v;
 	p->cache_bytes_write.v += c->cache_bytes_write.v;
 	p->cache_eviction_checkpoint.v += c->cache_eviction_checkpoint.v;
 	p->cache_eviction_fail.v += c->cache_eviction_fail.v;
+	p->cache_eviction_walk_passes.v += c->cache_eviction_walk_passes.v;
 	p->cache_eviction_hazard.v += c->cache_eviction_hazard.v;
 	p->cache_inmem_split.v += c->cache_inmem_split.v;
 	p->cache_eviction_internal.v += c->cache_eviction_internal.v;
@@ -271,8 +285,11 @@ __wt_stat_aggregate_dsrc_stats(const void *child, const void *parent)
 	p->cache_read_overflow.v += c->cache_read_overflow.v;
 	p->cache_overflow_value.v += c->cache_overflow_value.v;
 	p->cache_eviction_deepen.v += c->cache_eviction_deepen.v;
+	p->cache_eviction_walk_queued.v += c->cache_eviction_walk_queued.v;
 	p->cache_read.v += c->cache_read.v;
 	p->cache_eviction_split.v += c->cache_eviction_split.v;
+	p->cache_eviction_walk.v += c->cache_eviction_walk.v;
+	p->cache_writeback.v += c->cache_writeback.v;
 	p->cache_write.v += c->cache_write.v;
 	p->cache_eviction_clean.v += c->cache_eviction_clean.v;
 	p->compress_read.v += c->compress_read.v;
@@ -349,6 +366,14 @@ __wt_stat_init_connection_stats(WT_CONNECTION_STATS *stats)
 	stats->async_op_remove.desc = "async: total remove calls";
 	stats->async_op_search.desc = "async: total search calls";
 	stats->async_op_update.desc = "async: total update calls";
+	stats->block_cache_evict.desc =
+	    "block-manager: block cache blocks evicted";
+	stats->block_cache_insert.desc =
+	    "block-manager: block cache blocks inserted";
+	stats->block_cache_bytes.desc =
+	    "block-manager: block cache bytes currently in use";
+	stats->block_cache_hit.desc = "block-manager: block cache hits";
+	stats->block_cache_miss.desc = "block-manager: block cache misses";
 	stats->block_preload.desc = "block-manager: blocks pre-loaded";
 	stats->block_read.desc = "block-manager: blocks read";
 	stats->block_write.desc = "block-manager: blocks written";
@@ -356,11 +381,29 @@ __wt_stat_init_connection_stats(WT_CONNECTION_STATS *stats)
 	stats->block_byte_write.desc = "block-manager: bytes written";
 	stats->block_map_read.desc = "block-manager: mapped blocks read";
 	stats->block_byte_map_read.desc = "block-manager: mapped bytes read";
+	stats->cache_eviction_app_budget.desc =
+	    "cache: application eviction stopped by the eviction budget";
+	stats->cache_write_throttle_time.desc =
+	    "cache: application write throttle time (usecs)";
+	stats->cache_write_throttle.desc =
+	    "cache: application writes throttled";
 	stats->cache_bytes_inuse.desc = "cache: bytes currently in the cache";
+	stats->cache_bytes_numa_max.desc =
+	    "cache: bytes currently in the cache on the most used NUMA node";
 	stats->cache_bytes_read.desc = "cache: bytes read into cache";
 	stats->cache_bytes_write.desc = "cache: bytes written from cache";
 	stats->cache_eviction_checkpoint.desc =
 	    "cache: checkpoint blocked page eviction";
+	stats->cache_eviction_queue_busy.desc =
+	    "cache: eviction candidate queue busy";
+	stats->cache_eviction_queue_stall.desc =
+	    "cache: eviction candidate queues empty when evicting";
+	stats->cache_eviction_numa_remote.desc =
+	    "cache: eviction candidates taken from another NUMA node";
+	stats->cache_eviction_queue_other.desc =
+	    "cache: eviction candidates taken from another queue";
+	stats->cache_eviction_quota.desc =
+	    "cache: eviction passes for objects over their resident maximum";
 	stats->cache_eviction_queue_empty.desc =
 	    "cache: eviction server candidate queue empty when topping up";
 	stats->cache_eviction_queue_not_empty.desc =
@@ -373,16 +416,26 @@ __wt_stat_init_connection_stats(WT_CONNECTION_STATS *stats)
 	    "cache: eviction server unable to reach eviction goal";
 	stats->cache_eviction_worker_evicting.desc =
 	    "cache: eviction worker thread evicting pages";
+	stats->cache_eviction_worker_walk.desc =
+	    "cache: eviction worker thread walking files";
 	stats->cache_eviction_force_fail.desc =
 	    "cache: failed eviction of pages that exceeded the in-memory maximum";
+	stats->cache_eviction_walk_score_skip.desc =
+	    "cache: files skipped by eviction walks, low eviction score";
 	stats->cache_eviction_hazard.desc =
 	    "cache: hazard pointer blocked page eviction";
 	stats->cache_inmem_split.desc = "cache: in-memory page splits";
 	stats->cache_eviction_internal.desc = "cache: internal pages evicted";
+	stats->cache_lookaside_insert.desc =
+	    "cache: lookaside table insert calls";
+	stats->cache_lookaside_remove.desc =
+	    "cache: lookaside table remove calls";
 	stats->cache_bytes_max.desc = "cache: maximum bytes configured";
 	stats->cache_eviction_maximum_page_size.desc =
 	    "cache: maximum page size at eviction";
 	stats->cache_eviction_dirty.desc = "cache: modified pages evicted";
+	stats->cache_obsolete_updates.desc =
+	    "cache: obsolete updates discarded in the background";
 	stats->cache_eviction_deepen.desc =
 	    "cache: page split during eviction deepened the tree";
 	stats->cache_pages_inuse.desc =
@@ -393,14 +446,34 @@ __wt_stat_init_connection_stats(WT_CONNECTION_STATS *stats)
 	    "cache: pages evicted because they had chains of deleted items";
 	stats->cache_eviction_app.desc =
 	    "cache: pages evicted by application threads";
+	stats->cache_eviction_lookaside.desc =
+	    "cache: pages evicted using the lookaside table";
+	stats->cache_eviction_second_chance.desc =
+	    "cache: pages given a second chance by eviction";
+	stats->cache_warmup_saved.desc =
+	    "cache: pages listed for cache warm-up";
 	stats->cache_read.desc = "cache: pages read into cache";
+	stats->cache_read_once.desc =
+	    "cache: pages read into cache by read-once cursors";
+	stats->cache_warmup_read.desc =
+	    "cache: pages read into cache by warm-up";
+	stats->cache_read_lookaside.desc =
+	    "cache: pages read into cache requiring lookaside entries";
 	stats->cache_eviction_fail.desc =
 	    "cache: pages selected for eviction unable to be evicted";
+	stats->cache_eviction_numa_skip.desc =
+	    "cache: pages skipped by eviction, NUMA node within its share";
 	stats->cache_eviction_split.desc =
 	    "cache: pages split during eviction";
 	stats->cache_eviction_walk.desc = "cache: pages walked for eviction";
+	stats->cache_obsolete_pages.desc =
+	    "cache: pages with obsolete updates discarded in the background";
+	stats->cache_writeback.desc =
+	    "cache: pages written by write-back threads";
 	stats->cache_write.desc = "cache: pages written from cache";
 	stats->cache_overhead.desc = "cache: percentage overhead";
+	stats->cache_pool_pressure.desc =
+	    "cache: shared cache pressure (per mille)";
 	stats->cache_bytes_internal.desc =
 	    "cache: tracked bytes belonging to internal pages in the cache";
 	stats->cache_bytes_leaf.desc =
@@ -433,6 +506,10 @@ __wt_stat_init_connection_stats(WT_CONNECTION_STATS *stats)
 	stats->cursor_search.desc = "cursor: cursor search calls";
 	stats->cursor_search_near.desc = "cursor: cursor search near calls";
 	stats->cursor_update.desc = "cursor: cursor update calls";
+	stats->cursor_write_batch.desc = "cursor: write batch calls";
+	stats->cursor_write_batch_ops.desc = "cursor: write batch operations";
+	stats->cursor_write_batch_leaf.desc =
+	    "cursor: write batch operations applied without a tree search";
 	stats->dh_conn_ref.desc =
 	    "data-handle: connection candidate referenced";
 	stats->dh_conn_handles.desc = "data-handle: connection dhandles swept";
@@ -441,14 +518,19 @@ __wt_stat_init_connection_stats(WT_CONNECTION_STATS *stats)
 	stats->dh_session_handles.desc = "data-handle: session dhandles swept";
 	stats->dh_session_sweeps.desc = "data-handle: session sweep attempts";
 	stats->log_slot_closes.desc = "log: consolidated slot closures";
-	stats->log_slot_races.desc = "log: consolidated slot join races";
-	stats->log_slot_transitions.desc =
-	    "log: consolidated slot join transitions";
+	stats->log_slot_join_retries.desc =
+	    "log: consolidated slot join retries";
 	stats->log_slot_joins.desc = "log: consolidated slot joins";
+	stats->log_slot_allocate_waits.desc =
+	    "log: consolidated slot joins waiting for log space allocation";
+	stats->log_slot_switch_waits.desc =
+	    "log: consolidated slot switches waiting for a free slot";
 	stats->log_slot_toosmall.desc =
 	    "log: failed to find a slot large enough for record";
 	stats->log_buffer_grow.desc = "log: log buffer size increases";
 	stats->log_bytes_payload.desc = "log: log bytes of payload data";
+	stats->log_compact_saved.desc =
+	    "log: log bytes saved by compact operation format";
 	stats->log_bytes_written.desc = "log: log bytes written";
 	stats->log_reads.desc = "log: log read operations";
 	stats->log_compress_writes.desc = "log: log records compressed";
@@ -458,14 +540,18 @@ __wt_stat_init_connection_stats(WT_CONNECTION_STATS *stats)
 	    "log: log records too small to compress";
 	stats->log_release_write_lsn.desc =
 	    "log: log release advances write LSN";
+	stats->log_release_waits.desc =
+	    "log: log release waits for earlier writes";
 	stats->log_scans.desc = "log: log scan operations";
 	stats->log_scan_rereads.desc =
 	    "log: log scan records requiring two reads";
 	stats->log_write_lsn.desc =
 	    "log: log server thread advances write LSN";
 	stats->log_sync.desc = "log: log sync operations";
+	stats->log_sync_requests.desc = "log: log sync requests";
 	stats->log_sync_dir.desc = "log: log sync_dir operations";
 	stats->log_writes.desc = "log: log write operations";
+	stats->log_writer_writes.desc = "log: log writer thread writes";
 	stats->log_slot_consolidated.desc = "log: logging bytes consolidated";
 	stats->log_max_filesize.desc = "log: maximum log file size";
 	stats->log_prealloc_max.desc =
@@ -473,10 +559,7 @@ __wt_stat_init_connection_stats(WT_CONNECTION_STATS *stats)
 	stats->log_prealloc_files.desc =
 	    "log: pre-allocated log files prepared";
 	stats->log_prealloc_used.desc = "log: pre-allocated log files used";
-	stats->log_slot_toobig.desc = "log: record size exceeded maximum";
 	stats->log_scan_records.desc = "log: records processed by log scan";
-	stats->log_slot_switch_fails.desc =
-	    "log: slots selected for switching that were unavailable";
 	stats->log_compress_mem.desc =
 	    "log: total in-memory size of compressed records";
 	stats->log_buffer_size.desc = "log: total log buffer size";
@@ -519,6 +602,17 @@ __wt_stat_init_connection_stats(WT_CONNECTION_STATS *stats)
 	    "thread-yield: page acquire read blocked";
 	stats->page_sleep.desc =
 	    "thread-yield: page acquire time sleeping (usecs)";
+	stats->txn_conflict_wound.desc =
+	    "transaction: conflicting transactions asked to roll back";
+	stats->txn_prepare_commit.desc =
+	    "transaction: prepared transactions committed";
+	stats->txn_prepare_recover.desc =
+	    "transaction: prepared transactions recovered";
+	stats->txn_prepare_rollback.desc =
+	    "transaction: prepared transactions rolled back";
+	stats->txn_readonly_update.desc =
+	    "transaction: read-only transaction update attempts";
+	stats->txn_readonly.desc = "transaction: read-only transactions";
 	stats->txn_begin.desc = "transaction: transaction begins";
 	stats->txn_checkpoint_running.desc =
 	    "transaction: transaction checkpoint currently running";
@@ -535,12 +629,27 @@ __wt_stat_init_connection_stats(WT_CONNECTION_STATS *stats)
 	stats->txn_checkpoint.desc = "transaction: transaction checkpoints";
 	stats->txn_fail_cache.desc =
 	    "transaction: transaction failures due to cache overflow";
+	stats->txn_id_batch.desc =
+	    "transaction: transaction ID batches allocated for racing threads";
 	stats->txn_pinned_range.desc =
 	    "transaction: transaction range of IDs currently pinned";
 	stats->txn_pinned_checkpoint_range.desc =
 	    "transaction: transaction range of IDs currently pinned by a checkpoint";
 	stats->txn_commit.desc = "transaction: transactions committed";
+	stats->txn_prepare.desc = "transaction: transactions prepared";
 	stats->txn_rollback.desc = "transaction: transactions rolled back";
+	stats->txn_read_chain_entries.desc =
+	    "transaction: update chain entries read";
+	stats->txn_read_chain.desc = "transaction: update chains read";
+	stats->txn_conflict_wait_time.desc =
+	    "transaction: update conflict wait time (usecs)";
+	stats->txn_conflict_wait_abort.desc =
+	    "transaction: update conflict waits ended by the conflicting transaction rolling back";
+	stats->txn_conflict_wait_timeout.desc =
+	    "transaction: update conflict waits timed out";
+	stats->txn_update_conflict.desc = "transaction: update conflicts";
+	stats->txn_conflict_wait.desc =
+	    "transaction: update conflicts waited for";
 }
 
 void
@@ -562,6 +671,10 @@ __wt_stat_refresh_connection_stats(void *stats_arg)
 	stats->async_op_remove.v = 0;
 	stats->async_op_search.v = 0;
 	stats->async_op_update.v = 0;
+	stats->block_cache_evict.v = 0;
+	stats->block_cache_insert.v = 0;
+	stats->block_cache_hit.v = 0;
+	stats->block_cache_miss.v = 0;
 	stats->block_preload.v = 0;
 	stats->block_read.v = 0;
 	stats->block_write.v = 0;
@@ -569,29 +682,51 @@ __wt_stat_refresh_connection_stats(void *stats_arg)
 	stats->block_byte_write.v = 0;
 	stats->block_map_read.v = 0;
 	stats->block_byte_map_read.v = 0;
+	stats->cache_eviction_app_budget.v = 0;
+	stats->cache_write_throttle_time.v = 0;
+	stats->cache_write_throttle.v = 0;
 	stats->cache_bytes_read.v = 0;
 	stats->cache_bytes_write.v = 0;
 	stats->cache_eviction_checkpoint.v = 0;
+	stats->cache_eviction_queue_busy.v = 0;
+	stats->cache_eviction_queue_stall.v = 0;
+	stats->cache_eviction_numa_remote.v = 0;
+	stats->cache_eviction_queue_other.v = 0;
+	stats->cache_eviction_quota.v = 0;
 	stats->cache_eviction_queue_empty.v = 0;
 	stats->cache_eviction_queue_not_empty.v = 0;
 	stats->cache_eviction_server_evicting.v = 0;
 	stats->cache_eviction_server_not_evicting.v = 0;
 	stats->cache_eviction_slow.v = 0;
 	stats->cache_eviction_worker_evicting.v = 0;
+	stats->cache_eviction_worker_walk.v = 0;
 	stats->cache_eviction_force_fail.v = 0;
+	stats->cache_eviction_walk_score_skip.v = 0;
 	stats->cache_eviction_hazard.v = 0;
 	stats->cache_inmem_split.v = 0;
 	stats->cache_eviction_internal.v = 0;
+	stats->cache_lookaside_insert.v = 0;
+	stats->cache_lookaside_remove.v = 0;
 	stats->cache_eviction_maximum_page_size.v = 0;
 	stats->cache_eviction_dirty.v = 0;
+	stats->cache_obsolete_updates.v = 0;
 	stats->cache_eviction_deepen.v = 0;
 	stats->cache_eviction_force.v = 0;
 	stats->cache_eviction_force_delete.v = 0;
 	stats->cache_eviction_app.v = 0;
+	stats->cache_eviction_lookaside.v = 0;
+	stats->cache_eviction_second_chance.v = 0;
+	stats->cache_warmup_saved.v = 0;
 	stats->cache_read.v = 0;
+	stats->cache_read_once.v = 0;
+	stats->cache_warmup_read.v = 0;
+	stats->cache_read_lookaside.v = 0;
 	stats->cache_eviction_fail.v = 0;
+	stats->cache_eviction_numa_skip.v = 0;
 	stats->cache_eviction_split.v = 0;
 	stats->cache_eviction_walk.v = 0;
+	stats->cache_obsolete_pages.v = 0;
+	stats->cache_writeback.v = 0;
 	stats->cache_write.v = 0;
 	stats->cache_eviction_clean.v = 0;
 	stats->memory_allocation.v = 0;
@@ -611,6 +746,9 @@ __wt_stat_refresh_connection_stats(void *stats_arg)
 	stats->cursor_search.v = 0;
 	stats->cursor_search_near.v = 0;
 	stats->cursor_update.v = 0;
+	stats->cursor_write_batch.v = 0;
+	stats->cursor_write_batch_ops.v = 0;
+	stats->cursor_write_batch_leaf.v = 0;
 	stats->dh_conn_ref.v = 0;
 	stats->dh_conn_handles.v = 0;
 	stats->dh_conn_sweeps.v = 0;
@@ -618,30 +756,33 @@ __wt_stat_refresh_connection_stats(void *stats_arg)
 	stats->dh_session_handles.v = 0;
 	stats->dh_session_sweeps.v = 0;
 	stats->log_slot_closes.v = 0;
-	stats->log_slot_races.v = 0;
-	stats->log_slot_transitions.v = 0;
+	stats->log_slot_join_retries.v = 0;
 	stats->log_slot_joins.v = 0;
+	stats->log_slot_allocate_waits.v = 0;
+	stats->log_slot_switch_waits.v = 0;
 	stats->log_slot_toosmall.v = 0;
 	stats->log_buffer_grow.v = 0;
 	stats->log_bytes_payload.v = 0;
+	stats->log_compact_saved.v = 0;
 	stats->log_bytes_written.v = 0;
 	stats->log_reads.v = 0;
 	stats->log_compress_writes.v = 0;
 	stats->log_compress_write_fails.v = 0;
 	stats->log_compress_small.v = 0;
 	stats->log_release_write_lsn.v = 0;
+	stats->log_release_waits.v = 0;
 	stats->log_scans.v = 0;
 	stats->log_scan_rereads.v = 0;
 	stats->log_write_lsn.v = 0;
 	stats->log_sync.v = 0;
+	stats->log_sync_requests.v = 0;
 	stats->log_sync_dir.v = 0;
 	stats->log_writes.v = 0;
+	stats->log_writer_writes.v = 0;
 	stats->log_slot_consolidated.v = 0;
 	stats->log_prealloc_files.v = 0;
 	stats->log_prealloc_used.v = 0;
-	stats->log_slot_toobig.v = 0;
 	stats->log_scan_records.v = 0;
-	stats->log_slot_switch_fails.v = 0;
 	stats->log_compress_mem.v = 0;
 	stats->log_compress_len.v = 0;
 	stats->log_close_yields.v = 0;
@@ -659,9 +800,24 @@ __wt_stat_refresh_connection_stats(void *stats_arg)
 	stats->page_locked_blocked.v = 0;
 	stats->page_read_blocked.v = 0;
 	stats->page_sleep.v = 0;
+	stats->txn_conflict_wound.v = 0;
+	stats->txn_prepare_commit.v = 0;
+	stats->txn_prepare_recover.v = 0;
+	stats->txn_prepare_rollback.v = 0;
+	stats->txn_readonly_update.v = 0;
+	stats->txn_readonly.v = 0;
 	stats->txn_begin.v = 0;
 	stats->txn_checkpoint.v = 0;
 	stats->txn_fail_cache.v = 0;
+	stats->txn_id_batch.v = 0;
 	stats->txn_commit.v = 0;
+	stats->txn_prepare.v = 0;
 	stats->txn_rollback.v = 0;
+	stats->txn_read_chain_entries.v = 0;
+	stats->txn_read_chain.v = 0;
+	stats->txn_conflict_wait_time.v = 0;
+	stats->txn_conflict_wait_abort.v = 0;
+	stats->txn_conflict_wait_timeout.v = 0;
+	stats->txn_update_conflict.v = 0;
+	stats->txn_conflict_wait.v = 0;
 }
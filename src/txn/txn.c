@@ -62,6 +62,7 @@ __wt_txn_release_snapshot(WT_SESSION_IMPL *session)
 		    session->txn.isolation == TXN_ISO_READ_UNCOMMITTED ||
 		    !__wt_txn_visible_all(session, txn_state->snap_min));
 		txn_state->snap_min = WT_TXN_NONE;
+		__wt_txn_state_idle(session);
 	}
 	F_CLR(txn, TXN_HAS_SNAPSHOT);
 }
@@ -85,6 +86,145 @@ __wt_txn_update_oldest(WT_SESSION_IMPL *session)
 	 * past the last committed transaction.
 	 */
 	__wt_txn_refresh(session, 0);
+
+	__wt_txn_update_pinned_timestamp(session);
+}
+
+/*
+ * __wt_txn_update_pinned_timestamp --
+ *	Update the timestamp before which updates are visible to all readers.
+ */
+void
+__wt_txn_update_pinned_timestamp(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_TXN_GLOBAL *txn_global;
+	uint64_t pinned, ts;
+	uint32_t i, session_cnt;
+
+	conn = S2C(session);
+	txn_global = &conn->txn_global;
+
+	/*
+	 * Read the oldest timestamp before looking for running readers: a
+	 * reader publishes its timestamp before checking it against the
+	 * oldest timestamp, so either it sees a newer oldest timestamp and
+	 * fails, or we see the reader.
+	 */
+	pinned = txn_global->oldest_timestamp;
+	WT_FULL_BARRIER();
+
+	WT_ORDERED_READ(session_cnt, conn->session_cnt);
+	for (i = __wt_txn_state_next(txn_global, 0, session_cnt);
+	    i < session_cnt;
+	    i = __wt_txn_state_next(txn_global, i + 1, session_cnt))
+		if ((ts = txn_global->states[i].read_timestamp) != 0 &&
+		    ts < pinned)
+			pinned = ts;
+
+	txn_global->pinned_timestamp = pinned;
+}
+
+/*
+ * __wt_txn_global_set_timestamp --
+ *	Set the connection's oldest timestamp.
+ */
+int
+__wt_txn_global_set_timestamp(WT_SESSION_IMPL *session, const char *cfg[])
+{
+	WT_CONFIG_ITEM cval;
+	WT_TXN_GLOBAL *txn_global;
+
+	txn_global = &S2C(session)->txn_global;
+
+	WT_RET(
+	    __wt_config_gets_def(session, cfg, "oldest_timestamp", 0, &cval));
+	if (cval.val == 0)
+		return (0);
+	if ((uint64_t)cval.val < txn_global->oldest_timestamp)
+		WT_RET_MSG(session, EINVAL,
+		    "oldest timestamp %" PRId64 " older than the current "
+		    "oldest timestamp %" PRIu64,
+		    cval.val, txn_global->oldest_timestamp);
+
+	/*
+	 * Publish the new oldest timestamp before looking for readers, see
+	 * __wt_txn_update_pinned_timestamp.
+	 */
+	txn_global->oldest_timestamp = (uint64_t)cval.val;
+	WT_FULL_BARRIER();
+	__wt_txn_update_pinned_timestamp(session);
+	return (0);
+}
+
+/*
+ * __txn_refresh_readonly --
+ *	Take a snapshot for a read-only transaction.  Read-only transactions
+ *	don't join the scans that move the oldest ID forward: instead, the
+ *	oldest ID is published as the snap_min before looking for running
+ *	transactions.
+ */
+static void
+__txn_refresh_readonly(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_TXN *txn;
+	WT_TXN_GLOBAL *txn_global;
+	WT_TXN_STATE *s, *txn_state;
+	uint64_t current_id, id, oldest_id, snap_min;
+	uint32_t i, n, session_cnt;
+
+	conn = S2C(session);
+	txn = &session->txn;
+	txn_global = &conn->txn_global;
+	txn_state = &txn_global->states[session->id];
+
+	/*
+	 * A thread moving the oldest ID forward sets the scan count negative,
+	 * then checks every published snap_min.  Once our snap_min is
+	 * published, if no thread is moving the oldest ID and it hasn't moved
+	 * past our snap_min, it can't do so until we're done.
+	 */
+	for (;;) {
+		oldest_id = txn_global->oldest_id;
+		txn_state->snap_min = oldest_id;
+		WT_FULL_BARRIER();
+		if (txn_global->scan_count >= 0 &&
+		    oldest_id == txn_global->oldest_id)
+			break;
+		WT_PAUSE();
+	}
+
+	/*
+	 * If no transaction is running, the snapshot is empty.  Otherwise,
+	 * build our snapshot of any concurrent transaction IDs, ignoring the
+	 * checkpoint transaction and IDs older than the oldest ID, as for
+	 * other snapshots.
+	 */
+	current_id = snap_min = txn_global->current;
+	if (current_id == oldest_id) {
+		__txn_sort_snapshot(session, 0, current_id);
+		return;
+	}
+	WT_ORDERED_READ(session_cnt, conn->session_cnt);
+	for (n = 0, i = __wt_txn_state_next(txn_global, 0, session_cnt);
+	    i < session_cnt;
+	    i = __wt_txn_state_next(txn_global, i + 1, session_cnt)) {
+		s = &txn_global->states[i];
+		if (txn_global->checkpoint_id != WT_TXN_NONE &&
+		    s->id == txn_global->checkpoint_id)
+			continue;
+		if (s != txn_state &&
+		    (id = s->id) != WT_TXN_NONE && TXNID_LE(oldest_id, id)) {
+			txn->snapshot[n++] = id;
+			if (TXNID_LT(id, snap_min))
+				snap_min = id;
+		}
+	}
+
+	/* Moving our snap_min forward is always safe. */
+	txn_state->snap_min = snap_min;
+	__txn_sort_snapshot(session, n, current_id);
 }
 
 /*
@@ -108,6 +248,15 @@ __wt_txn_refresh(WT_SESSION_IMPL *session, int get_snapshot)
 	txn_global = &conn->txn_global;
 	txn_state = &txn_global->states[session->id];
 
+	/* We may publish a snap_min: mark our state in use first. */
+	if (get_snapshot)
+		__wt_txn_state_active(session);
+
+	if (get_snapshot && F_ISSET(txn, TXN_READONLY)) {
+		__txn_refresh_readonly(session);
+		return;
+	}
+
 	current_id = snap_min = txn_global->current;
 	prev_oldest_id = txn_global->oldest_id;
 
@@ -139,9 +288,16 @@ __wt_txn_refresh(WT_SESSION_IMPL *session, int get_snapshot)
 	current_id = oldest_id = snap_min = txn_global->current;
 	oldest_session = 0;
 
-	/* Walk the array of concurrent transactions. */
+	/*
+	 * Walk the array of concurrent transactions, skipping sessions with
+	 * nothing published in their state.
+	 */
 	WT_ORDERED_READ(session_cnt, conn->session_cnt);
-	for (i = n = 0, s = txn_global->states; i < session_cnt; i++, s++) {
+	for (n = 0, i = __wt_txn_state_next(txn_global, 0, session_cnt);
+	    i < session_cnt;
+	    i = __wt_txn_state_next(txn_global, i + 1, session_cnt)) {
+		s = &txn_global->states[i];
+
 		/* Skip the checkpoint transaction; it is never read from. */
 		if (txn_global->checkpoint_id != WT_TXN_NONE &&
 		    s->id == txn_global->checkpoint_id)
@@ -220,7 +376,11 @@ __wt_txn_refresh(WT_SESSION_IMPL *session, int get_snapshot)
 	    (!get_snapshot || oldest_id - prev_oldest_id > 100) &&
 	    WT_ATOMIC_CAS4(txn_global->scan_count, 1, -1)) {
 		WT_ORDERED_READ(session_cnt, conn->session_cnt);
-		for (i = 0, s = txn_global->states; i < session_cnt; i++, s++) {
+		for (i = __wt_txn_state_next(txn_global, 0, session_cnt);
+		    i < session_cnt;
+		    i = __wt_txn_state_next(txn_global, i + 1, session_cnt)) {
+			s = &txn_global->states[i];
+
 			/*
 			 * Skip the checkpoint transaction; it is never read
 			 * from.
@@ -260,6 +420,118 @@ __wt_txn_refresh(WT_SESSION_IMPL *session, int get_snapshot)
 		__txn_sort_snapshot(session, n, current_id);
 }
 
+/*
+ * __wt_txn_id_batch --
+ *	Allocate a transaction ID when other threads are allocating at the same
+ *	time: wait for a thread to allocate IDs for a batch of waiting threads,
+ *	or become that thread.
+ */
+uint64_t
+__wt_txn_id_batch(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_TXN_GLOBAL *txn_global;
+	WT_TXN_STATE *txn_state;
+	uint64_t current_id, id;
+	uint32_t i, n, session_cnt, slot[WT_TXN_ID_BATCH_MAX];
+	u_int spins;
+
+	conn = S2C(session);
+	txn_global = &conn->txn_global;
+	txn_state = &txn_global->states[session->id];
+
+	/*
+	 * Publish that we are waiting: scans of the running transactions can
+	 * see the placeholder, it is newer than any ID that will be allocated.
+	 */
+	WT_PUBLISH(txn_state->id, WT_TXN_PENDING);
+
+	for (spins = 0;; ++spins) {
+		if (txn_global->id_batch_lock == 0) {
+			/*
+			 * If the last batch included us, we're done, otherwise
+			 * try to allocate the next batch ourselves.
+			 */
+			WT_READ_BARRIER();
+			if ((id = txn_state->id) != WT_TXN_PENDING)
+				return (id);
+			if (WT_ATOMIC_CAS4(txn_global->id_batch_lock, 0, 1))
+				break;
+		}
+		if (spins < 1000)
+			WT_PAUSE();
+		else
+			__wt_yield();
+	}
+
+	/*
+	 * Gather the sessions waiting for an ID, our own first (unless a batch
+	 * included us after we checked).
+	 */
+	n = 0;
+	if (txn_state->id == WT_TXN_PENDING)
+		slot[n++] = session->id;
+	WT_ORDERED_READ(session_cnt, conn->session_cnt);
+	for (i = __wt_txn_state_next(txn_global, 0, session_cnt);
+	    i < session_cnt && n < WT_TXN_ID_BATCH_MAX;
+	    i = __wt_txn_state_next(txn_global, i + 1, session_cnt))
+		if (i != session->id &&
+		    txn_global->states[i].id == WT_TXN_PENDING)
+			slot[n++] = i;
+
+	/*
+	 * Publish the batch's IDs before moving the global counter past them,
+	 * the same as a single allocation.  Threads allocating IDs without
+	 * joining a batch can still move the counter, in which case try again.
+	 */
+	if (n > 0)
+		do {
+			current_id = txn_global->current;
+			for (i = 0; i < n; ++i)
+				txn_global->states[slot[i]].id = current_id + i;
+		} while (!WT_ATOMIC_CAS8(
+		    txn_global->current, current_id, current_id + n));
+
+	WT_STAT_FAST_CONN_INCR(session, txn_id_batch);
+	WT_PUBLISH(txn_global->id_batch_lock, 0);
+
+	return (txn_state->id);
+}
+
+/*
+ * __txn_read_timestamp --
+ *	Publish the transaction's read timestamp.
+ */
+static int
+__txn_read_timestamp(WT_SESSION_IMPL *session, uint64_t read_ts)
+{
+	WT_TXN_GLOBAL *txn_global;
+	WT_TXN_STATE *txn_state;
+	uint64_t oldest_ts;
+
+	txn_global = &S2C(session)->txn_global;
+	txn_state = &txn_global->states[session->id];
+
+	/*
+	 * Updates committed after the oldest timestamp may have been discarded
+	 * already.  Publish the timestamp before checking it, so the oldest
+	 * timestamp can't move past it once we have checked.
+	 */
+	__wt_txn_state_active(session);
+	txn_state->read_timestamp = read_ts;
+	WT_FULL_BARRIER();
+	if (read_ts < (oldest_ts = txn_global->oldest_timestamp)) {
+		txn_state->read_timestamp = 0;
+		__wt_txn_state_idle(session);
+		WT_RET_MSG(session, EINVAL,
+		    "read timestamp %" PRIu64 " older than the oldest "
+		    "timestamp %" PRIu64, read_ts, oldest_ts);
+	}
+
+	session->txn.read_timestamp = read_ts;
+	return (0);
+}
+
 /*
  * __wt_txn_begin --
  *	Begin a transaction.
@@ -269,6 +541,7 @@ __wt_txn_begin(WT_SESSION_IMPL *session, const char *cfg[])
 {
 	WT_CONFIG_ITEM cval;
 	WT_TXN *txn;
+	int readonly;
 
 	txn = &session->txn;
 
@@ -297,7 +570,29 @@ __wt_txn_begin(WT_SESSION_IMPL *session, const char *cfg[])
 	if (!cval.val)
 		txn->txn_logsync = 0;
 
+	WT_RET(__wt_config_gets_def(session, cfg, "read_only", 0, &cval));
+	readonly = cval.val != 0;
+
+	WT_RET(__wt_config_gets_def(session, cfg, "priority", 0, &cval));
+	txn->priority = (int32_t)cval.val;
+	WT_RET(
+	    __wt_config_gets_def(session, cfg, "conflict_timeout", 0, &cval));
+	txn->conflict_timeout = (uint64_t)cval.val * 1000;
+
+	WT_RET(__wt_config_gets_def(session, cfg, "read_timestamp", 0, &cval));
+	if (cval.val != 0) {
+		if (txn->isolation != TXN_ISO_SNAPSHOT)
+			WT_RET_MSG(session, EINVAL,
+			    "reading at a timestamp requires snapshot "
+			    "isolation");
+		WT_RET(__txn_read_timestamp(session, (uint64_t)cval.val));
+	}
+
 	F_SET(txn, TXN_RUNNING);
+	if (readonly) {
+		F_SET(txn, TXN_READONLY);
+		WT_STAT_FAST_CONN_INCR(session, txn_readonly);
+	}
 	if (txn->isolation == TXN_ISO_SNAPSHOT) {
 		if (session->ncursors > 0)
 			WT_RET(__wt_session_copy_values(session));
@@ -306,6 +601,118 @@ __wt_txn_begin(WT_SESSION_IMPL *session, const char *cfg[])
 	return (0);
 }
 
+/*
+ * __wt_txn_reserve --
+ *	Make room for a number of updates in the running transaction, so a
+ *	batch of updates doesn't grow the transaction's list of modifications
+ *	and log record one update at a time.
+ */
+int
+__wt_txn_reserve(WT_SESSION_IMPL *session, u_int count, size_t logsize)
+{
+	WT_TXN *txn;
+
+	txn = &session->txn;
+
+	/* The log record is identified by the transaction's ID. */
+	WT_RET(__wt_txn_id_check(session));
+
+	WT_RET(__wt_realloc_def(session,
+	    &txn->mod_alloc, txn->mod_count + count, &txn->mod));
+	return (__wt_txn_log_reserve(session, logsize));
+}
+
+/*
+ * __wt_txn_conflict_wait --
+ *	Wait for the transaction that made an update the running transaction
+ *	conflicts with to resolve.  Returns 0 if the update was rolled back and
+ *	can be checked again, otherwise WT_ROLLBACK.
+ *
+ *	Conflicts are resolved with a wound-wait scheme: a transaction with a
+ *	higher priority, or the same priority and an older ID, asks the
+ *	transaction it conflicts with to roll back, then waits.  A wounded
+ *	transaction rolls back at its next update and stops waiting for other
+ *	transactions, so waits can't deadlock, and the wait is bounded by the
+ *	transaction's conflict timeout.
+ */
+int
+__wt_txn_conflict_wait(WT_SESSION_IMPL *session, WT_UPDATE *upd)
+{
+	struct timespec start, stop;
+	WT_CONDVAR *cond;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_TXN *txn;
+	WT_TXN_STATE *s, *txn_state;
+	uint64_t holder, waited;
+	uint32_t i, session_cnt;
+
+	conn = S2C(session);
+	txn = &session->txn;
+	txn_state = WT_SESSION_TXN_STATE(session);
+	waited = 0;
+
+	/* Our ID orders us against the transaction we conflict with. */
+	WT_RET(__wt_txn_id_check(session));
+	WT_RET(__wt_txn_wounded_check(session));
+
+	/*
+	 * Find the transaction that made the update: if it's no longer
+	 * running, it has resolved.
+	 */
+	holder = upd->txnid;
+	WT_ORDERED_READ(session_cnt, conn->session_cnt);
+	for (i = 0, s = conn->txn_global.states; i < session_cnt; i++, s++)
+		if (s->id == holder)
+			break;
+	if (i == session_cnt)
+		return (upd->txnid == WT_TXN_ABORTED ? 0 : WT_ROLLBACK);
+
+	if (txn->priority > s->priority ||
+	    (txn->priority == s->priority && TXNID_LT(txn->id, holder))) {
+		s->wounded = holder;
+		WT_STAT_FAST_CONN_INCR(session, txn_conflict_wound);
+	}
+
+	/* Allocate the transaction's condition variable on first use. */
+	if ((cond = s->conflict_cond) == NULL) {
+		WT_RET(__wt_cond_alloc(session, "txn conflict", 0, &cond));
+		if (!WT_ATOMIC_CAS8(s->conflict_cond, NULL, cond)) {
+			WT_RET(__wt_cond_destroy(session, &cond));
+			cond = s->conflict_cond;
+		}
+	}
+
+	/*
+	 * Register as a waiter before checking the transaction's ID: the
+	 * transaction clears its ID before checking for waiters, so one of us
+	 * sees the other.  Wake up periodically in case a signal is missed.
+	 */
+	WT_STAT_FAST_CONN_INCR(session, txn_conflict_wait);
+	(void)WT_ATOMIC_ADD4(s->waiters, 1);
+	WT_ERR(__wt_epoch(session, &start));
+	while (s->id == holder && txn_state->wounded != txn->id) {
+		if (waited >= txn->conflict_timeout) {
+			WT_STAT_FAST_CONN_INCR(
+			    session, txn_conflict_wait_timeout);
+			break;
+		}
+		WT_ERR(__wt_cond_wait(session, cond, WT_MIN(
+		    txn->conflict_timeout - waited, WT_TXN_CONFLICT_WAIT)));
+		WT_ERR(__wt_epoch(session, &stop));
+		waited = WT_TIMEDIFF(stop, start) / 1000;
+	}
+
+err:	(void)WT_ATOMIC_SUB4(s->waiters, 1);
+	WT_STAT_FAST_CONN_INCRV(session, txn_conflict_wait_time, waited);
+	WT_RET(ret);
+
+	if (upd->txnid != WT_TXN_ABORTED)
+		return (WT_ROLLBACK);
+	WT_STAT_FAST_CONN_INCR(session, txn_conflict_wait_abort);
+	return (0);
+}
+
 /*
  * __wt_txn_release --
  *	Release the resources associated with the current transaction.
@@ -330,6 +737,12 @@ __wt_txn_release(WT_SESSION_IMPL *session)
 		    txn->id != WT_TXN_NONE);
 		WT_PUBLISH(txn_state->id, WT_TXN_NONE);
 		txn->id = WT_TXN_NONE;
+
+		/* Wake any transactions waiting for us to resolve. */
+		WT_FULL_BARRIER();
+		if (txn_state->waiters != 0)
+			(void)__wt_cond_signal(
+			    session, txn_state->conflict_cond);
 	}
 
 	/* Free the scratch buffer allocated for logging. */
@@ -340,12 +753,71 @@ __wt_txn_release(WT_SESSION_IMPL *session)
 	if (session->split_stash_cnt > 0)
 		__wt_split_stash_discard(session);
 
+	/* Clear the read timestamp. */
+	if (txn->read_timestamp != 0) {
+		txn_state->read_timestamp = 0;
+		txn->read_timestamp = 0;
+	}
+
 	/*
 	 * Reset the transaction state to not running and release the snapshot.
 	 */
 	__wt_txn_release_snapshot(session);
 	txn->isolation = session->isolation;
-	F_CLR(txn, TXN_ERROR | TXN_HAS_ID | TXN_RUNNING);
+	F_CLR(txn,
+	    TXN_ERROR | TXN_HAS_ID | TXN_PREPARED | TXN_READONLY | TXN_RUNNING);
+}
+
+/*
+ * __txn_commit_timestamp --
+ *	Set the commit timestamp of a transaction's updates.
+ */
+static int
+__txn_commit_timestamp(WT_SESSION_IMPL *session, const char *cfg[])
+{
+	WT_CONFIG_ITEM cval;
+	WT_TXN *txn;
+	WT_TXN_OP *op;
+	uint64_t commit_ts, oldest_ts;
+	u_int i;
+
+	txn = &session->txn;
+
+	WT_RET(
+	    __wt_config_gets_def(session, cfg, "commit_timestamp", 0, &cval));
+	if ((commit_ts = (uint64_t)cval.val) == 0)
+		return (0);
+
+	/*
+	 * Readers at the oldest timestamp or our read timestamp may already
+	 * have seen the values we are replacing.
+	 */
+	if (commit_ts <=
+	    (oldest_ts = S2C(session)->txn_global.oldest_timestamp))
+		WT_RET_MSG(session, EINVAL,
+		    "commit timestamp %" PRIu64 " not newer than the oldest "
+		    "timestamp %" PRIu64, commit_ts, oldest_ts);
+	if (commit_ts < txn->read_timestamp)
+		WT_RET_MSG(session, EINVAL,
+		    "commit timestamp %" PRIu64 " older than the read "
+		    "timestamp %" PRIu64, commit_ts, txn->read_timestamp);
+
+	/*
+	 * The updates are not visible to other transactions until we release
+	 * our transaction ID, which publishes the timestamps.
+	 */
+	for (i = 0, op = txn->mod; i < txn->mod_count; i++, op++)
+		switch (op->type) {
+		case TXN_OP_BASIC:
+		case TXN_OP_INMEM:
+			op->u.upd->timestamp = commit_ts;
+			break;
+		case TXN_OP_REF:
+		case TXN_OP_TRUNCATE_COL:
+		case TXN_OP_TRUNCATE_ROW:
+			break;
+		}
+	return (0);
 }
 
 /*
@@ -371,8 +843,18 @@ __wt_txn_commit(WT_SESSION_IMPL *session, const char *cfg[])
 		WT_TRET(txn->notify->notify(txn->notify,
 		    (WT_SESSION *)session, txn->id, 1));
 
-	/* If we are logging, write a commit log record. */
-	if (ret == 0 && txn->mod_count > 0 &&
+	/* Set the commit timestamp of the transaction's updates. */
+	if (ret == 0)
+		ret = __txn_commit_timestamp(session, cfg);
+
+	/*
+	 * If we are logging, write a commit log record: a prepared transaction
+	 * logged its operations when it was prepared, if it had any.
+	 */
+	if (ret == 0 && txn->prepared != NULL && txn->prepared->logged) {
+		__wt_txn_release_snapshot(session);
+		ret = __wt_txn_log_prepare_resolve(session, 1);
+	} else if (ret == 0 && txn->mod_count > 0 &&
 	    FLD_ISSET(S2C(session)->log_flags, WT_CONN_LOG_ENABLED) &&
 	    !F_ISSET(session, WT_SESSION_NO_LOGGING)) {
 		/*
@@ -385,13 +867,15 @@ __wt_txn_commit(WT_SESSION_IMPL *session, const char *cfg[])
 	}
 
 	/*
-	 * If anything went wrong, roll back.
+	 * If anything went wrong, roll back, unless the transaction is
+	 * prepared: it stays prepared until the application resolves it.
 	 *
 	 * !!!
 	 * Nothing can fail after this point.
 	 */
 	if (ret != 0) {
-		WT_TRET(__wt_txn_rollback(session, cfg));
+		if (!F_ISSET(txn, TXN_PREPARED))
+			WT_TRET(__wt_txn_rollback(session, cfg));
 		return (ret);
 	}
 
@@ -400,6 +884,9 @@ __wt_txn_commit(WT_SESSION_IMPL *session, const char *cfg[])
 		__wt_txn_op_free(session, op);
 	txn->mod_count = 0;
 
+	if (F_ISSET(txn, TXN_PREPARED))
+		__wt_txn_prepare_clear(session, 1);
+
 	/*
 	 * We are about to release the snapshot: copy values into any
 	 * positioned cursors so they don't point to updates that could be
@@ -435,6 +922,14 @@ __wt_txn_rollback(WT_SESSION_IMPL *session, const char *cfg[])
 		WT_TRET(txn->notify->notify(txn->notify, (WT_SESSION *)session,
 		    txn->id, 0));
 
+	/*
+	 * If the transaction was prepared, log its rollback.  If that fails,
+	 * roll back anyway: recovery will find the transaction prepared, and
+	 * the application can roll it back again.
+	 */
+	if (txn->prepared != NULL && txn->prepared->logged)
+		WT_TRET(__wt_txn_log_prepare_resolve(session, 0));
+
 	/* Rollback updates. */
 	for (i = 0, op = txn->mod; i < txn->mod_count; i++, op++) {
 		/* Metadata updates are never rolled back. */
@@ -465,6 +960,9 @@ __wt_txn_rollback(WT_SESSION_IMPL *session, const char *cfg[])
 	}
 	txn->mod_count = 0;
 
+	if (F_ISSET(txn, TXN_PREPARED))
+		__wt_txn_prepare_clear(session, 0);
+
 	__wt_txn_release(session);
 	return (ret);
 }
@@ -539,6 +1037,7 @@ __wt_txn_destroy(WT_SESSION_IMPL *session)
 	txn = &session->txn;
 	__wt_free(session, txn->mod);
 	__wt_free(session, txn->snapshot);
+	__wt_txn_log_keys_free(session, &txn->log_keys);
 }
 
 /*
@@ -560,11 +1059,20 @@ __wt_txn_global_init(WT_SESSION_IMPL *session, const char *cfg[])
 	txn_global->current = txn_global->last_running =
 	    txn_global->oldest_id = WT_TXN_FIRST;
 
-	WT_RET(__wt_calloc_def(
-	    session, conn->session_size, &txn_global->states));
+	WT_RET(__wt_calloc(session, conn->session_size + 1,
+	    sizeof(WT_TXN_STATE), &txn_global->states_alloc));
+	txn_global->states = (WT_TXN_STATE *)(uintptr_t)WT_ALIGN(
+	    (uintptr_t)txn_global->states_alloc, WT_CACHE_LINE_ALIGNMENT);
 	for (i = 0, s = txn_global->states; i < conn->session_size; i++, s++)
 		s->id = s->snap_min = WT_TXN_NONE;
 
+	WT_RET(__wt_spin_init(
+	    session, &txn_global->prepare_lock, "transaction prepare"));
+	TAILQ_INIT(&txn_global->prepareqh);
+	WT_RET(__wt_calloc_def(session,
+	    WT_ALIGN(conn->session_size, sizeof(uint64_t)),
+	    &txn_global->active));
+
 	return (0);
 }
 
@@ -577,10 +1085,22 @@ __wt_txn_global_destroy(WT_SESSION_IMPL *session)
 {
 	WT_CONNECTION_IMPL *conn;
 	WT_TXN_GLOBAL *txn_global;
+	WT_TXN_STATE *s;
+	u_int i;
 
 	conn = S2C(session);
 	txn_global = &conn->txn_global;
 
-	if (txn_global != NULL)
-		__wt_free(session, txn_global->states);
+	if (txn_global != NULL) {
+		if (txn_global->states != NULL)
+			for (i = 0, s = txn_global->states;
+			    i < conn->session_size; i++, s++)
+				if (s->conflict_cond != NULL)
+					(void)__wt_cond_destroy(
+					    session, &s->conflict_cond);
+		__wt_free(session, txn_global->states_alloc);
+		txn_global->states = NULL;
+		__wt_txn_prepare_destroy(session);
+		__wt_free(session, txn_global->active);
+	}
 }
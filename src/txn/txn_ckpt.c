@@ -576,6 +576,14 @@ err:	/*
 
 	session->isolation = txn->isolation = saved_isolation;
 
+	/*
+	 * List the pages in the cache once a database checkpoint completes,
+	 * so a restart can warm the cache even if it doesn't follow a clean
+	 * shutdown.
+	 */
+	if (ret == 0 && full)
+		ret = __wt_cache_warmup_save(session);
+
 	return (ret);
 }
 
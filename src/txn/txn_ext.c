@@ -19,7 +19,10 @@ __wt_ext_transaction_id(WT_EXTENSION_API *wt_api, WT_SESSION *wt_session)
 
 	(void)wt_api;					/* Unused parameters */
 	session = (WT_SESSION_IMPL *)wt_session;
-	/* Ignore failures: the only case is running out of transaction IDs. */
+	/*
+	 * Ignore failures: running out of transaction IDs, or a read-only
+	 * transaction, which has no ID.
+	 */
 	(void)__wt_txn_id_check(session);
 	return (session->txn.id);
 }
@@ -8,6 +8,136 @@
 
 #include "wt_internal.h"
 
+/*
+ * __txn_log_key_find --
+ *	Return the last key of a file in a log record, adding an empty key if
+ *	the file has none.
+ */
+static int
+__txn_log_key_find(WT_SESSION_IMPL *session,
+    WT_TXN_LOG_KEYS *keys, uint32_t fileid, WT_ITEM **keyp)
+{
+	struct __wt_txn_log_key *k;
+	u_int i;
+
+	for (i = 0, k = keys->keys; i < keys->nkeys; i++, k++)
+		if (k->fileid == fileid) {
+			*keyp = &k->key;
+			return (0);
+		}
+
+	/* Entries past the end of the list keep their buffers for reuse. */
+	WT_RET(__wt_realloc_def(session,
+	    &keys->keys_alloc, keys->nkeys + 1, &keys->keys));
+	k = &keys->keys[keys->nkeys++];
+	k->fileid = fileid;
+	k->key.size = 0;
+	*keyp = &k->key;
+	return (0);
+}
+
+/*
+ * __wt_txn_log_keys_reset --
+ *	Start tracking the keys of a new log record.
+ */
+void
+__wt_txn_log_keys_reset(WT_TXN_LOG_KEYS *keys)
+{
+	keys->nkeys = 0;
+}
+
+/*
+ * __wt_txn_log_keys_free --
+ *	Free the keys tracked for compact log records.
+ */
+void
+__wt_txn_log_keys_free(WT_SESSION_IMPL *session, WT_TXN_LOG_KEYS *keys)
+{
+	size_t i;
+
+	for (i = 0; i < keys->keys_alloc / sizeof(*keys->keys); i++)
+		__wt_buf_free(session, &keys->keys[i].key);
+	__wt_free(session, keys->keys);
+	keys->keys_alloc = 0;
+	keys->nkeys = 0;
+}
+
+/*
+ * __wt_txn_log_key_decode --
+ *	Rebuild the key of a compact log operation from the last key of its
+ *	file, which is replaced: the returned key references it, and is valid
+ *	until the next operation on the file.
+ */
+int
+__wt_txn_log_key_decode(WT_SESSION_IMPL *session, WT_TXN_LOG_KEYS *keys,
+    uint32_t fileid, uint32_t prefix, WT_ITEM *suffix, WT_ITEM *key)
+{
+	WT_ITEM *last;
+
+	WT_RET(__txn_log_key_find(session, keys, fileid, &last));
+	if (prefix > last->size)
+		WT_RET_MSG(session, WT_ERROR,
+		    "compact log operation on file %" PRIu32 " shares %"
+		    PRIu32 " bytes with a previous key of %" WT_SIZET_FMT
+		    " bytes", fileid, prefix, last->size);
+
+	WT_RET(__wt_buf_grow(session, last, prefix + suffix->size));
+	memcpy((uint8_t *)last->mem + prefix, suffix->data, suffix->size);
+	last->size = prefix + suffix->size;
+
+	key->data = last->data;
+	key->size = last->size;
+	return (0);
+}
+
+/*
+ * __txn_op_log_compact --
+ *	Log a row-store operation with its key stored as the prefix it shares
+ *	with the last key logged for the file in this transaction.
+ */
+static int
+__txn_op_log_compact(WT_SESSION_IMPL *session,
+    WT_ITEM *logrec, WT_TXN_OP *op, WT_ITEM *key, WT_ITEM *value)
+{
+	WT_ITEM *last, suffix;
+	size_t full_size, size;
+	uint32_t prefix;
+	const uint8_t *a, *b;
+
+	WT_RET(__txn_log_key_find(
+	    session, &session->txn.log_keys, op->fileid, &last));
+	for (a = last->data, b = key->data,
+	    size = WT_MIN(last->size, key->size);
+	    size > 0 && *a == *b; --size, ++a, ++b)
+		;
+	prefix = (uint32_t)WT_PTRDIFF(b, key->data);
+	suffix.data = b;
+	suffix.size = key->size - prefix;
+
+	if (WT_UPDATE_DELETED_ISSET(op->u.upd))
+		WT_RET(__wt_logop_row_remove_compact_pack(
+		    session, logrec, op->fileid, prefix, &suffix));
+	else
+		WT_RET(__wt_logop_row_put_compact_pack(
+		    session, logrec, op->fileid, prefix, &suffix, value));
+
+	/*
+	 * Track the bytes saved: the full format packs the key's length and
+	 * the key, a key sharing nothing with the last key costs one byte.
+	 */
+	full_size = __wt_vsize_uint(key->size) + key->size;
+	size = __wt_vsize_uint(prefix) +
+	    __wt_vsize_uint(suffix.size) + suffix.size;
+	if (full_size > size)
+		WT_STAT_FAST_CONN_INCRV(
+		    session, log_compact_saved, full_size - size);
+	else
+		WT_STAT_FAST_CONN_DECRV(
+		    session, log_compact_saved, size - full_size);
+
+	return (__wt_buf_set(session, last, key->data, key->size));
+}
+
 /*
  * __txn_op_log --
  *	Log an operation for the current transaction.
@@ -47,7 +177,10 @@ __txn_op_log(WT_SESSION_IMPL *session,
 	} else {
 		WT_ERR(__wt_cursor_row_leaf_key(cbt, &key));
 
-		if (WT_UPDATE_DELETED_ISSET(upd))
+		if (FLD_ISSET(S2C(session)->log_flags, WT_CONN_LOG_COMPACT))
+			WT_ERR(__txn_op_log_compact(
+			    session, logrec, op, &key, &value));
+		else if (WT_UPDATE_DELETED_ISSET(upd))
 			WT_ERR(__wt_logop_row_remove_pack(session, logrec,
 			    op->fileid, &key));
 		else
@@ -137,6 +270,7 @@ __txn_logrec_init(WT_SESSION_IMPL *session)
 	    fmt, rectype, txn->id));
 	logrec->size += (uint32_t)header_size;
 	txn->logrec = logrec;
+	__wt_txn_log_keys_reset(&txn->log_keys);
 
 	if (0) {
 err:		__wt_logrec_free(session, &logrec);
@@ -193,6 +327,24 @@ __wt_txn_log_op(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt)
 	/* NOTREACHED */
 }
 
+/*
+ * __wt_txn_log_reserve --
+ *	Grow the in-memory buffer for the transaction's log record.
+ */
+int
+__wt_txn_log_reserve(WT_SESSION_IMPL *session, size_t size)
+{
+	WT_ITEM *logrec;
+
+	if (!FLD_ISSET(S2C(session)->log_flags, WT_CONN_LOG_ENABLED) ||
+	    F_ISSET(session, WT_SESSION_NO_LOGGING))
+		return (0);
+
+	WT_RET(__txn_logrec_init(session));
+	logrec = session->txn.logrec;
+	return (__wt_buf_extend(session, logrec, logrec->size + size));
+}
+
 /*
  * __wt_txn_log_commit --
  *	Write the operations of a transaction to the log at commit time.
@@ -209,6 +361,86 @@ __wt_txn_log_commit(WT_SESSION_IMPL *session, const char *cfg[])
 	return (__wt_log_write(session, txn->logrec, NULL, txn->txn_logsync));
 }
 
+/*
+ * __wt_txn_log_prepare --
+ *	Write the operations of a transaction to the log when the transaction
+ *	is prepared.
+ */
+int
+__wt_txn_log_prepare(
+    WT_SESSION_IMPL *session, uint64_t prepare_id, WT_LSN *lsnp)
+{
+	WT_DECL_ITEM(logrec);
+	WT_DECL_RET;
+	WT_ITEM *ops;
+	WT_TXN *txn;
+	const char *fmt = WT_UNCHECKED_STRING(Iq);
+	size_t commit_size, header_size, ops_size;
+	uint32_t rectype = WT_LOGREC_PREPARE;
+
+	txn = &session->txn;
+
+	/*
+	 * The transaction's log record is a commit record: copy its operations
+	 * into a prepare record, identified by the application's ID.
+	 */
+	WT_RET(__txn_logrec_init(session));
+	ops = txn->logrec;
+	WT_RET(__wt_struct_size(session,
+	    &commit_size, fmt, WT_LOGREC_COMMIT, txn->id));
+	commit_size += offsetof(WT_LOG_RECORD, record);
+	ops_size = ops->size - commit_size;
+
+	WT_RET(__wt_struct_size(
+	    session, &header_size, fmt, rectype, prepare_id));
+	WT_RET(__wt_logrec_alloc(session, header_size + ops_size, &logrec));
+	WT_ERR(__wt_struct_pack(session,
+	    (uint8_t *)logrec->data + logrec->size, header_size,
+	    fmt, rectype, prepare_id));
+	logrec->size += (uint32_t)header_size;
+	WT_ERR(__wt_buf_extend(session, logrec, logrec->size + ops_size));
+	memcpy((uint8_t *)logrec->data + logrec->size,
+	    (uint8_t *)ops->data + commit_size, ops_size);
+	logrec->size += (uint32_t)ops_size;
+
+	ret = __wt_log_write(session, logrec, lsnp, txn->txn_logsync);
+
+err:	__wt_logrec_free(session, &logrec);
+	return (ret);
+}
+
+/*
+ * __wt_txn_log_prepare_resolve --
+ *	Write a log record committing or rolling back a prepared transaction.
+ */
+int
+__wt_txn_log_prepare_resolve(WT_SESSION_IMPL *session, int commit)
+{
+	WT_DECL_ITEM(logrec);
+	WT_DECL_RET;
+	WT_TXN *txn;
+	const char *fmt = WT_UNCHECKED_STRING(Iq);
+	size_t header_size;
+	uint32_t rectype;
+
+	txn = &session->txn;
+	rectype =
+	    commit ? WT_LOGREC_PREPARE_COMMIT : WT_LOGREC_PREPARE_ROLLBACK;
+
+	WT_RET(__wt_struct_size(session,
+	    &header_size, fmt, rectype, txn->prepared->prepare_id));
+	WT_RET(__wt_logrec_alloc(session, header_size, &logrec));
+	WT_ERR(__wt_struct_pack(session,
+	    (uint8_t *)logrec->data + logrec->size, header_size,
+	    fmt, rectype, txn->prepared->prepare_id));
+	logrec->size += (uint32_t)header_size;
+
+	ret = __wt_log_write(session, logrec, NULL, txn->txn_logsync);
+
+err:	__wt_logrec_free(session, &logrec);
+	return (ret);
+}
+
 /*
  * __txn_log_file_sync --
  *	Write a log record for a file sync.
@@ -276,7 +508,7 @@ __wt_txn_checkpoint_log(
 	WT_DECL_ITEM(logrec);
 	WT_DECL_RET;
 	WT_ITEM *ckpt_snapshot, empty;
-	WT_LSN *ckpt_lsn;
+	WT_LSN *ckpt_lsn, *recover_lsn;
 	WT_TXN *txn;
 	uint8_t *end, *p;
 	size_t recsize;
@@ -302,7 +534,7 @@ __wt_txn_checkpoint_log(
 	switch (flags) {
 	case WT_TXN_LOG_CKPT_PREPARE:
 		txn->full_ckpt = 1;
-		*ckpt_lsn = S2C(session)->log->alloc_lsn;
+		__wt_txn_prepare_pin(session, ckpt_lsn, &txn->ckpt_recover_lsn);
 		break;
 
 	case WT_TXN_LOG_CKPT_START:
@@ -327,19 +559,26 @@ __wt_txn_checkpoint_log(
 			txn->ckpt_nsnapshot = 0;
 			WT_CLEAR(empty);
 			ckpt_snapshot = &empty;
-			*ckpt_lsn = S2C(session)->log->alloc_lsn;
+			__wt_txn_prepare_pin(
+			    session, ckpt_lsn, &txn->ckpt_recover_lsn);
 		} else
 			ckpt_snapshot = txn->ckpt_snapshot;
 
-		/* Write the checkpoint log record. */
+		/*
+		 * Write the checkpoint log record.  Recovery starts from the
+		 * checkpoint LSN, or the oldest prepare record of a prepared
+		 * transaction that hadn't been resolved when the checkpoint
+		 * started.
+		 */
+		recover_lsn = &txn->ckpt_recover_lsn;
 		WT_ERR(__wt_struct_size(session, &recsize, fmt,
-		    rectype, ckpt_lsn->file, ckpt_lsn->offset,
+		    rectype, recover_lsn->file, recover_lsn->offset,
 		    txn->ckpt_nsnapshot, ckpt_snapshot));
 		WT_ERR(__wt_logrec_alloc(session, recsize, &logrec));
 
 		WT_ERR(__wt_struct_pack(session,
 		    (uint8_t *)logrec->data + logrec->size, recsize, fmt,
-		    rectype, ckpt_lsn->file, ckpt_lsn->offset,
+		    rectype, recover_lsn->file, recover_lsn->offset,
 		    txn->ckpt_nsnapshot, ckpt_snapshot));
 		logrec->size += (uint32_t)recsize;
 		WT_ERR(__wt_log_write(session, logrec, lsnp,
@@ -352,12 +591,13 @@ __wt_txn_checkpoint_log(
 		 * checkpoint LSN so that it can archive.
 		 */
 		if (!S2C(session)->hot_backup)
-			WT_ERR(__wt_log_ckpt(session, ckpt_lsn));
+			WT_ERR(__wt_log_ckpt(session, recover_lsn));
 
 		/* FALLTHROUGH */
 	case WT_TXN_LOG_CKPT_FAIL:
 		/* Cleanup any allocated resources */
 		WT_INIT_LSN(ckpt_lsn);
+		WT_INIT_LSN(&txn->ckpt_recover_lsn);
 		txn->ckpt_nsnapshot = 0;
 		__wt_scr_free(session, &txn->ckpt_snapshot);
 		txn->full_ckpt = 0;
@@ -446,7 +686,7 @@ __txn_printlog(WT_SESSION_IMPL *session,
 	WT_LOG_RECORD *logrec;
 	WT_LSN ckpt_lsn;
 	int compressed;
-	uint64_t txnid;
+	uint64_t prepare_id, txnid;
 	uint32_t fileid, rectype;
 	int32_t start;
 	const uint8_t *end, *p;
@@ -493,6 +733,26 @@ __txn_printlog(WT_SESSION_IMPL *session,
 		WT_RET(__txn_commit_printlog(session, &p, end, out));
 		break;
 
+	case WT_LOGREC_PREPARE:
+		WT_RET(__wt_vunpack_uint(&p, WT_PTRDIFF(end, p), &prepare_id));
+		if (fprintf(out, "    \"type\" : \"prepare\",\n") < 0 ||
+		    fprintf(out, "    \"prepare_id\" : %" PRIu64 ",\n",
+		    prepare_id) < 0)
+			return (errno);
+		WT_RET(__txn_commit_printlog(session, &p, end, out));
+		break;
+
+	case WT_LOGREC_PREPARE_COMMIT:
+	case WT_LOGREC_PREPARE_ROLLBACK:
+		WT_RET(__wt_vunpack_uint(&p, WT_PTRDIFF(end, p), &prepare_id));
+		if (fprintf(out, "    \"type\" : \"%s\",\n",
+		    rectype == WT_LOGREC_PREPARE_COMMIT ?
+		    "prepare_commit" : "prepare_rollback") < 0 ||
+		    fprintf(out, "    \"prepare_id\" : %" PRIu64 "\n",
+		    prepare_id) < 0)
+			return (errno);
+		break;
+
 	case WT_LOGREC_FILE_SYNC:
 		WT_RET(__wt_struct_unpack(session, p, WT_PTRDIFF(end, p),
 		    WT_UNCHECKED_STRING(Ii), &fileid, &start));
@@ -0,0 +1,340 @@
+/*-
+ * Copyright (c) 2014-2015 MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * Prepared transactions: preparing a transaction writes its operations to the
+ * log in a prepare record, identified by an ID chosen by the application, and
+ * the transaction is later resolved by a record committing or rolling it back.
+ * Until it is resolved, the transaction's updates stay invisible, it can't
+ * update data, and it is never rolled back by WiredTiger.
+ *
+ * Checkpoints don't include the updates of running transactions, so the log
+ * must be kept from the oldest prepare record of a transaction that isn't
+ * resolved: each checkpoint records where recovery should start, and recovery
+ * reinstates transactions whose prepare record isn't followed by a resolution,
+ * holding each in an internal session until the application resolves it by
+ * its ID.
+ */
+
+/*
+ * __txn_prepare_insert --
+ *	Add an entry to the list of prepared transactions.
+ */
+static int
+__txn_prepare_insert(WT_SESSION_IMPL *session,
+    uint64_t prepare_id, WT_LSN *lsnp, int logged, WT_TXN_PREPARED **prepp)
+{
+	WT_TXN_GLOBAL *txn_global;
+	WT_TXN_PREPARED *prep, *p;
+
+	txn_global = &S2C(session)->txn_global;
+
+	WT_RET(__wt_calloc_one(session, &prep));
+	prep->prepare_id = prepare_id;
+	prep->logged = logged;
+
+	/*
+	 * If we don't have the LSN of the prepare record yet, use the next LSN
+	 * to be allocated: the record can only be written after it, and doing
+	 * this under the lock means a checkpoint either sees our entry or took
+	 * its LSN before we did.
+	 */
+	__wt_spin_lock(session, &txn_global->prepare_lock);
+	TAILQ_FOREACH(p, &txn_global->prepareqh, q)
+		if (p->prepare_id == prepare_id)
+			break;
+	if (p == NULL) {
+		prep->lsn = lsnp == NULL ? S2C(session)->log->alloc_lsn : *lsnp;
+		TAILQ_INSERT_TAIL(&txn_global->prepareqh, prep, q);
+	}
+	__wt_spin_unlock(session, &txn_global->prepare_lock);
+
+	if (p != NULL) {
+		__wt_free(session, prep);
+		WT_RET_MSG(session, EINVAL,
+		    "prepare_id %" PRIu64 " is already in use", prepare_id);
+	}
+
+	*prepp = prep;
+	return (0);
+}
+
+/*
+ * __txn_prepare_remove --
+ *	Remove an entry from the list of prepared transactions.
+ */
+static void
+__txn_prepare_remove(WT_SESSION_IMPL *session, WT_TXN_PREPARED **prepp)
+{
+	WT_TXN_GLOBAL *txn_global;
+
+	txn_global = &S2C(session)->txn_global;
+
+	__wt_spin_lock(session, &txn_global->prepare_lock);
+	TAILQ_REMOVE(&txn_global->prepareqh, *prepp, q);
+	__wt_spin_unlock(session, &txn_global->prepare_lock);
+
+	__wt_free(session, *prepp);
+}
+
+/*
+ * __wt_txn_prepare --
+ *	Prepare the current transaction.
+ */
+int
+__wt_txn_prepare(WT_SESSION_IMPL *session, const char *cfg[])
+{
+	WT_CONFIG_ITEM cval;
+	WT_DECL_RET;
+	WT_LSN lsn;
+	WT_TXN *txn;
+	WT_TXN_GLOBAL *txn_global;
+	WT_TXN_PREPARED *prep;
+	uint64_t prepare_id;
+
+	txn = &session->txn;
+	txn_global = &S2C(session)->txn_global;
+	prep = NULL;
+
+	if (!F_ISSET(txn, TXN_RUNNING))
+		WT_RET_MSG(session, EINVAL, "No transaction is active");
+	if (F_ISSET(txn, TXN_PREPARED))
+		WT_RET_MSG(session, EINVAL, "transaction is already prepared");
+	if (F_ISSET(txn, TXN_ERROR))
+		WT_RET_MSG(session, EINVAL,
+		    "failed transaction requires rollback");
+
+	/*
+	 * A prepared transaction must survive a crash until it is resolved,
+	 * which requires the prepare record be written to the log.
+	 */
+	if (!FLD_ISSET(S2C(session)->log_flags, WT_CONN_LOG_ENABLED) ||
+	    F_ISSET(session, WT_SESSION_NO_LOGGING))
+		WT_RET_MSG(session, ENOTSUP,
+		    "preparing a transaction requires logging be enabled");
+
+	WT_RET(__wt_config_gets_def(session, cfg, "prepare_id", 0, &cval));
+	if (cval.val == 0)
+		WT_RET_MSG(session, EINVAL,
+		    "preparing a transaction requires a non-zero prepare_id");
+	prepare_id = (uint64_t)cval.val;
+
+	/*
+	 * Track the transaction until it is resolved, which also checks its
+	 * identifier is unique.  If the transaction has updates, log them now
+	 * in a prepare record: a transaction without updates has nothing to
+	 * recover.  The entry is marked as logged when it's inserted, so a
+	 * checkpoint can't miss a prepare record being written.
+	 */
+	WT_RET(__txn_prepare_insert(
+	    session, prepare_id, NULL, txn->mod_count > 0, &prep));
+	if (prep->logged) {
+		WT_ERR(__wt_txn_log_prepare(session, prepare_id, &lsn));
+
+		__wt_spin_lock(session, &txn_global->prepare_lock);
+		prep->lsn = lsn;
+		__wt_spin_unlock(session, &txn_global->prepare_lock);
+	}
+	txn->prepared = prep;
+
+	F_SET(txn, TXN_PREPARED);
+	WT_STAT_FAST_CONN_INCR(session, txn_prepare);
+	return (0);
+
+err:	__txn_prepare_remove(session, &prep);
+	return (ret);
+}
+
+/*
+ * __wt_txn_prepare_clear --
+ *	Discard the state of a prepared transaction once it is resolved.
+ */
+void
+__wt_txn_prepare_clear(WT_SESSION_IMPL *session, int committed)
+{
+	WT_TXN *txn;
+
+	txn = &session->txn;
+
+	if (txn->prepared != NULL)
+		__txn_prepare_remove(session, &txn->prepared);
+
+	if (committed)
+		WT_STAT_FAST_CONN_INCR(session, txn_prepare_commit);
+	else
+		WT_STAT_FAST_CONN_INCR(session, txn_prepare_rollback);
+}
+
+/*
+ * __wt_txn_prepare_detach --
+ *	Detach a prepared transaction from its session without resolving it,
+ *	when the database is closed: the transaction can then be rolled back
+ *	in memory, and is recovered when the database is next opened.
+ */
+void
+__wt_txn_prepare_detach(WT_SESSION_IMPL *session)
+{
+	WT_TXN *txn;
+
+	txn = &session->txn;
+
+	/* The entry stays on the list so the final checkpoint keeps it. */
+	txn->prepared = NULL;
+	F_CLR(txn, TXN_PREPARED);
+}
+
+/*
+ * __wt_txn_prepare_pin --
+ *	Return the LSN a checkpoint starts at, and where recovery of the
+ *	checkpoint must start to see the prepare record of every transaction
+ *	that isn't resolved.  Transactions without a prepare record don't
+ *	hold back recovery or log archiving.
+ */
+void
+__wt_txn_prepare_pin(
+    WT_SESSION_IMPL *session, WT_LSN *ckpt_lsn, WT_LSN *recover_lsn)
+{
+	WT_TXN_GLOBAL *txn_global;
+	WT_TXN_PREPARED *prep;
+
+	txn_global = &S2C(session)->txn_global;
+
+	__wt_spin_lock(session, &txn_global->prepare_lock);
+	*ckpt_lsn = *recover_lsn = S2C(session)->log->alloc_lsn;
+	TAILQ_FOREACH(prep, &txn_global->prepareqh, q)
+		if (prep->logged && LOG_CMP(&prep->lsn, recover_lsn) < 0)
+			*recover_lsn = prep->lsn;
+	__wt_spin_unlock(session, &txn_global->prepare_lock);
+}
+
+/*
+ * __wt_txn_prepare_recover --
+ *	Mark a transaction reinstated by recovery in an internal session as
+ *	prepared.
+ */
+int
+__wt_txn_prepare_recover(WT_SESSION_IMPL *session,
+    WT_SESSION_IMPL *txn_session, uint64_t prepare_id, WT_LSN *lsnp)
+{
+	WT_TXN *txn;
+
+	txn = &txn_session->txn;
+
+	WT_RET(__txn_prepare_insert(
+	    session, prepare_id, lsnp, 1, &txn->prepared));
+	txn->prepared->session = txn_session;
+	F_SET(txn, TXN_PREPARED);
+	WT_STAT_FAST_CONN_INCR(session, txn_prepare_recover);
+	return (0);
+}
+
+/*
+ * __wt_txn_prepare_resolve --
+ *	Commit or roll back a prepared transaction reinstated by recovery.
+ */
+int
+__wt_txn_prepare_resolve(WT_SESSION_IMPL *session,
+    uint64_t prepare_id, const char *cfg[], int commit)
+{
+	WT_DECL_RET;
+	WT_SESSION_IMPL *txn_session;
+	WT_TXN_GLOBAL *txn_global;
+	WT_TXN_PREPARED *prep;
+
+	txn_global = &S2C(session)->txn_global;
+
+	if (F_ISSET(&session->txn, TXN_RUNNING))
+		WT_RET_MSG(session, EINVAL,
+		    "a prepared transaction can't be resolved by its "
+		    "prepare_id while a transaction is running");
+
+	/* Claim the transaction's session. */
+	txn_session = NULL;
+	__wt_spin_lock(session, &txn_global->prepare_lock);
+	TAILQ_FOREACH(prep, &txn_global->prepareqh, q)
+		if (prep->prepare_id == prepare_id && prep->session != NULL) {
+			txn_session = prep->session;
+			prep->session = NULL;
+			break;
+		}
+	__wt_spin_unlock(session, &txn_global->prepare_lock);
+	if (txn_session == NULL)
+		return (WT_NOTFOUND);
+
+	/*
+	 * If the commit fails, the transaction is still prepared, give the
+	 * session back.
+	 */
+	if (commit && (ret = __wt_txn_commit(txn_session, cfg)) != 0) {
+		__wt_spin_lock(session, &txn_global->prepare_lock);
+		txn_session->txn.prepared->session = txn_session;
+		__wt_spin_unlock(session, &txn_global->prepare_lock);
+		return (ret);
+	}
+	if (!commit)
+		ret = __wt_txn_rollback(txn_session, cfg);
+
+	WT_TRET(txn_session->iface.close(&txn_session->iface, NULL));
+	return (ret);
+}
+
+/*
+ * __wt_txn_prepare_close --
+ *	Discard the transactions reinstated by recovery and not resolved when
+ *	the database is closed, they are recovered again when it's reopened.
+ */
+int
+__wt_txn_prepare_close(WT_SESSION_IMPL *session)
+{
+	WT_DECL_RET;
+	WT_SESSION_IMPL *txn_session;
+	WT_TXN_GLOBAL *txn_global;
+	WT_TXN_PREPARED *prep;
+
+	txn_global = &S2C(session)->txn_global;
+
+	for (;;) {
+		txn_session = NULL;
+		__wt_spin_lock(session, &txn_global->prepare_lock);
+		TAILQ_FOREACH(prep, &txn_global->prepareqh, q)
+			if (prep->session != NULL) {
+				txn_session = prep->session;
+				prep->session = NULL;
+				break;
+			}
+		__wt_spin_unlock(session, &txn_global->prepare_lock);
+		if (txn_session == NULL)
+			break;
+
+		__wt_txn_prepare_detach(txn_session);
+		WT_TRET(__wt_txn_rollback(txn_session, NULL));
+		WT_TRET(txn_session->iface.close(&txn_session->iface, NULL));
+	}
+	return (ret);
+}
+
+/*
+ * __wt_txn_prepare_destroy --
+ *	Free the list of prepared transactions.
+ */
+void
+__wt_txn_prepare_destroy(WT_SESSION_IMPL *session)
+{
+	WT_TXN_GLOBAL *txn_global;
+	WT_TXN_PREPARED *prep;
+
+	txn_global = &S2C(session)->txn_global;
+
+	while ((prep = TAILQ_FIRST(&txn_global->prepareqh)) != NULL) {
+		TAILQ_REMOVE(&txn_global->prepareqh, prep, q);
+		__wt_free(session, prep);
+	}
+	__wt_spin_destroy(session, &txn_global->prepare_lock);
+}
@@ -22,7 +22,19 @@ typedef struct {
 	u_int max_fileid;		/* Maximum file ID seen. */
 	u_int nfiles;			/* Number of files in the metadata. */
 
+	/* Prepared transactions not yet resolved in the log. */
+	struct WT_RECOVERY_PREPARED {
+		uint64_t prepare_id;	/* Application's identifier. */
+		WT_LSN lsn;		/* Prepare record's LSN. */
+		WT_ITEM ops;		/* Transaction's operations. */
+	} *prepared;
+	size_t prepared_alloc;		/* Allocated size of prepared array. */
+	u_int nprepared;		/* Number of prepared transactions. */
+
+	WT_TXN_LOG_KEYS keys;		/* Keys of compact log operations. */
+
 	WT_LSN ckpt_lsn;		/* Start LSN for main recovery loop. */
+	int ckpt_found;			/* Was a checkpoint record found? */
 
 	int missing;			/* Were there missing files? */
 	int modified;			/* Did recovery make any changes? */
@@ -108,10 +120,10 @@ __txn_op_apply(
 {
 	WT_CURSOR *cursor, *start, *stop;
 	WT_DECL_RET;
-	WT_ITEM key, start_key, stop_key, value;
+	WT_ITEM key, start_key, stop_key, suffix, value;
 	WT_SESSION_IMPL *session;
 	uint64_t recno, start_recno, stop_recno;
-	uint32_t fileid, mode, optype, opsize;
+	uint32_t fileid, mode, optype, opsize, prefix;
 
 	session = r->session;
 	cursor = NULL;
@@ -187,6 +199,31 @@ __txn_op_apply(
 		WT_ERR(cursor->remove(cursor));
 		break;
 
+	case WT_LOGOP_ROW_PUT_COMPACT:
+		/*
+		 * Rebuild the key even if the operation is skipped, later
+		 * operations on the file depend on it.
+		 */
+		WT_ERR(__wt_logop_row_put_compact_unpack(session, pp, end,
+		    &fileid, &prefix, &suffix, &value));
+		WT_ERR(__wt_txn_log_key_decode(
+		    session, &r->keys, fileid, prefix, &suffix, &key));
+		GET_RECOVERY_CURSOR(session, r, lsnp, fileid, &cursor);
+		__wt_cursor_set_raw_key(cursor, &key);
+		__wt_cursor_set_raw_value(cursor, &value);
+		WT_ERR(cursor->insert(cursor));
+		break;
+
+	case WT_LOGOP_ROW_REMOVE_COMPACT:
+		WT_ERR(__wt_logop_row_remove_compact_unpack(session, pp, end,
+		    &fileid, &prefix, &suffix));
+		WT_ERR(__wt_txn_log_key_decode(
+		    session, &r->keys, fileid, prefix, &suffix, &key));
+		GET_RECOVERY_CURSOR(session, r, lsnp, fileid, &cursor);
+		__wt_cursor_set_raw_key(cursor, &key);
+		WT_ERR(cursor->remove(cursor));
+		break;
+
 	case WT_LOGOP_ROW_TRUNCATE:
 		WT_ERR(__wt_logop_row_truncate_unpack(session, pp, end,
 		    &fileid, &start_key, &stop_key, &mode));
@@ -250,6 +287,9 @@ __txn_commit_apply(
 {
 	WT_UNUSED(lsnp);
 
+	/* Keys of compact operations depend on earlier keys in the record. */
+	__wt_txn_log_keys_reset(&r->keys);
+
 	/* The logging subsystem zero-pads records. */
 	while (*pp < end && **pp)
 		WT_RET(__txn_op_apply(r, lsnp, pp, end));
@@ -257,6 +297,161 @@ __txn_commit_apply(
 	return (0);
 }
 
+/*
+ * __txn_prepare_find --
+ *	Find a prepared transaction by its identifier during recovery.
+ */
+static struct WT_RECOVERY_PREPARED *
+__txn_prepare_find(WT_RECOVERY *r, uint64_t prepare_id)
+{
+	u_int i;
+
+	for (i = 0; i < r->nprepared; i++)
+		if (r->prepared[i].prepare_id == prepare_id)
+			return (&r->prepared[i]);
+	return (NULL);
+}
+
+/*
+ * __txn_prepare_discard --
+ *	Discard a prepared transaction resolved in the log.
+ */
+static void
+__txn_prepare_discard(WT_RECOVERY *r, struct WT_RECOVERY_PREPARED *prep)
+{
+	__wt_buf_free(r->session, &prep->ops);
+	*prep = r->prepared[--r->nprepared];
+	WT_CLEAR(r->prepared[r->nprepared]);
+}
+
+/*
+ * __txn_prepare_read --
+ *	Read a prepare record or its resolution during recovery: the operations
+ *	of a prepared transaction are applied when its commit record is read.
+ */
+static int
+__txn_prepare_read(WT_RECOVERY *r, WT_LSN *lsnp,
+    uint32_t rectype, const uint8_t **pp, const uint8_t *end)
+{
+	struct WT_RECOVERY_PREPARED *prep;
+	WT_SESSION_IMPL *session;
+	uint64_t prepare_id;
+	const uint8_t *ops_end, *p;
+
+	session = r->session;
+
+	WT_RET(__wt_vunpack_uint(pp, WT_PTRDIFF(end, *pp), &prepare_id));
+	prep = __txn_prepare_find(r, prepare_id);
+
+	switch (rectype) {
+	case WT_LOGREC_PREPARE:
+		if (prep == NULL) {
+			WT_RET(__wt_realloc_def(session, &r->prepared_alloc,
+			    r->nprepared + 1, &r->prepared));
+			prep = &r->prepared[r->nprepared++];
+			prep->prepare_id = prepare_id;
+		}
+		prep->lsn = *lsnp;
+		WT_RET(__wt_buf_set(
+		    session, &prep->ops, *pp, WT_PTRDIFF(end, *pp)));
+		break;
+
+	case WT_LOGREC_PREPARE_COMMIT:
+		/*
+		 * Ignore resolutions of transactions prepared before recovery
+		 * starts: they were resolved before the checkpoint.
+		 */
+		if (prep == NULL)
+			break;
+		p = prep->ops.data;
+		ops_end = p + prep->ops.size;
+		WT_RET(__txn_commit_apply(r, lsnp, &p, ops_end));
+		__txn_prepare_discard(r, prep);
+		break;
+
+	case WT_LOGREC_PREPARE_ROLLBACK:
+		if (prep != NULL)
+			__txn_prepare_discard(r, prep);
+		break;
+
+	WT_ILLEGAL_VALUE(session);
+	}
+
+	return (0);
+}
+
+/*
+ * __txn_prepare_reinstate --
+ *	Reinstate the prepared transactions not resolved in the log, each in
+ *	an internal session, until the application commits or rolls them back.
+ */
+static int
+__txn_prepare_reinstate(WT_RECOVERY *r)
+{
+	struct WT_RECOVERY_FILE *files;
+	struct WT_RECOVERY_PREPARED *prep;
+	WT_CURSOR *c;
+	WT_DECL_RET;
+	WT_RECOVERY txn_r;
+	WT_SESSION_IMPL *session, *txn_session;
+	const uint8_t *ops_end, *p;
+	u_int i, j;
+
+	session = r->session;
+	files = NULL;
+	txn_session = NULL;
+
+	/*
+	 * The operations of prepared transactions aren't in any checkpoint:
+	 * apply them whatever the LSN of the file's checkpoint.
+	 */
+	if (r->nfiles > 0)
+		WT_RET(__wt_calloc_def(session, r->nfiles, &files));
+	for (i = 0; i < r->nfiles; i++) {
+		files[i].uri = r->files[i].uri;
+		WT_INIT_LSN(&files[i].ckpt_lsn);
+	}
+
+	for (i = 0, prep = r->prepared; i < r->nprepared; i++, prep++) {
+		WT_ERR(__wt_open_internal_session(S2C(session),
+		    "prepared transaction", 1, 1, &txn_session));
+		F_SET(txn_session, WT_SESSION_NO_LOGGING);
+		WT_ERR(__wt_txn_begin(txn_session, NULL));
+
+		txn_r = *r;
+		txn_r.session = txn_session;
+		txn_r.files = files;
+		WT_CLEAR(txn_r.keys);
+		p = prep->ops.data;
+		ops_end = p + prep->ops.size;
+		ret = __txn_commit_apply(&txn_r, &prep->lsn, &p, ops_end);
+		__wt_txn_log_keys_free(txn_session, &txn_r.keys);
+		for (j = 0; j < r->nfiles; j++)
+			if ((c = files[j].c) != NULL) {
+				files[j].c = NULL;
+				WT_TRET(c->close(c));
+			}
+		WT_ERR(ret);
+
+		WT_ERR(__wt_txn_prepare_recover(
+		    session, txn_session, prep->prepare_id, &prep->lsn));
+		txn_session = NULL;
+
+		WT_ERR(__wt_verbose(session, WT_VERB_RECOVERY,
+		    "Recovered prepared transaction %" PRIu64
+		    " at LSN %u/%" PRIuMAX, prep->prepare_id,
+		    prep->lsn.file, (uintmax_t)prep->lsn.offset));
+	}
+
+err:	if (txn_session != NULL) {
+		if (F_ISSET(&txn_session->txn, TXN_RUNNING))
+			WT_TRET(__wt_txn_rollback(txn_session, NULL));
+		WT_TRET(txn_session->iface.close(&txn_session->iface, NULL));
+	}
+	__wt_free(session, files);
+	return (ret);
+}
+
 /*
  * __txn_log_recover --
  *	Roll the log forward to recover committed changes.
@@ -280,9 +475,11 @@ __txn_log_recover(WT_SESSION_IMPL *session,
 
 	switch (rectype) {
 	case WT_LOGREC_CHECKPOINT:
-		if (r->metadata_only)
+		if (r->metadata_only) {
 			WT_RET(__wt_txn_checkpoint_logread(
 			    session, &p, end, &r->ckpt_lsn));
+			r->ckpt_found = 1;
+		}
 		break;
 
 	case WT_LOGREC_COMMIT:
@@ -290,6 +487,13 @@ __txn_log_recover(WT_SESSION_IMPL *session,
 		WT_UNUSED(txnid);
 		WT_RET(__txn_commit_apply(r, lsnp, &p, end));
 		break;
+
+	case WT_LOGREC_PREPARE:
+	case WT_LOGREC_PREPARE_COMMIT:
+	case WT_LOGREC_PREPARE_ROLLBACK:
+		if (!r->metadata_only)
+			WT_RET(__txn_prepare_read(r, lsnp, rectype, &p, end));
+		break;
 	}
 
 	return (0);
@@ -363,6 +567,12 @@ __recovery_free(WT_RECOVERY *r)
 	}
 
 	__wt_free(session, r->files);
+
+	for (i = 0; i < r->nprepared; i++)
+		__wt_buf_free(session, &r->prepared[i].ops);
+	__wt_free(session, r->prepared);
+
+	__wt_txn_log_keys_free(session, &r->keys);
 	return (ret);
 }
 
@@ -465,6 +675,18 @@ __wt_txn_recover(WT_SESSION_IMPL *session)
 			r.ckpt_lsn = metafile->ckpt_lsn;
 			WT_ERR(__wt_log_scan(session,
 			    &metafile->ckpt_lsn, 0, __txn_log_recover, &r));
+
+			/*
+			 * If the checkpoint record wasn't written, recovery
+			 * may have to start before the checkpoint LSN to see
+			 * the prepare records of transactions that weren't
+			 * resolved: start from the previous checkpoint.
+			 */
+			if (!r.ckpt_found) {
+				WT_INIT_LSN(&r.ckpt_lsn);
+				WT_ERR(__wt_log_scan(session, NULL,
+				    WT_LOGSCAN_FIRST, __txn_log_recover, &r));
+			}
 		}
 	}
 
@@ -508,6 +730,9 @@ __wt_txn_recover(WT_SESSION_IMPL *session)
 
 	conn->next_file_id = r.max_fileid;
 
+	/* Reinstate prepared transactions that weren't resolved. */
+	WT_ERR(__txn_prepare_reinstate(&r));
+
 	/*
 	 * If recovery ran successfully forcibly log a checkpoint so the next
 	 * open is fast and keep the metadata up to date with the checkpoint
@@ -100,10 +100,12 @@ list_print(WT_SESSION *session, const char *name, int cflag, int vflag)
 		/*
 		 * XXX
 		 * We don't normally say anything about the WiredTiger
-		 * metadata, it's not a normal "object" in the database.  I'm
-		 * making an exception for the checkpoint and verbose options.
+		 * metadata or lookaside table, they're not normal "objects"
+		 * in the database.  I'm making an exception for the checkpoint
+		 * and verbose options.
 		 */
-		if (strcmp(key, WT_METADATA_URI) != 0 || cflag || vflag)
+		if ((strcmp(key, WT_METADATA_URI) != 0 &&
+		    strcmp(key, WT_LAS_URI) != 0) || cflag || vflag)
 			printf("%s\n", key);
 
 		if (!cflag && !vflag)
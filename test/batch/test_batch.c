@@ -0,0 +1,623 @@
+/*-
+ * Public Domain 2014-2015 MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * Test WT_SESSION::write_batch: batches applied sorted, directly to row-store
+ * trees, and in batch order, across leaf pages and page splits, on several
+ * tables, failing part way through, and read back after they commit and after
+ * recovery.  The expected contents of each table are tracked in a model,
+ * holding the generation of each key's value, zero if the key is absent.
+ */
+
+#define	HOME		"WT_TEST"		/* Database directory */
+#define	HOME_RESTART	"WT_RESTART"		/* Crashed database copy */
+
+#define	KEY_MAX		6000			/* Key space */
+
+typedef struct {
+	const char *uri;			/* Table */
+	const char *config;			/* Table configuration */
+	int colstore;				/* Column-store */
+	size_t value_len;			/* Value length */
+
+	WT_CURSOR *cursor;			/* Raw cursor */
+	u_int model[KEY_MAX + 1];		/* Value generation by key */
+} TABLE;
+
+static struct {
+	char *progname;				/* Program name */
+
+	WT_CONNECTION *conn;			/* WT_CONNECTION handle */
+	WT_SESSION *session;			/* WT_SESSION handle */
+
+	u_int c_srand;				/* Random seed */
+
+	TABLE a, b, c;				/* Tables */
+
+	WT_BATCH_OP *ops;			/* Batch */
+	u_int nops;
+	u_int gen;				/* Current value generation */
+} g;
+
+void add(TABLE *, WT_BATCH_OPTYPE, u_int);
+void apply(int, int);
+void check(TABLE *);
+void check_all(void);
+void die(int e, const char *fmt, ...);
+void fail(void);
+void mixed(void);
+void recover(void);
+void reset(void);
+void setup(void);
+void shuffle(void);
+void sorted(void);
+int64_t stat_value(int);
+void unsorted(void);
+void usage(void);
+void value(TABLE *, u_int, u_int, char *);
+
+extern char *__wt_optarg;
+extern int __wt_optind;
+
+int
+main(int argc, char *argv[])
+{
+	int ch;
+
+	if ((g.progname = strrchr(argv[0], '/')) == NULL)
+		g.progname = argv[0];
+	else
+		++g.progname;
+
+	/* Set default configuration values. */
+	g.c_srand = 3233456;
+
+	/* Set values from the command line. */
+	while ((ch = __wt_getopt(g.progname, argc, argv, "s:")) != EOF)
+		switch (ch) {
+		case 's':			/* Random seed */
+			g.c_srand = (u_int)atoi(__wt_optarg);
+			break;
+		default:
+			usage();
+		}
+
+	argc -= __wt_optind;
+	if (argc != 0)
+		usage();
+
+	srand(g.c_srand);
+
+	setup();
+	sorted();
+	mixed();
+	unsorted();
+	fail();
+	recover();
+
+	free(g.ops);
+	return (EXIT_SUCCESS);
+}
+
+/*
+ * setup --
+ *	Create the database and the tables.
+ */
+void
+setup(void)
+{
+	TABLE *t;
+	int i, ret;
+
+	if ((ret = system("rm -rf " HOME " " HOME_RESTART " && "
+	    "mkdir " HOME)) != 0)
+		die(ret, "system cleanup call failed");
+	if ((ret = wiredtiger_open(HOME, NULL,
+	    "create,cache_size=50MB,log=(enabled),statistics=(fast)",
+	    &g.conn)) != 0)
+		die(ret, "wiredtiger_open");
+	if ((ret = g.conn->open_session(
+	    g.conn, NULL, NULL, &g.session)) != 0)
+		die(ret, "connection.open_session");
+
+	/*
+	 * Small leaf pages and a small memory page maximum, so batches cross
+	 * many leaf pages, and large pages are split.
+	 */
+	g.a.uri = "table:batch_a";
+	g.a.config = "key_format=S,value_format=S,"
+	    "allocation_size=512,leaf_page_max=512,memory_page_max=32KB";
+	g.a.value_len = 100;
+	g.b.uri = "table:batch_b";
+	g.b.config = "key_format=S,value_format=S";
+	g.b.value_len = 20;
+	g.c.uri = "table:batch_c";
+	g.c.config = "key_format=r,value_format=S";
+	g.c.colstore = 1;
+	g.c.value_len = 20;
+
+	for (i = 0; i < 3; ++i) {
+		t = i == 0 ? &g.a : (i == 1 ? &g.b : &g.c);
+		if ((ret =
+		    g.session->create(g.session, t->uri, t->config)) != 0)
+			die(ret, "session.create: %s", t->uri);
+		if ((ret = g.session->open_cursor(
+		    g.session, t->uri, NULL, "raw", &t->cursor)) != 0)
+			die(ret, "session.open_cursor: %s", t->uri);
+	}
+
+	if ((g.ops = calloc(KEY_MAX * 2, sizeof(WT_BATCH_OP))) == NULL)
+		die(errno, "calloc");
+}
+
+/*
+ * sorted --
+ *	Apply batches in random order on a single row-store table: they are
+ *	sorted, and applied to the leaf pages directly.
+ */
+void
+sorted(void)
+{
+	int64_t leaf, splits;
+	u_int i;
+
+	/*
+	 * Fill an empty tree: its leaf page grows past its maximum size, and
+	 * is split while the batch is applied.
+	 */
+	reset();
+	for (i = 0; i < KEY_MAX; i += 2)
+		add(&g.a, WT_BATCH_INSERT, i);
+	shuffle();
+	splits = stat_value(WT_STAT_CONN_CACHE_EVICTION_SPLIT) +
+	    stat_value(WT_STAT_CONN_CACHE_INMEM_SPLIT);
+	apply(0, 0);
+	if (stat_value(WT_STAT_CONN_CACHE_EVICTION_SPLIT) +
+	    stat_value(WT_STAT_CONN_CACHE_INMEM_SPLIT) <= splits)
+		die(0, "large page wasn't split");
+	check(&g.a);
+
+	/*
+	 * Insert between the keys, update and remove keys, across the pages
+	 * created by the split: the batch moves to the next leaf page when a
+	 * key isn't on the current one.
+	 */
+	reset();
+	for (i = 0; i < KEY_MAX; ++i)
+		if (i % 2 == 1)
+			add(&g.a, WT_BATCH_INSERT, i);
+		else if (i % 5 == 0)
+			add(&g.a, WT_BATCH_REMOVE, i);
+		else if (i % 3 == 0)
+			add(&g.a, WT_BATCH_UPDATE, i);
+	shuffle();
+	leaf = stat_value(WT_STAT_CONN_CURSOR_WRITE_BATCH_LEAF);
+	apply(0, 0);
+	leaf = stat_value(WT_STAT_CONN_CURSOR_WRITE_BATCH_LEAF) - leaf;
+	if (leaf == 0 || leaf >= (int64_t)g.nops)
+		die(0, "%" PRId64 " of %u operations searched their leaf page",
+		    leaf, g.nops);
+	check(&g.a);
+}
+
+/*
+ * mixed --
+ *	Apply a batch on two row-store tables, with several operations on the
+ *	same keys: they are applied in batch order.
+ */
+void
+mixed(void)
+{
+	u_int i;
+
+	reset();
+	for (i = 0; i < KEY_MAX; i += 3) {
+		add(&g.b, WT_BATCH_INSERT, i);
+		add(&g.a, WT_BATCH_UPDATE, i);
+	}
+	for (i = 0; i < KEY_MAX; i += 30) {
+		add(&g.b, WT_BATCH_REMOVE, i);
+		add(&g.a, WT_BATCH_INSERT, i);
+		add(&g.b, WT_BATCH_INSERT, i + 3);
+		add(&g.a, WT_BATCH_REMOVE, i + 1);
+	}
+	apply(0, 0);
+	check(&g.a);
+	check(&g.b);
+}
+
+/*
+ * unsorted --
+ *	Apply batches including a column-store table: they are applied in batch
+ *	order through the cursors.
+ */
+void
+unsorted(void)
+{
+	int64_t leaf;
+	u_int i;
+
+	reset();
+	for (i = KEY_MAX; i > 0; --i) {
+		add(&g.c, WT_BATCH_INSERT, i);
+		if (i % 7 == 0)
+			add(&g.c, WT_BATCH_REMOVE, i);
+		if (i % 11 == 0)
+			add(&g.b, WT_BATCH_UPDATE, i - 1);
+	}
+	leaf = stat_value(WT_STAT_CONN_CURSOR_WRITE_BATCH_LEAF);
+	apply(0, 0);
+	if (stat_value(WT_STAT_CONN_CURSOR_WRITE_BATCH_LEAF) != leaf)
+		die(0, "unsorted batch searched leaf pages");
+	check(&g.b);
+	check(&g.c);
+
+	reset();
+	for (i = 1; i <= KEY_MAX; i += 13) {
+		add(&g.a, WT_BATCH_UPDATE, i);
+		add(&g.c, WT_BATCH_UPDATE, i);
+		add(&g.c, WT_BATCH_REMOVE, i + 1);
+	}
+	apply(0, 0);
+	check(&g.a);
+	check(&g.c);
+}
+
+/*
+ * fail --
+ *	Apply batches that fail part way through: none of their operations
+ *	are applied.
+ */
+void
+fail(void)
+{
+	WT_CURSOR *cursor;
+	int ret, sort;
+
+	/* Insert an existing key with overwrite disabled. */
+	if ((ret = g.session->open_cursor(g.session,
+	    g.a.uri, NULL, "raw,overwrite=false", &cursor)) != 0)
+		die(ret, "session.open_cursor");
+
+	for (sort = 1; sort >= 0; --sort) {
+		/* Auto-commit: the batch is rolled back. */
+		reset();
+		add(&g.a, WT_BATCH_UPDATE, 1);
+		add(&g.a, WT_BATCH_INSERT, 2);
+		add(&g.b, WT_BATCH_INSERT, 2);
+		if (!sort)
+			add(&g.c, WT_BATCH_INSERT, 2);
+		add(&g.a, WT_BATCH_INSERT, 3);
+		g.ops[g.nops - 1].cursor = cursor;
+		add(&g.a, WT_BATCH_REMOVE, 5);
+		apply(WT_DUPLICATE_KEY, 0);
+		check_all();
+
+		/* In a transaction: the transaction must be rolled back. */
+		reset();
+		add(&g.b, WT_BATCH_REMOVE, 3);
+		if (!sort)
+			add(&g.c, WT_BATCH_REMOVE, 5);
+		add(&g.a, WT_BATCH_INSERT, 3);
+		g.ops[g.nops - 1].cursor = cursor;
+		add(&g.a, WT_BATCH_INSERT, 4);
+		apply(WT_DUPLICATE_KEY, 1);
+		check_all();
+	}
+
+	if ((ret = cursor->close(cursor)) != 0)
+		die(ret, "cursor.close");
+}
+
+/*
+ * recover --
+ *	Copy the database without closing it, as if the application crashed,
+ *	and check the batches are recovered.
+ */
+void
+recover(void)
+{
+	TABLE *t;
+	int i, ret;
+
+	if ((ret = system("mkdir " HOME_RESTART " && "
+	    "cp " HOME "/* " HOME_RESTART)) != 0)
+		die(ret, "system copy call failed");
+	if ((ret = g.conn->close(g.conn, NULL)) != 0)
+		die(ret, "connection.close");
+
+	if ((ret = wiredtiger_open(HOME_RESTART, NULL,
+	    "log=(enabled),statistics=(fast)", &g.conn)) != 0)
+		die(ret, "wiredtiger_open");
+	if ((ret = g.conn->open_session(
+	    g.conn, NULL, NULL, &g.session)) != 0)
+		die(ret, "connection.open_session");
+	for (i = 0; i < 3; ++i) {
+		t = i == 0 ? &g.a : (i == 1 ? &g.b : &g.c);
+		if ((ret = g.session->open_cursor(
+		    g.session, t->uri, NULL, "raw", &t->cursor)) != 0)
+			die(ret, "session.open_cursor: %s", t->uri);
+	}
+	check_all();
+	if ((ret = g.conn->close(g.conn, NULL)) != 0)
+		die(ret, "connection.close");
+}
+
+/*
+ * reset --
+ *	Start a new batch.
+ */
+void
+reset(void)
+{
+	u_int i;
+
+	for (i = 0; i < g.nops; ++i) {
+		free((void *)g.ops[i].key.data);
+		free((void *)g.ops[i].value.data);
+	}
+	memset(g.ops, 0, g.nops * sizeof(WT_BATCH_OP));
+	g.nops = 0;
+	++g.gen;
+}
+
+/*
+ * add --
+ *	Add an operation to the batch.
+ */
+void
+add(TABLE *t, WT_BATCH_OPTYPE type, u_int key)
+{
+	WT_BATCH_OP *op;
+	size_t size;
+	int ret;
+	char *p;
+
+	op = &g.ops[g.nops++];
+	op->cursor = t->cursor;
+	op->type = type;
+
+	if ((p = malloc(20)) == NULL)
+		die(errno, "malloc");
+	if (t->colstore) {
+		if ((ret = wiredtiger_struct_size(
+		    g.session, &size, "r", (uint64_t)key)) != 0 ||
+		    (ret = wiredtiger_struct_pack(
+		    g.session, p, size, "r", (uint64_t)key)) != 0)
+			die(ret, "wiredtiger_struct_pack");
+	} else
+		size = (size_t)snprintf(p, 20, "%010u", key) + 1;
+	op->key.data = p;
+	op->key.size = size;
+
+	if (type != WT_BATCH_REMOVE) {
+		if ((p = malloc(t->value_len)) == NULL)
+			die(errno, "malloc");
+		value(t, key, g.gen, p);
+		op->value.data = p;
+		op->value.size = t->value_len;
+	}
+}
+
+/*
+ * apply --
+ *	Apply the batch, checking for an expected error, and update the model
+ *	if the batch commits.
+ */
+void
+apply(int expect, int explicit)
+{
+	TABLE *t;
+	WT_BATCH_OP *op;
+	uint64_t recno;
+	u_int i, key;
+	int ret;
+
+	if (explicit && (ret =
+	    g.session->begin_transaction(g.session, NULL)) != 0)
+		die(ret, "session.begin_transaction");
+	if ((ret = g.session->write_batch(
+	    g.session, g.ops, g.nops, NULL)) != expect)
+		die(ret, "session.write_batch: expected %d", expect);
+	if (explicit) {
+		/* After a failed batch, a commit rolls back. */
+		ret = g.session->commit_transaction(g.session, NULL);
+		if ((ret == 0) != (expect == 0))
+			die(ret, "session.commit_transaction");
+	}
+	if (expect != 0)
+		return;
+
+	for (i = 0, op = g.ops; i < g.nops; ++i, ++op) {
+		t = op->cursor == g.a.cursor ? &g.a :
+		    (op->cursor == g.b.cursor ? &g.b : &g.c);
+		if (t->colstore) {
+			if ((ret = wiredtiger_struct_unpack(g.session,
+			    op->key.data, op->key.size, "r", &recno)) != 0)
+				die(ret, "wiredtiger_struct_unpack");
+			key = (u_int)recno;
+		} else
+			key = (u_int)strtoul(
+			    (const char *)op->key.data, NULL, 10);
+		t->model[key] = op->type == WT_BATCH_REMOVE ? 0 : g.gen;
+	}
+}
+
+/*
+ * shuffle --
+ *	Shuffle the batch.
+ */
+void
+shuffle(void)
+{
+	WT_BATCH_OP tmp;
+	u_int i, j;
+
+	for (i = g.nops; i > 1; --i) {
+		j = (u_int)rand() % i;
+		tmp = g.ops[i - 1];
+		g.ops[i - 1] = g.ops[j];
+		g.ops[j] = tmp;
+	}
+}
+
+/*
+ * value --
+ *	Return the value of a key in a generation.
+ */
+void
+value(TABLE *t, u_int key, u_int gen, char *p)
+{
+	size_t len;
+
+	len = (size_t)snprintf(p, t->value_len, "%u.%u.", key, gen);
+	memset(p + len, 'v', t->value_len - len - 1);
+	p[t->value_len - 1] = '\0';
+}
+
+/*
+ * check_all --
+ *	Check the contents of all tables.
+ */
+void
+check_all(void)
+{
+	check(&g.a);
+	check(&g.b);
+	check(&g.c);
+}
+
+/*
+ * check --
+ *	Read a table back, and check its contents match the model.
+ */
+void
+check(TABLE *t)
+{
+	WT_CURSOR *cursor;
+	WT_ITEM k, v;
+	uint64_t recno;
+	u_int key, next;
+	int ret;
+	char buf[128];
+
+	if ((ret = g.session->open_cursor(
+	    g.session, t->uri, NULL, "raw", &cursor)) != 0)
+		die(ret, "session.open_cursor: %s", t->uri);
+	for (next = 0; (ret = cursor->next(cursor)) == 0; ++next) {
+		if ((ret = cursor->get_key(cursor, &k)) != 0 ||
+		    (ret = cursor->get_value(cursor, &v)) != 0)
+			die(ret, "cursor.get");
+		if (t->colstore) {
+			if ((ret = wiredtiger_struct_unpack(
+			    g.session, k.data, k.size, "r", &recno)) != 0)
+				die(ret, "wiredtiger_struct_unpack");
+			key = (u_int)recno;
+		} else
+			key = (u_int)strtoul((const char *)k.data, NULL, 10);
+
+		/* Every key before this one must be absent. */
+		for (; next < key; ++next)
+			if (t->model[next] != 0)
+				die(0, "%s: key %u missing", t->uri, next);
+		if (t->model[key] == 0)
+			die(0, "%s: key %u unexpected", t->uri, key);
+		value(t, key, t->model[key], buf);
+		if (v.size != t->value_len || memcmp(v.data, buf, v.size) != 0)
+			die(0, "%s: key %u: unexpected value", t->uri, key);
+	}
+	if (ret != WT_NOTFOUND)
+		die(ret, "cursor.next");
+	for (; next <= KEY_MAX; ++next)
+		if (t->model[next] != 0)
+			die(0, "%s: key %u missing", t->uri, next);
+	if ((ret = cursor->close(cursor)) != 0)
+		die(ret, "cursor.close");
+}
+
+/*
+ * stat_value --
+ *	Return a connection statistic.
+ */
+int64_t
+stat_value(int field)
+{
+	WT_CURSOR *cursor;
+	int64_t v;
+	int ret;
+	const char *desc, *pvalue;
+
+	if ((ret = g.session->open_cursor(
+	    g.session, "statistics:", NULL, NULL, &cursor)) != 0)
+		die(ret, "session.open_cursor: statistics");
+	cursor->set_key(cursor, field);
+	if ((ret = cursor->search(cursor)) != 0 ||
+	    (ret = cursor->get_value(cursor, &desc, &pvalue, &v)) != 0)
+		die(ret, "statistics cursor");
+	if ((ret = cursor->close(cursor)) != 0)
+		die(ret, "cursor.close");
+	return (v);
+}
+
+/*
+ * die --
+ *	Report an error and quit.
+ */
+void
+die(int e, const char *fmt, ...)
+{
+	va_list ap;
+
+	if (fmt != NULL) {				/* Death message. */
+		fprintf(stderr, "%s: ", g.progname);
+		va_start(ap, fmt);
+		vfprintf(stderr, fmt, ap);
+		va_end(ap);
+		if (e != 0)
+			fprintf(stderr, ": %s", wiredtiger_strerror(e));
+		fprintf(stderr, "\n");
+	}
+
+	exit(EXIT_FAILURE);
+}
+
+/*
+ * usage --
+ *	Display usage statement and exit failure.
+ */
+void
+usage(void)
+{
+	fprintf(stderr, "usage: %s [-s seed]\n", g.progname);
+	fprintf(stderr, "%s",
+	    "\t-s random seed for run\n");
+
+	exit(EXIT_FAILURE);
+}
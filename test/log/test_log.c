@@ -0,0 +1,385 @@
+/*-
+ * Public Domain 2014-2015 MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "wt_internal.h"
+
+#include <dlfcn.h>
+
+/*
+ * Test the log writer and flush threads handle I/O errors: once a write or
+ * sync of the log fails, committing threads return an error rather than
+ * waiting for the log forever, and the transactions committed before the
+ * failure are recovered.
+ *
+ * Failures are injected by replacing the system's write and sync calls, the
+ * library calls ours rather than the system's.
+ */
+static struct {
+	char *progname;				/* Program name */
+
+	volatile int fail_sync;			/* Inject sync failures */
+	volatile int fail_write;		/* Inject write failures */
+
+	u_int c_keys;				/* Keys committed first */
+	u_int c_ops;				/* Operations per thread */
+	u_int c_threads;			/* Threads committing */
+
+	WT_CONNECTION *conn;			/* WT_CONNECTION handle */
+	u_int failed;				/* Commits that failed */
+} g;
+
+#define	URI	"table:test_log"
+
+void check(void);
+void die(int e, const char *fmt, ...);
+void *ops(void *);
+void run(const char *, volatile int *);
+void usage(void);
+
+extern char *__wt_optarg;
+extern int __wt_optind;
+
+/*
+ * pwrite --
+ *	Write, unless failing writes.
+ */
+ssize_t
+pwrite(int fd, const void *buf, size_t nbytes, wt_off_t offset)
+{
+	static ssize_t (*sys_pwrite)(int, const void *, size_t, wt_off_t);
+
+	if (g.fail_write) {
+		errno = EIO;
+		return (-1);
+	}
+	if (sys_pwrite == NULL &&
+	    (sys_pwrite = dlsym(RTLD_NEXT, "pwrite")) == NULL)
+		die(0, "dlsym: pwrite");
+	return (sys_pwrite(fd, buf, nbytes, offset));
+}
+
+/*
+ * fsync --
+ *	Sync, unless failing syncs.
+ */
+int
+fsync(int fd)
+{
+	static int (*sys_fsync)(int);
+
+	if (g.fail_sync) {
+		errno = EIO;
+		return (-1);
+	}
+	if (sys_fsync == NULL &&
+	    (sys_fsync = dlsym(RTLD_NEXT, "fsync")) == NULL)
+		die(0, "dlsym: fsync");
+	return (sys_fsync(fd));
+}
+
+#ifdef HAVE_FDATASYNC
+/*
+ * fdatasync --
+ *	Sync, unless failing syncs.
+ */
+int
+fdatasync(int fd)
+{
+	static int (*sys_fdatasync)(int);
+
+	if (g.fail_sync) {
+		errno = EIO;
+		return (-1);
+	}
+	if (sys_fdatasync == NULL &&
+	    (sys_fdatasync = dlsym(RTLD_NEXT, "fdatasync")) == NULL)
+		die(0, "dlsym: fdatasync");
+	return (sys_fdatasync(fd));
+}
+#endif
+
+/*
+ * handle_error --
+ *	Discard the library's error messages, failures are expected.
+ */
+static int
+handle_error(WT_EVENT_HANDLER *handler,
+    WT_SESSION *session, int error, const char *message)
+{
+	(void)handler;
+	(void)session;
+	(void)error;
+	(void)message;
+	return (0);
+}
+
+static WT_EVENT_HANDLER event_handler = {
+	handle_error,
+	NULL,	/* Message handler */
+	NULL,	/* Progress handler */
+	NULL	/* Close handler */
+};
+
+int
+main(int argc, char *argv[])
+{
+	int ch;
+
+	if ((g.progname = strrchr(argv[0], '/')) == NULL)
+		g.progname = argv[0];
+	else
+		++g.progname;
+
+	/* Set default configuration values. */
+	g.c_keys = 1000;
+	g.c_ops = 100;
+	g.c_threads = 4;
+
+	/* Set values from the command line. */
+	while ((ch = __wt_getopt(g.progname, argc, argv, "k:o:t:")) != EOF)
+		switch (ch) {
+		case 'k':			/* Keys committed first */
+			g.c_keys = (u_int)atoi(__wt_optarg);
+			break;
+		case 'o':			/* Operations per thread */
+			g.c_ops = (u_int)atoi(__wt_optarg);
+			break;
+		case 't':			/* Threads */
+			g.c_threads = (u_int)atoi(__wt_optarg);
+			break;
+		default:
+			usage();
+		}
+
+	argc -= __wt_optind;
+	if (argc != 0)
+		usage();
+
+	/* A thread waiting for the log forever fails the test. */
+	(void)alarm(300);
+
+	run("write", &g.fail_write);
+	run("sync", &g.fail_sync);
+
+	return (EXIT_SUCCESS);
+}
+
+/*
+ * run --
+ *	Commit transactions, then inject a failure while threads commit.
+ */
+void
+run(const char *name, volatile int *failp)
+{
+	WT_CURSOR *cursor;
+	WT_SESSION *session;
+	pthread_t *tids;
+	uintptr_t i;
+	int ret;
+
+	printf("%s: %s failure\n", g.progname, name);
+
+	if ((ret = system("rm -rf WiredTiger* test_log.wt")) != 0)
+		die(ret, "system cleanup call failed");
+	if ((ret = wiredtiger_open(NULL, &event_handler,
+	    "create,log=(enabled),transaction_sync=(enabled,method=fsync)",
+	    &g.conn)) != 0)
+		die(ret, "wiredtiger_open");
+	if ((ret = g.conn->open_session(g.conn, NULL, NULL, &session)) != 0)
+		die(ret, "connection.open_session");
+	if ((ret = session->create(
+	    session, URI, "key_format=Q,value_format=Q")) != 0)
+		die(ret, "session.create");
+	if ((ret = session->checkpoint(session, NULL)) != 0)
+		die(ret, "session.checkpoint");
+
+	/* Commit records, each synced to the log. */
+	if ((ret = session->open_cursor(
+	    session, URI, NULL, NULL, &cursor)) != 0)
+		die(ret, "session.open_cursor");
+	for (i = 0; i < g.c_keys; ++i) {
+		cursor->set_key(cursor, (uint64_t)i);
+		cursor->set_value(cursor, (uint64_t)i);
+		if ((ret = cursor->insert(cursor)) != 0)
+			die(ret, "cursor.insert");
+	}
+	if ((ret = cursor->close(cursor)) != 0)
+		die(ret, "cursor.close");
+
+	/*
+	 * Fail every write or sync, then commit from several threads: each
+	 * commit must fail, none must wait forever.
+	 */
+	*failp = 1;
+	g.failed = 0;
+	if ((tids = calloc(g.c_threads, sizeof(*tids))) == NULL)
+		die(errno, "calloc");
+	for (i = 0; i < g.c_threads; ++i)
+		if ((ret = pthread_create(
+		    &tids[i], NULL, ops, (void *)i)) != 0)
+			die(ret, "pthread_create");
+	for (i = 0; i < g.c_threads; ++i)
+		if ((ret = pthread_join(tids[i], NULL)) != 0)
+			die(ret, "pthread_join");
+	free(tids);
+	if (g.failed != g.c_threads * g.c_ops)
+		die(0, "%u of %u commits failed",
+		    g.failed, g.c_threads * g.c_ops);
+
+	/* Nothing more is logged, even without a sync. */
+	if ((ret = session->open_cursor(
+	    session, URI, NULL, NULL, &cursor)) != 0)
+		die(ret, "session.open_cursor");
+	if ((ret = session->begin_transaction(session, "sync=false")) != 0)
+		die(ret, "session.begin_transaction");
+	cursor->set_key(cursor, (uint64_t)g.c_keys);
+	cursor->set_value(cursor, (uint64_t)g.c_keys);
+	if ((ret = cursor->insert(cursor)) != 0)
+		die(ret, "cursor.insert");
+	if ((ret = session->commit_transaction(session, NULL)) == 0)
+		die(0, "commit succeeded after a failure");
+
+	/*
+	 * Close the connection, which fails, the log can't be written.  The
+	 * records committed before the failure are recovered when the database
+	 * is opened.
+	 */
+	*failp = 0;
+	(void)g.conn->close(g.conn, NULL);
+	check();
+}
+
+/*
+ * ops --
+ *	Commit transactions, counting the failures.
+ */
+void *
+ops(void *arg)
+{
+	WT_CURSOR *cursor;
+	WT_SESSION *session;
+	uint64_t key;
+	u_int i;
+	int ret;
+
+	if ((ret = g.conn->open_session(g.conn, NULL, NULL, &session)) != 0)
+		die(ret, "connection.open_session");
+	if ((ret = session->open_cursor(
+	    session, URI, NULL, NULL, &cursor)) != 0)
+		die(ret, "session.open_cursor");
+	for (i = 0; i < g.c_ops; ++i) {
+		if ((ret = session->begin_transaction(session, NULL)) != 0)
+			die(ret, "session.begin_transaction");
+		key = g.c_keys + 1 + (uintptr_t)arg * g.c_ops + i;
+		cursor->set_key(cursor, key);
+		cursor->set_value(cursor, key);
+		if ((ret = cursor->insert(cursor)) != 0)
+			die(ret, "cursor.insert");
+		if (session->commit_transaction(session, NULL) != 0)
+			(void)WT_ATOMIC_ADD4(g.failed, 1);
+	}
+	if ((ret = session->close(session, NULL)) != 0)
+		die(ret, "session.close");
+	return (NULL);
+}
+
+/*
+ * check --
+ *	Open the database, and check the records committed before the failure
+ *	were recovered.  Records whose commit failed may be recovered too, if
+ *	they were written before a sync failed.
+ */
+void
+check(void)
+{
+	WT_CONNECTION *conn;
+	WT_CURSOR *cursor;
+	WT_SESSION *session;
+	uint64_t value;
+	u_int i;
+	int ret;
+
+	if ((ret = wiredtiger_open(
+	    NULL, NULL, "log=(enabled)", &conn)) != 0)
+		die(ret, "wiredtiger_open");
+	if ((ret = conn->open_session(conn, NULL, NULL, &session)) != 0)
+		die(ret, "connection.open_session");
+	if ((ret = session->open_cursor(
+	    session, URI, NULL, NULL, &cursor)) != 0)
+		die(ret, "session.open_cursor");
+	for (i = 0; i < g.c_keys; ++i) {
+		cursor->set_key(cursor, (uint64_t)i);
+		if ((ret = cursor->search(cursor)) != 0)
+			die(ret, "cursor.search: %u", i);
+		if ((ret = cursor->get_value(cursor, &value)) != 0)
+			die(ret, "cursor.get_value");
+		if (value != i)
+			die(0,
+			    "record %u: unexpected value %" PRIu64, i, value);
+	}
+	if ((ret = conn->close(conn, NULL)) != 0)
+		die(ret, "connection.close");
+}
+
+/*
+ * die --
+ *	Report an error and quit.
+ */
+void
+die(int e, const char *fmt, ...)
+{
+	va_list ap;
+
+	if (fmt != NULL) {				/* Death message. */
+		fprintf(stderr, "%s: ", g.progname);
+		va_start(ap, fmt);
+		vfprintf(stderr, fmt, ap);
+		va_end(ap);
+		if (e != 0)
+			fprintf(stderr, ": %s", wiredtiger_strerror(e));
+		fprintf(stderr, "\n");
+	}
+
+	exit(EXIT_FAILURE);
+}
+
+/*
+ * usage --
+ *	Display usage statement and exit failure.
+ */
+void
+usage(void)
+{
+	fprintf(stderr, "usage: %s [-kot]\n", g.progname);
+	fprintf(stderr, "%s",
+	    "\t-k number of keys committed before the failure\n"
+	    "\t-o number of operations per thread\n"
+	    "\t-t number of threads\n");
+
+	exit(EXIT_FAILURE);
+}
@@ -0,0 +1,80 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+#
+# test_bcache01.py
+#    Block cache: pages evicted from the cache are read back from memory
+#
+
+import wiredtiger, wttest
+from helper import simple_populate, simple_populate_check
+from wiredtiger import stat
+from wtscenario import check_scenarios
+
+class test_bcache01(wttest.WiredTigerTestCase):
+    nentries = 50000
+
+    scenarios = check_scenarios([
+        ('file', dict(uri='file:test_bcache01')),
+        ('table', dict(uri='table:test_bcache01'))
+    ])
+
+    # Override WiredTigerTestCase, we need statistics and a cache too small
+    # for the object, with a block cache that can hold all of it.
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir,
+            'create,cache_size=1MB,block_cache_size=20MB,' +
+            'statistics=(fast),error_prefix="%s: "' % self.shortid())
+        return conn
+
+    # Read the object more than once: pages evicted during the first pass
+    # are read back from the block cache during the second.
+    def test_bcache01_read(self):
+        simple_populate(self, self.uri,
+            'leaf_page_max=4KB,key_format=S', self.nentries)
+        self.reopen_conn()
+        simple_populate_check(self, self.uri, self.nentries)
+        simple_populate_check(self, self.uri, self.nentries)
+        self.assertGreater(self.get_stat(stat.conn.block_cache_hit), 0)
+        self.assertGreater(self.get_stat(stat.conn.block_cache_bytes), 0)
+
+    # Shrinking the block cache to nothing discards the block images, the
+    # object's contents are unchanged.
+    def test_bcache01_reconfigure(self):
+        simple_populate(self, self.uri,
+            'leaf_page_max=4KB,key_format=S', self.nentries)
+        self.reopen_conn()
+        simple_populate_check(self, self.uri, self.nentries)
+        self.conn.reconfigure('block_cache_size=0')
+        self.assertEqual(self.get_stat(stat.conn.block_cache_bytes), 0)
+        simple_populate_check(self, self.uri, self.nentries)
+        self.conn.reconfigure('block_cache_size=10MB')
+        simple_populate_check(self, self.uri, self.nentries)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,97 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+#
+# test_bcache01.py
+# test_cache_priority01.py
+#    Cache priorities and resident limits: an object limited to part of the
+# cache has pages evicted even when the cache is not full
+#
+
+import time
+import wiredtiger, wttest
+from helper import simple_populate, simple_populate_check
+from wiredtiger import stat
+from wtscenario import check_scenarios
+
+class test_cache_priority01(wttest.WiredTigerTestCase):
+    nentries = 100000
+    limit = 2 * 1024 * 1024
+
+    scenarios = check_scenarios([
+        ('file', dict(uri='file:test_cache_priority01')),
+        ('table', dict(uri='table:test_cache_priority01'))
+    ])
+
+    # Override WiredTigerTestCase, we need statistics and a cache large
+    # enough to hold the whole object.
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir,
+            'create,cache_size=200MB,statistics=(fast),' +
+            'error_prefix="%s: "' % self.shortid())
+        return conn
+
+    # Read the limited object into the cache: its pages are evicted to keep
+    # it near its limit, and its contents are unchanged.
+    def test_cache_priority01_limit(self):
+        simple_populate(self, self.uri, 'leaf_page_max=4KB,key_format=S,' +
+            'cache_priority=-20,cache_resident_max=%d' % self.limit,
+            self.nentries)
+        self.reopen_conn()
+        simple_populate_check(self, self.uri, self.nentries)
+
+        # Eviction is done by the eviction server, give it a chance to run.
+        for i in range(0, 50):
+            inuse = self.get_stat(stat.dsrc.cache_bytes_inuse, self.uri)
+            if inuse <= self.limit:
+                break
+            time.sleep(0.1)
+        self.assertLessEqual(inuse, self.limit)
+        self.assertGreater(self.get_stat(stat.conn.cache_eviction_quota), 0)
+        simple_populate_check(self, self.uri, self.nentries)
+
+    # Without a limit, the object stays in the cache.
+    def test_cache_priority01_nolimit(self):
+        simple_populate(self, self.uri,
+            'leaf_page_max=4KB,key_format=S,cache_priority=20', self.nentries)
+        self.reopen_conn()
+        simple_populate_check(self, self.uri, self.nentries)
+        self.assertGreater(
+            self.get_stat(stat.dsrc.cache_bytes_inuse, self.uri), self.limit)
+        self.assertEqual(self.get_stat(stat.conn.cache_eviction_quota), 0)
+
+    # Priorities and limits outside their ranges are errors.
+    def test_cache_priority01_config(self):
+        for config in ['cache_priority=101', 'cache_priority=-101',
+          'cache_resident_max=-1']:
+            self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+                lambda: self.session.create(self.uri + 'x', config),
+                '/Value too/')
+
+if __name__ == '__main__':
+    wttest.run()
@@ -151,6 +151,23 @@ class test_config04(wttest.WiredTigerTestCase):
                                        'eviction_trigger=86'),
             "/eviction target must be lower than the eviction trigger/")
 
+    def test_eviction_dirty(self):
+        self.common_test('eviction_dirty_target=40,eviction_dirty_trigger=60')
+
+    def test_eviction_dirty_bad(self):
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError, lambda:
+            wiredtiger.wiredtiger_open('.', 'create,' +
+            'eviction_dirty_target=70,eviction_dirty_trigger=60'),
+            "/eviction dirty target must be lower than the eviction dirty " +
+            "trigger/")
+
+    def test_eviction_writeback(self):
+        self.common_test('eviction=(writeback_threads=4)')
+
+    def test_eviction_budget(self):
+        self.common_test(
+            'eviction=(app_pages_max=5,app_wait_max=1000,write_throttle=true)')
+
     def test_hazard_max(self):
         # Note: There isn't any direct way to know that this was set.
         self.common_test('hazard_max=50')
@@ -161,6 +178,17 @@ class test_config04(wttest.WiredTigerTestCase):
         # this indirectly.
         self.common_test('session_max=99')
 
+    def test_numa(self):
+        self.common_test('numa=(enabled=true)')
+
+    def test_numa_nodes(self):
+        # Partition the cache between more nodes than the system has, the
+        # statistics track the most used node's share of the cache.
+        self.common_test('eviction=(threads_max=4),numa=(enabled=true,nodes=4)')
+        cursor = self.session.open_cursor('statistics:', None, None)
+        self.assertGreater(cursor[stat.conn.cache_bytes_numa_max][2], 0)
+        cursor.close()
+
     def test_multiprocess(self):
         self.common_test('multiprocess')
         # TODO: how do we verify that it was set?
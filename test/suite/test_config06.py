@@ -0,0 +1,85 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_config06.py
+#    Defaults of configuration keys missing from an application's
+#    configuration string
+#
+
+import wiredtiger, wttest
+from wiredtiger import stat
+
+class test_config06(wttest.WiredTigerTestCase):
+    uri = 'table:test_config06'
+
+    # Override WiredTigerTestCase, we need logging and statistics.
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir, 'create,' +
+            'log=(enabled),statistics=(fast),' +
+            'transaction_sync=(enabled,method=fsync),' +
+            'error_prefix="%s: "' % self.shortid())
+        return conn
+
+    # Metadata cursors are readonly unless configured otherwise, whatever
+    # else the configuration string holds.
+    def test_metadata_readonly(self):
+        for config in (None, 'overwrite=true'):
+            cursor = self.session.open_cursor('metadata:', None, config)
+            cursor.set_key('metadata:test_config06')
+            cursor.set_value('')
+            self.assertRaises(wiredtiger.WiredTigerError,
+                lambda: cursor.insert())
+            cursor.close()
+
+    def commit_syncs(self, config):
+        stat_cursor = self.session.open_cursor('statistics:', None, None)
+        syncs = stat_cursor[stat.conn.log_sync][2]
+        stat_cursor.close()
+
+        cursor = self.session.open_cursor(self.uri, None)
+        self.session.begin_transaction(config)
+        cursor['key'] = 'value'
+        self.session.commit_transaction()
+        cursor.close()
+
+        stat_cursor = self.session.open_cursor('statistics:', None, None)
+        syncs = stat_cursor[stat.conn.log_sync][2] - syncs
+        stat_cursor.close()
+        return syncs
+
+    # Transactions inherit the connection's transaction_sync setting unless
+    # their configuration string sets sync.
+    def test_transaction_sync(self):
+        self.session.create(self.uri, 'key_format=S,value_format=S')
+        self.assertGreater(self.commit_syncs(None), 0)
+        self.assertGreater(self.commit_syncs('isolation=snapshot'), 0)
+        self.assertGreater(self.commit_syncs('sync=true'), 0)
+        self.assertEqual(self.commit_syncs('sync=false'), 0)
+
+if __name__ == '__main__':
+    wttest.run()
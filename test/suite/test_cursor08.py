@@ -0,0 +1,130 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_cursor08.py
+#    Read-once cursors and eviction policies
+#
+
+import wiredtiger, wttest
+from helper import simple_populate, simple_populate_check_cursor
+from helper import key_populate, value_populate
+from wiredtiger import stat
+from wtscenario import check_scenarios, multiply_scenarios
+
+class test_cursor08(wttest.WiredTigerTestCase):
+    nentries = 1000
+
+    types = [
+        ('file', dict(uri='file:test_cursor08')),
+        ('table', dict(uri='table:test_cursor08'))
+    ]
+    policies = [
+        ('lru', dict(policy='lru')),
+        ('clock', dict(policy='clock')),
+        ('2q', dict(policy='2q'))
+    ]
+    scenarios = check_scenarios(multiply_scenarios('.', types, policies))
+
+    # Override WiredTigerTestCase, we need statistics and an eviction policy.
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir,
+            'create,statistics=(fast),eviction=(policy=%s),' % self.policy +
+            'error_prefix="%s: "' % self.shortid())
+        return conn
+
+    # Populate an object and reopen the connection so its pages have to be
+    # read from disk again.
+    def populate(self):
+        simple_populate(self, self.uri,
+            'leaf_page_max=512,key_format=S', self.nentries)
+        self.reopen_conn()
+
+    # Scan forward and backward with a read-once cursor, the results are the
+    # same as any other cursor, and the pages read are marked.
+    def test_cursor08_scan(self):
+        self.populate()
+        cursor = self.session.open_cursor(self.uri, None, 'read_once=true')
+        simple_populate_check_cursor(self, cursor, self.nentries)
+        self.assertGreater(self.get_stat(stat.conn.cache_read_once), 0)
+
+        cursor.reset()
+        i = self.nentries
+        while cursor.prev() == 0:
+            self.assertEqual(cursor.get_key(), key_populate(cursor, i))
+            self.assertEqual(cursor.get_value(), value_populate(cursor, i))
+            i -= 1
+        self.assertEqual(i, 0)
+        cursor.close()
+
+    # Search with a read-once cursor, then update the object through it.
+    def test_cursor08_search(self):
+        self.populate()
+        cursor = self.session.open_cursor(self.uri, None, 'read_once=true')
+        for i in range(1, self.nentries + 1, 37):
+            cursor.set_key(key_populate(cursor, i))
+            self.assertEqual(cursor.search(), 0)
+            self.assertEqual(cursor.get_value(), value_populate(cursor, i))
+        self.assertGreater(self.get_stat(stat.conn.cache_read_once), 0)
+
+        cursor.set_key(key_populate(cursor, 10))
+        cursor.set_value('updated')
+        cursor.update()
+        cursor.close()
+
+        cursor = self.session.open_cursor(self.uri, None, None)
+        cursor.set_key(key_populate(cursor, 10))
+        self.assertEqual(cursor.search(), 0)
+        self.assertEqual(cursor.get_value(), 'updated')
+        cursor.close()
+
+    # Pages already in the cache aren't marked by read-once cursors.
+    def test_cursor08_cached(self):
+        self.populate()
+        cursor = self.session.open_cursor(self.uri, None, None)
+        simple_populate_check_cursor(self, cursor, self.nentries)
+        cursor.close()
+
+        cursor = self.session.open_cursor(self.uri, None, 'read_once=true')
+        simple_populate_check_cursor(self, cursor, self.nentries)
+        cursor.close()
+        self.assertEqual(self.get_stat(stat.conn.cache_read_once), 0)
+
+    # The eviction policy can be changed after open.
+    def test_cursor08_reconfig(self):
+        self.populate()
+        for policy in ['lru', 'clock', '2q', 'lru']:
+            self.conn.reconfigure('eviction=(policy=%s)' % policy)
+            cursor = self.session.open_cursor(self.uri, None, None)
+            simple_populate_check_cursor(self, cursor, self.nentries)
+            cursor.close()
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.conn.reconfigure('eviction=(policy=mru)'),
+            '/Invalid argument/')
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,112 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_evict01.py
+#    Background write-back and throttling of dirty pages
+#
+
+import time
+import wiredtiger, wttest
+from helper import simple_populate, simple_populate_check
+from wiredtiger import stat
+from wtscenario import check_scenarios
+
+class test_evict01(wttest.WiredTigerTestCase):
+    nentries = 20000
+
+    scenarios = check_scenarios([
+        ('file', dict(uri='file:test_evict01')),
+        ('table', dict(uri='table:test_evict01'))
+    ])
+
+    # Override WiredTigerTestCase, we need statistics and write-back threads
+    # cleaning pages well before the cache is full.
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir,
+            'create,cache_size=10MB,statistics=(fast),' +
+            'eviction_dirty_target=10,eviction_dirty_trigger=50,' +
+            'eviction=(writeback_threads=2),' +
+            'error_prefix="%s: "' % self.shortid())
+        return conn
+
+    # Dirty more of the cache than the dirty target, the write-back threads
+    # write pages without changing the object's contents.
+    def test_evict01_writeback(self):
+        simple_populate(self, self.uri,
+            'leaf_page_max=4KB,key_format=S', self.nentries)
+        for i in range(100):
+            if self.get_stat(stat.conn.cache_writeback) > 0:
+                break
+            time.sleep(0.1)
+        self.assertGreater(self.get_stat(stat.conn.cache_writeback), 0)
+        simple_populate_check(self, self.uri, self.nentries)
+
+        # The object is unchanged after it has been written and reopened.
+        self.reopen_conn()
+        simple_populate_check(self, self.uri, self.nentries)
+
+    # Write with a reader's snapshot keeping eviction from cleaning the new
+    # updates, so the dirty bytes grow past the dirty target, and return the
+    # number of throttled writes.  Writes are slowed down, but none of them
+    # fail.
+    def throttle(self, throttle):
+        self.conn.reconfigure(
+            'eviction=(writeback_threads=0,app_wait_max=200,' +
+            'write_throttle=' + throttle + ')')
+        self.session.reconfigure('eviction_wait_max=100')
+        self.session.create(self.uri, 'key_format=S,value_format=S')
+
+        reader = self.conn.open_session()
+        reader.begin_transaction('isolation=snapshot')
+        reader_cursor = reader.open_cursor(self.uri, None)
+        reader_cursor.next()
+
+        value = 'abcdefghij' * 40
+        cursor = self.session.open_cursor(self.uri, None)
+        for i in range(1, 10001):
+            cursor['%015d' % i] = value
+        cursor.close()
+        reader.close()
+
+        cursor = self.session.open_cursor(self.uri, None)
+        self.assertEqual(len(list(cursor)), 10000)
+        cursor.close()
+        return self.get_stat(stat.conn.cache_write_throttle)
+
+    # Throttle writers with a tight eviction budget.
+    def test_evict01_throttle(self):
+        self.assertGreater(self.throttle('true'), 0)
+        self.assertGreater(
+            self.get_stat(stat.conn.cache_write_throttle_time), 0)
+
+    # Writers aren't throttled unless throttling is configured.
+    def test_evict01_nothrottle(self):
+        self.assertEqual(self.throttle('false'), 0)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,70 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_evict02.py
+#    Eviction of internal pages heading cold subtrees
+#
+
+import wiredtiger, wttest
+from helper import simple_populate, simple_populate_check
+from wiredtiger import stat
+from wtscenario import check_scenarios
+
+class test_evict02(wttest.WiredTigerTestCase):
+    nentries = 100000
+
+    scenarios = check_scenarios([
+        ('file', dict(uri='file:test_evict02')),
+        ('table', dict(uri='table:test_evict02'))
+    ])
+
+    # Override WiredTigerTestCase, we need statistics and a cache too small
+    # for the object's internal pages.
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir,
+            'create,cache_size=1MB,statistics=(fast),' +
+            'error_prefix="%s: "' % self.shortid())
+        return conn
+
+    # Read an object with more internal pages than fit in the cache: internal
+    # pages are evicted once their children are gone, the cache's count of
+    # internal page bytes tracks the evictions, and the object's contents
+    # are unchanged.
+    def test_evict02_internal(self):
+        simple_populate(self, self.uri, 'key_format=S,allocation_size=512,' +
+            'internal_page_max=512,leaf_page_max=512', self.nentries)
+        self.reopen_conn()
+        simple_populate_check(self, self.uri, self.nentries)
+        simple_populate_check(self, self.uri, self.nentries)
+        self.assertGreater(
+            self.get_stat(stat.conn.cache_eviction_internal), 0)
+        self.assertLessEqual(self.get_stat(stat.conn.cache_bytes_internal),
+            self.get_stat(stat.conn.cache_bytes_inuse))
+
+if __name__ == '__main__':
+    wttest.run()
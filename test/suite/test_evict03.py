@@ -0,0 +1,109 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_evict03.py
+#    Eviction walks of many files
+#
+
+import wiredtiger, wttest
+from wiredtiger import stat
+
+class test_evict03(wttest.WiredTigerTestCase):
+    ntables = 20
+    nentries = 2000
+
+    # Override WiredTigerTestCase, we need statistics, several eviction
+    # threads, and a cache holding about half the tables.
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir,
+            'create,cache_size=10MB,eviction=(threads_max=4),' +
+            'statistics=(fast),error_prefix="%s: "' % self.shortid())
+        return conn
+
+    def uri(self, i):
+        return 'table:test_evict03.' + str(i)
+
+    def value(self, i, j):
+        return str(i) + '.' + str(j) + ':' + 'abcdefghij' * 50
+
+    def populate(self, i):
+        uri = self.uri(i)
+        self.session.create(uri, 'key_format=i,value_format=S')
+        cursor = self.session.open_cursor(uri, None)
+        for j in range(self.nentries):
+            cursor[j] = self.value(i, j)
+        cursor.close()
+
+    def check(self, i):
+        cursor = self.session.open_cursor(self.uri(i), None)
+        j = 0
+        for key, value in cursor:
+            self.assertEqual(key, j)
+            self.assertEqual(value, self.value(i, j))
+            j += 1
+        self.assertEqual(j, self.nentries)
+        cursor.close()
+
+    # Fill and read back more tables than fit in the cache: eviction walks
+    # every file, and each file's statistics report its walks.
+    def test_evict03_walk_stats(self):
+        for i in range(self.ntables):
+            self.populate(i)
+        for i in range(self.ntables):
+            self.check(i)
+
+        walked = queued = 0
+        for i in range(self.ntables):
+            uri = self.uri(i)
+            self.assertGreater(
+                self.get_stat(stat.dsrc.cache_eviction_walk_passes, uri), 0)
+            walked += self.get_stat(stat.dsrc.cache_eviction_walk, uri)
+            queued += self.get_stat(stat.dsrc.cache_eviction_walk_queued, uri)
+        self.assertGreater(walked, 0)
+        self.assertGreater(queued, 0)
+        self.assertLessEqual(
+            walked, self.get_stat(stat.conn.cache_eviction_walk))
+
+    # Close and drop tables while eviction walks them: reading the tables
+    # keeps the cache full, verifying a table closes it, and dropped tables
+    # are replaced.  Every table's contents are unchanged after a restart.
+    def test_evict03_close_drop(self):
+        for i in range(self.ntables):
+            self.populate(i)
+        for r in range(3):
+            for i in range(0, self.ntables, 2):
+                self.check(i)
+                self.session.verify(self.uri(i), None)
+                self.session.drop(self.uri(i + 1), None)
+                self.populate(i + 1)
+        self.reopen_conn()
+        for i in range(self.ntables):
+            self.check(i)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,107 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_las01.py
+#    Eviction using the lookaside table when a long-running transaction
+#    pins old updates in the cache
+#
+
+import wiredtiger, wttest
+from wiredtiger import stat
+from wtscenario import check_scenarios
+
+class test_las01(wttest.WiredTigerTestCase):
+    nentries = 2000
+
+    scenarios = check_scenarios([
+        ('col', dict(uri='file:test_las01', key_format='r')),
+        ('row', dict(uri='file:test_las01', key_format='S'))
+    ])
+
+    # Override WiredTigerTestCase, we need statistics and a small cache.
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir,
+            'create,cache_size=6MB,statistics=(fast),' +
+            'error_prefix="%s: "' % self.shortid())
+        return conn
+
+    def key(self, i):
+        if self.key_format == 'r':
+            return i + 1
+        return 'key%06d' % i
+
+    # Values differ by key, so column-store records aren't run-length
+    # encoded into a single page.
+    def value(self, i, c):
+        return '%05d' % i + c * 495
+
+    def update(self, c):
+        cursor = self.session.open_cursor(self.uri, None)
+        for i in range(self.nentries):
+            if i % 100 == 0:
+                self.session.begin_transaction()
+            cursor[self.key(i)] = self.value(i, c)
+            if i % 100 == 99:
+                self.session.commit_transaction()
+        cursor.close()
+
+    def check(self, session, c):
+        cursor = session.open_cursor(self.uri, None)
+        for i in range(self.nentries):
+            self.assertEqual(cursor[self.key(i)], self.value(i, c))
+        cursor.close()
+
+    # Update every record more times than the cache can hold while a
+    # snapshot transaction is running: the pages are evicted using the
+    # lookaside table, and the snapshot still reads the old values.
+    def test_las01(self):
+        self.session.create(self.uri,
+            'key_format=' + self.key_format + ',value_format=S')
+        self.update('a')
+        self.reopen_conn()
+
+        session2 = self.conn.open_session()
+        session2.begin_transaction('isolation=snapshot')
+        self.check(session2, 'a')
+
+        for c in 'bcdefghi':
+            self.update(c)
+        self.check(self.session, 'i')
+        self.check(session2, 'a')
+        session2.commit_transaction()
+        session2.close()
+
+        self.assertGreater(
+            self.get_stat(stat.conn.cache_eviction_lookaside), 0)
+        self.assertGreater(
+            self.get_stat(stat.conn.cache_lookaside_insert), 0)
+        self.assertGreater(
+            self.get_stat(stat.conn.cache_read_lookaside), 0)
+
+if __name__ == '__main__':
+    wttest.run()
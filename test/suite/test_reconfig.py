@@ -109,6 +109,25 @@ class test_reconfig(wttest.WiredTigerTestCase):
         self.conn.reconfigure(
              "statistics_log=(wait=2,sources=[lsm:],timestamp=\"%b\")")
 
+    def test_reconfig_eviction_writeback(self):
+        self.conn.reconfigure("eviction=(writeback_threads=2)")
+        self.conn.reconfigure("eviction=(writeback_threads=4)")
+        self.conn.reconfigure("eviction_dirty_target=40")
+        self.conn.reconfigure("eviction=(writeback_threads=0)")
+
+    def test_reconfig_eviction_budget(self):
+        self.conn.reconfigure("eviction=(app_wait_max=1000)")
+        self.conn.reconfigure("eviction=(app_pages_max=2,write_throttle=true)")
+        self.conn.reconfigure("eviction=(app_wait_max=0,write_throttle=false)")
+        self.session.reconfigure("eviction_wait_max=500")
+        self.session.reconfigure("eviction_pages_max=1")
+        self.session.reconfigure("eviction_wait_max=0,eviction_pages_max=0")
+
+    def test_reconfig_block_cache(self):
+        self.conn.reconfigure("block_cache_size=10MB")
+        self.conn.reconfigure("block_cache_size=1MB")
+        self.conn.reconfigure("block_cache_size=0")
+
     def test_file_manager(self):
         self.conn.reconfigure("file_manager=(close_scan_interval=3)")
         self.conn.reconfigure("file_manager=(close_idle_time=4)")
@@ -0,0 +1,94 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_sweep03.py
+#    The sweep server discards obsolete updates from keys that are no longer
+#    being updated
+#
+
+import time
+import wiredtiger, wttest
+from wiredtiger import stat
+from wtscenario import check_scenarios
+
+class test_sweep03(wttest.WiredTigerTestCase):
+    nentries = 100
+    nupdates = 50
+
+    scenarios = check_scenarios([
+        ('col', dict(uri='file:test_sweep03', key_format='r')),
+        ('row', dict(uri='file:test_sweep03', key_format='S'))
+    ])
+
+    # Override WiredTigerTestCase, we need statistics and a frequent sweep.
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir,
+            'create,statistics=(fast),' +
+            'file_manager=(close_scan_interval=1),' +
+            'error_prefix="%s: "' % self.shortid())
+        return conn
+
+    def key(self, i):
+        if self.key_format == 'r':
+            return i + 1
+        return 'key%06d' % i
+
+    def test_sweep03(self):
+        self.session.create(self.uri,
+            'key_format=' + self.key_format + ',value_format=S')
+        cursor = self.session.open_cursor(self.uri, None)
+        for i in range(self.nentries):
+            cursor[self.key(i)] = 'value'
+
+        # A running transaction keeps every update while the keys are
+        # updated, then the keys are left alone.
+        session2 = self.conn.open_session()
+        session2.begin_transaction()
+        cursor2 = session2.open_cursor(self.uri, None)
+        self.assertEqual(cursor2[self.key(0)], 'value')
+        for u in range(self.nupdates):
+            for i in range(self.nentries):
+                cursor[self.key(i)] = 'value%d' % u
+        session2.rollback_transaction()
+
+        # Wait for the sweep server to discard the obsolete updates.
+        for i in range(10):
+            if self.get_stat(stat.conn.cache_obsolete_updates) > 0:
+                break
+            time.sleep(1)
+        self.assertGreater(self.get_stat(stat.conn.cache_obsolete_updates), 0)
+
+        # The newest updates are still read.
+        for i in range(self.nentries):
+            self.assertEqual(
+                cursor[self.key(i)], 'value%d' % (self.nupdates - 1))
+        self.assertGreater(self.get_stat(stat.conn.txn_read_chain), 0)
+        cursor.close()
+
+if __name__ == '__main__':
+    wttest.run()
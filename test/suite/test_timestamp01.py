@@ -0,0 +1,114 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_timestamp01.py
+#    Commit timestamps and reading as of a timestamp
+#
+
+import wiredtiger, wttest
+from wtscenario import check_scenarios
+
+class test_timestamp01(wttest.WiredTigerTestCase):
+    scenarios = check_scenarios([
+        ('file', dict(uri='file:test_timestamp01')),
+        ('table', dict(uri='table:test_timestamp01'))
+    ])
+
+    def commit_at(self, cursor, key, value, ts):
+        self.session.begin_transaction()
+        cursor[key] = value
+        self.session.commit_transaction('commit_timestamp=%d' % ts)
+
+    # Return the value of a key as of a timestamp, or None if not found.
+    def read_at(self, key, ts):
+        cursor = self.session.open_cursor(self.uri, None)
+        self.session.begin_transaction(
+            'isolation=snapshot,read_timestamp=%d' % ts)
+        cursor.set_key(key)
+        value = cursor.get_value() if cursor.search() == 0 else None
+        self.session.commit_transaction()
+        cursor.close()
+        return value
+
+    # Readers at a timestamp see the updates committed at or before it.
+    def test_timestamp01_read(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        cursor = self.session.open_cursor(self.uri, None)
+        self.commit_at(cursor, 1, 'value10', 10)
+        self.commit_at(cursor, 1, 'value20', 20)
+        self.commit_at(cursor, 2, 'value30', 30)
+        cursor[3] = 'untimestamped'
+
+        self.assertEqual(self.read_at(1, 5), None)
+        self.assertEqual(self.read_at(1, 15), 'value10')
+        self.assertEqual(self.read_at(2, 15), None)
+        self.assertEqual(self.read_at(1, 25), 'value20')
+        self.assertEqual(self.read_at(2, 25), None)
+        self.assertEqual(self.read_at(2, 30), 'value30')
+        self.assertEqual(self.read_at(3, 15), 'untimestamped')
+        self.assertEqual(cursor[1], 'value20')
+
+        # Moving the oldest timestamp keeps the versions readers at it need.
+        self.conn.set_timestamp('oldest_timestamp=15')
+        self.commit_at(cursor, 1, 'value40', 40)
+        self.assertEqual(self.read_at(1, 15), 'value10')
+        self.assertEqual(self.read_at(1, 25), 'value20')
+        self.assertEqual(self.read_at(1, 40), 'value40')
+        cursor.close()
+
+    # Timestamps older than the oldest timestamp are rejected.
+    def test_timestamp01_errors(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        cursor = self.session.open_cursor(self.uri, None)
+        self.conn.set_timestamp('oldest_timestamp=20')
+
+        msg = '/older than the oldest timestamp/'
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.begin_transaction(
+            'isolation=snapshot,read_timestamp=10'), msg)
+
+        msg = '/not newer than the oldest timestamp/'
+        self.session.begin_transaction()
+        cursor[1] = 'value'
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.commit_transaction('commit_timestamp=20'),
+            msg)
+        self.assertEqual(self.read_at(1, 30), None)
+
+        msg = '/requires snapshot isolation/'
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.begin_transaction(
+            'isolation=read-committed,read_timestamp=30'), msg)
+
+        msg = '/older than the current oldest timestamp/'
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.conn.set_timestamp('oldest_timestamp=10'), msg)
+        cursor.close()
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,101 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_txn11.py
+#    Transactions: read-only transactions
+#
+
+import wiredtiger, wttest
+from wiredtiger import stat
+from wtscenario import check_scenarios
+
+class test_txn11(wttest.WiredTigerTestCase):
+    scenarios = check_scenarios([
+        ('file', dict(uri='file:test_txn11')),
+        ('table', dict(uri='table:test_txn11'))
+    ])
+
+    # Override WiredTigerTestCase, we need statistics.
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir,
+            'create,statistics=(fast),' +
+            'error_prefix="%s: "' % self.shortid())
+        return conn
+
+    # Read-only snapshots see the same updates as other snapshots.
+    def test_txn11_snapshot(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        cursor = self.session.open_cursor(self.uri, None)
+        cursor[1] = 'value1'
+
+        # An update running when the read-only transaction begins, and an
+        # update committed after it begins, aren't visible.
+        session2 = self.conn.open_session()
+        cursor2 = session2.open_cursor(self.uri, None)
+        session2.begin_transaction()
+        cursor2[2] = 'value2'
+
+        self.session.begin_transaction('isolation=snapshot,read_only=true')
+        cursor.set_key(1)
+        self.assertEqual(cursor.search(), 0)
+        self.assertEqual(cursor.get_value(), 'value1')
+        session2.commit_transaction()
+        cursor.set_key(2)
+        self.assertEqual(cursor.search(), wiredtiger.WT_NOTFOUND)
+        self.session.commit_transaction()
+
+        self.session.begin_transaction('isolation=snapshot,read_only=true')
+        self.assertEqual(cursor[2], 'value2')
+        self.session.commit_transaction()
+        self.assertEqual(self.get_stat(stat.conn.txn_readonly), 2)
+        cursor.close()
+
+    # Updates in read-only transactions fail.
+    def test_txn11_update(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        cursor = self.session.open_cursor(self.uri, None)
+        cursor[1] = 'value1'
+
+        msg = '/read-only transactions cannot update data/'
+        self.session.begin_transaction('read_only=true')
+        cursor.set_key(1)
+        cursor.set_value('value2')
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: cursor.update(), msg)
+        self.session.rollback_transaction()
+        self.assertEqual(self.get_stat(stat.conn.txn_readonly_update), 1)
+
+        # Transactions that follow can update.
+        self.session.begin_transaction()
+        cursor[1] = 'value3'
+        self.session.commit_transaction()
+        self.assertEqual(cursor[1], 'value3')
+        cursor.close()
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,128 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_txn12.py
+#    Transactions: waiting on update conflicts
+#
+
+import wiredtiger, wttest
+from wiredtiger import stat
+from wtscenario import check_scenarios
+
+class test_txn12(wttest.WiredTigerTestCase):
+    scenarios = check_scenarios([
+        ('file', dict(uri='file:test_txn12')),
+        ('table', dict(uri='table:test_txn12'))
+    ])
+    rollback_msg = '/conflict between concurrent operations/'
+
+    # Override WiredTigerTestCase, we need statistics.
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir,
+            'create,statistics=(fast),' +
+            'error_prefix="%s: "' % self.shortid())
+        return conn
+
+    # Start a transaction in a second session holding an update to key 1.
+    def start_holder(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        cursor = self.session.open_cursor(self.uri, None)
+        cursor[1] = 'value1'
+        cursor.close()
+
+        session2 = self.conn.open_session()
+        cursor2 = session2.open_cursor(self.uri, None)
+        session2.begin_transaction('isolation=snapshot')
+        cursor2[1] = 'value2'
+        return session2, cursor2
+
+    # Update key 1 in a transaction that conflicts with the holder.
+    def update_conflict(self, config):
+        cursor = self.session.open_cursor(self.uri, None)
+        self.session.begin_transaction('isolation=snapshot,' + config)
+        cursor.set_key(1)
+        cursor.set_value('value3')
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: cursor.update(), self.rollback_msg)
+        self.session.rollback_transaction()
+        cursor.close()
+
+    # Without a timeout, conflicts fail immediately.
+    def test_txn12_no_wait(self):
+        session2, cursor2 = self.start_holder()
+        self.update_conflict('')
+        self.assertEqual(self.get_stat(stat.conn.txn_update_conflict), 1)
+        self.assertEqual(self.get_stat(stat.conn.txn_conflict_wait), 0)
+        session2.commit_transaction()
+
+    # A conflict with a running transaction waits for the timeout, the
+    # younger transaction doesn't ask the holder to roll back.
+    def test_txn12_timeout(self):
+        session2, cursor2 = self.start_holder()
+        self.update_conflict('conflict_timeout=100')
+        self.assertEqual(self.get_stat(stat.conn.txn_conflict_wait), 1)
+        self.assertEqual(
+            self.get_stat(stat.conn.txn_conflict_wait_timeout), 1)
+        self.assertGreaterEqual(
+            self.get_stat(stat.conn.txn_conflict_wait_time), 100000)
+        self.assertEqual(self.get_stat(stat.conn.txn_conflict_wound), 0)
+
+        # The holder is unaffected.
+        cursor2[2] = 'value2'
+        session2.commit_transaction()
+        self.assertEqual(cursor2[1], 'value2')
+
+    # A transaction with a higher priority asks the holder to roll back:
+    # the holder's next update fails.
+    def test_txn12_wound(self):
+        session2, cursor2 = self.start_holder()
+        self.update_conflict('conflict_timeout=10,priority=10')
+        self.assertEqual(self.get_stat(stat.conn.txn_conflict_wound), 1)
+
+        cursor2.set_key(2)
+        cursor2.set_value('value2')
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: cursor2.update(), self.rollback_msg)
+        session2.rollback_transaction()
+
+        # Once the holder rolls back, the update proceeds.
+        cursor = self.session.open_cursor(self.uri, None)
+        self.session.begin_transaction(
+            'isolation=snapshot,conflict_timeout=10')
+        cursor[1] = 'value3'
+        self.session.commit_transaction()
+        self.assertEqual(cursor[1], 'value3')
+
+        # The holder's session runs new transactions normally.
+        session2.begin_transaction()
+        cursor2[2] = 'value2'
+        session2.commit_transaction()
+        self.assertEqual(cursor2[2], 'value2')
+
+if __name__ == '__main__':
+    wttest.run()
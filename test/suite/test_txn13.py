@@ -0,0 +1,206 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_txn13.py
+#    Transactions: prepared transactions
+#
+
+import fnmatch, os, shutil, time
+import wiredtiger, wttest
+from wiredtiger import stat
+
+class test_txn13(wttest.WiredTigerTestCase):
+    uri = 'table:test_txn13'
+    conn_config = 'log=(enabled,file_max=100K),' + \
+        'transaction_sync=(enabled,method=dsync),statistics=(fast)'
+
+    # Override WiredTigerTestCase, we need logging and statistics.
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir, 'create,' +
+            self.conn_config + ',error_prefix="%s: "' % self.shortid())
+        return conn
+
+    def simulate_crash_restart(self, olddir, newdir):
+        ''' Simulate a crash from olddir and restart in newdir. '''
+        # with the connection still open, copy files to new directory
+        shutil.rmtree(newdir, ignore_errors=True)
+        os.mkdir(newdir)
+        for fname in os.listdir(olddir):
+            fullname = os.path.join(olddir, fname)
+            # Skip lock file on Windows since it is locked
+            if os.path.isfile(fullname) and "WiredTiger.lock" not in fullname:
+                shutil.copy(fullname, newdir)
+        # close the original connection and open to new directory
+        self.close_conn()
+        self.conn = self.setUpConnectionOpen(newdir)
+        self.session = self.setUpSessionOpen(self.conn)
+
+    # Update a key in a new session's transaction and prepare it.
+    def prepare(self, key, prepare_id):
+        session = self.conn.open_session()
+        cursor = session.open_cursor(self.uri, None)
+        session.begin_transaction()
+        cursor[key] = 'prepared'
+        session.prepare_transaction('prepare_id=%d' % prepare_id)
+        return session, cursor
+
+    def check(self, key, found):
+        cursor = self.session.open_cursor(self.uri, None)
+        cursor.set_key(key)
+        self.assertEqual(
+            cursor.search(), 0 if found else wiredtiger.WT_NOTFOUND)
+        cursor.close()
+
+    # Prepared updates are invisible until the transaction commits.
+    def test_prepare_commit(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        session, cursor = self.prepare(1, 1)
+        self.check(1, False)
+
+        # A prepared transaction can't update data.
+        cursor.set_key(2)
+        cursor.set_value('value')
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: cursor.update(), '/prepared transactions cannot update/')
+
+        session.commit_transaction()
+        self.check(1, True)
+        self.check(2, False)
+        self.assertEqual(self.get_stat(stat.conn.txn_prepare), 1)
+        self.assertEqual(self.get_stat(stat.conn.txn_prepare_commit), 1)
+
+    def test_prepare_rollback(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        session, cursor = self.prepare(1, 1)
+        session.rollback_transaction()
+        self.check(1, False)
+        self.assertEqual(self.get_stat(stat.conn.txn_prepare_rollback), 1)
+
+    # Prepared transactions must have unique identifiers.
+    def test_prepare_id(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        session, cursor = self.prepare(1, 1)
+
+        cursor = self.session.open_cursor(self.uri, None)
+        self.session.begin_transaction()
+        cursor[2] = 'value'
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.prepare_transaction('prepare_id=1'),
+            '/prepare_id 1 is already in use/')
+        self.session.rollback_transaction()
+
+        # The identifier is checked whether or not the transaction has
+        # updates.
+        self.session.begin_transaction()
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.prepare_transaction('prepare_id=1'),
+            '/prepare_id 1 is already in use/')
+        self.session.rollback_transaction()
+        session.commit_transaction()
+
+    # A prepared transaction without updates has no prepare record, and
+    # doesn't keep checkpoints from archiving the log.
+    def test_prepare_empty(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        session = self.conn.open_session()
+        session.begin_transaction()
+        session.prepare_transaction('prepare_id=1')
+
+        cursor = self.session.open_cursor(self.uri, None)
+        for i in range(1, 1000):
+            cursor[i] = 'value' * 100
+        cursor.close()
+        self.session.checkpoint()
+
+        # Sleep long enough so that the archive thread is guaranteed to run.
+        time.sleep(2.0)
+        logs = fnmatch.filter(os.listdir('.'), 'WiredTigerLog.*')
+        self.assertGreater(len(logs), 0)
+        self.assertFalse('WiredTigerLog.0000000001' in logs)
+        session.commit_transaction()
+
+    # Prepared transactions must survive a crash, which requires logging.
+    def test_prepare_nolog(self):
+        os.mkdir('NOLOG')
+        conn = wiredtiger.wiredtiger_open('NOLOG', 'create')
+        session = conn.open_session()
+        session.create(self.uri, 'key_format=i,value_format=S')
+        cursor = session.open_cursor(self.uri, None)
+        session.begin_transaction()
+        cursor[1] = 'value'
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: session.prepare_transaction('prepare_id=1'),
+            '/requires logging/')
+        session.rollback_transaction()
+        conn.close()
+
+    # Prepared transactions not resolved when the database crashes are
+    # recovered, and resolved by their identifiers.
+    def test_prepare_recover(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        session1, cursor1 = self.prepare(1, 1)
+        session2, cursor2 = self.prepare(2, 2)
+        session3, cursor3 = self.prepare(3, 3)
+        session3.commit_transaction()
+        session4, cursor4 = self.prepare(4, 4)
+        session4.rollback_transaction()
+
+        # Checkpoints don't discard the log of prepared transactions.
+        cursor = self.session.open_cursor(self.uri, None)
+        for i in range(10, 1000):
+            cursor[i] = 'value' * 100
+        cursor.close()
+        self.session.checkpoint()
+
+        self.simulate_crash_restart(".", "RESTART")
+        self.assertEqual(self.get_stat(stat.conn.txn_prepare_recover), 2)
+        self.check(1, False)
+        self.check(2, False)
+        self.check(3, True)
+        self.check(4, False)
+
+        self.session.commit_transaction('prepare_id=1')
+        self.session.rollback_transaction('prepare_id=2')
+        self.check(1, True)
+        self.check(2, False)
+        self.assertRaises(wiredtiger.WiredTigerError,
+            lambda: self.session.commit_transaction('prepare_id=3'))
+
+    # Prepared transactions are recovered after a clean shutdown.
+    def test_prepare_close(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        session1, cursor1 = self.prepare(1, 1)
+        self.reopen_conn()
+        self.check(1, False)
+        self.reopen_conn()
+        self.check(1, False)
+        self.session.commit_transaction('prepare_id=1')
+        self.check(1, True)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,77 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_txn14.py
+#    Transactions: recover a log record ending in zeros
+#
+
+import os, shutil
+import wiredtiger, wttest
+
+class test_txn14(wttest.WiredTigerTestCase):
+    uri = 'table:test_txn14'
+
+    # Override WiredTigerTestCase, we need logging.
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir, 'create,' +
+            'log=(enabled),transaction_sync=(enabled),' +
+            'error_prefix="%s: "' % self.shortid())
+        return conn
+
+    def simulate_crash_restart(self, olddir, newdir):
+        ''' Simulate a crash from olddir and restart in newdir. '''
+        # with the connection still open, copy files to new directory
+        shutil.rmtree(newdir, ignore_errors=True)
+        os.mkdir(newdir)
+        for fname in os.listdir(olddir):
+            fullname = os.path.join(olddir, fname)
+            # Skip lock file on Windows since it is locked
+            if os.path.isfile(fullname) and "WiredTiger.lock" not in fullname:
+                shutil.copy(fullname, newdir)
+        # close the original connection and open to new directory
+        self.close_conn()
+        self.conn = self.setUpConnectionOpen(newdir)
+        self.session = self.setUpSessionOpen(self.conn)
+
+    # The last record in the log spans several allocation blocks, and its
+    # value ends with enough zeros for its last block to be all zeros:
+    # recovery must still find the end of the record.
+    def test_zero_tail(self):
+        self.session.create(self.uri, 'key_format=S,value_format=u')
+        value = 'abcde' * 10 + '\0' * 550
+        cursor = self.session.open_cursor(self.uri, None)
+        cursor['key'] = value
+        cursor.close()
+
+        self.simulate_crash_restart(".", "RESTART")
+        cursor = self.session.open_cursor(self.uri, None)
+        self.assertEqual(cursor['key'], value)
+        cursor.close()
+
+if __name__ == '__main__':
+    wttest.run()
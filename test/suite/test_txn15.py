@@ -0,0 +1,113 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_txn15.py
+#    Transactions: synchronous commits from concurrent threads
+#
+
+import os, shutil, threading
+import wiredtiger, wttest
+from wiredtiger import stat
+from wtscenario import check_scenarios
+
+class test_txn15(wttest.WiredTigerTestCase):
+    uri = 'table:test_txn15'
+    nthreads = 8
+    nops = 500
+
+    scenarios = check_scenarios([
+        ('dsync', dict(method='dsync')),
+        ('fsync', dict(method='fsync')),
+        ('none', dict(method='none')),
+    ])
+
+    # Override WiredTigerTestCase, we need logging and statistics.
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir, 'create,' +
+            'log=(enabled,file_max=100K),statistics=(fast),' +
+            'transaction_sync=(enabled,method=%s),' % self.method +
+            'error_prefix="%s: "' % self.shortid())
+        return conn
+
+    def simulate_crash_restart(self, olddir, newdir):
+        ''' Simulate a crash from olddir and restart in newdir. '''
+        # with the connection still open, copy files to new directory
+        shutil.rmtree(newdir, ignore_errors=True)
+        os.mkdir(newdir)
+        for fname in os.listdir(olddir):
+            fullname = os.path.join(olddir, fname)
+            # Skip lock file on Windows since it is locked
+            if os.path.isfile(fullname) and "WiredTiger.lock" not in fullname:
+                shutil.copy(fullname, newdir)
+        # close the original connection and open to new directory
+        self.close_conn()
+        self.conn = self.setUpConnectionOpen(newdir)
+        self.session = self.setUpSessionOpen(self.conn)
+
+    def commit_ops(self, id):
+        session = self.conn.open_session()
+        cursor = session.open_cursor(self.uri, None)
+        for i in range(self.nops):
+            session.begin_transaction()
+            cursor['%d-%d' % (id, i)] = 'value' * (i % 50 + 1)
+            session.commit_transaction()
+        session.close()
+
+    # Commits wait for their records to be written and synced by the log
+    # threads, and are recovered after a crash.
+    def test_sync_commit(self):
+        self.session.create(self.uri, 'key_format=S,value_format=S')
+        requests = self.get_stat(stat.conn.log_sync_requests)
+        syncs = self.get_stat(stat.conn.log_sync)
+        threads = [threading.Thread(target=self.commit_ops, args=(id,))
+            for id in range(self.nthreads)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+
+        # Every commit asks for the log to be synced, the log flush thread
+        # can cover many of them with each sync.
+        requests = self.get_stat(stat.conn.log_sync_requests) - requests
+        syncs = self.get_stat(stat.conn.log_sync) - syncs
+        if self.method == 'fsync':
+            self.assertGreaterEqual(requests, self.nthreads * self.nops)
+            self.assertGreater(syncs, 0)
+            self.assertLessEqual(syncs, requests)
+        else:
+            self.assertEqual(syncs, 0)
+            if self.method == 'none':
+                self.assertEqual(requests, 0)
+
+        self.simulate_crash_restart(".", "RESTART")
+        cursor = self.session.open_cursor(self.uri, None)
+        self.assertEqual(sum(1 for k in cursor), self.nthreads * self.nops)
+        cursor.close()
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,142 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_txn16.py
+#    Transactions: compact log records
+#
+
+import os, shutil
+import wiredtiger, wttest
+from suite_subprocess import suite_subprocess
+from wiredtiger import stat
+from wtscenario import check_scenarios
+
+class test_txn16(wttest.WiredTigerTestCase, suite_subprocess):
+    uri = 'table:test_txn16'
+    nkeys = 1000
+    nops = 100
+
+    scenarios = check_scenarios([
+        ('compact', dict(format='compact')),
+        ('full', dict(format='full')),
+    ])
+
+    # Override WiredTigerTestCase, we need logging and statistics.
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir, 'create,' +
+            'log=(archive=false,enabled,file_max=10MB,format=%s),' %
+            self.format + 'statistics=(fast),' +
+            'error_prefix="%s: "' % self.shortid())
+        return conn
+
+    def simulate_crash_restart(self, olddir, newdir):
+        ''' Simulate a crash from olddir and restart in newdir. '''
+        # with the connection still open, copy files to new directory
+        shutil.rmtree(newdir, ignore_errors=True)
+        os.mkdir(newdir)
+        for fname in os.listdir(olddir):
+            fullname = os.path.join(olddir, fname)
+            # Skip lock file on Windows since it is locked
+            if os.path.isfile(fullname) and "WiredTiger.lock" not in fullname:
+                shutil.copy(fullname, newdir)
+        # close the original connection and open to new directory
+        self.close_conn()
+        self.conn = self.setUpConnectionOpen(newdir)
+        self.session = self.setUpSessionOpen(self.conn)
+
+    def key(self, i):
+        return 'user-account-%010d' % i
+
+    def value(self, i):
+        return 'value-%d' % i
+
+    # Transactions updating a table and its index, with keys in order, are
+    # logged, read by log cursors and recovered in either format.
+    def test_compact_log(self):
+        self.session.create(self.uri,
+            'key_format=S,value_format=SS,columns=(k,v,w)')
+        self.session.create('index:test_txn16:w', 'columns=(w)')
+        saved = self.get_stat(stat.conn.log_compact_saved)
+
+        cursor = self.session.open_cursor(self.uri, None)
+        for i in range(0, self.nkeys, self.nops):
+            self.session.begin_transaction()
+            for j in range(i, i + self.nops):
+                cursor[self.key(j)] = (self.value(j), self.value(j))
+            self.session.commit_transaction()
+        self.session.begin_transaction()
+        for i in range(0, self.nkeys, 2):
+            cursor.set_key(self.key(i))
+            self.assertEqual(cursor.remove(), 0)
+        self.session.commit_transaction()
+        cursor.close()
+
+        # Only the compact format saves log space.
+        saved = self.get_stat(stat.conn.log_compact_saved) - saved
+        if self.format == 'compact':
+            self.assertGreater(saved, self.nkeys * 10)
+        else:
+            self.assertEqual(saved, 0)
+
+        # Log cursors return the full keys of puts and removes.
+        puts = removes = 0
+        cursor = self.session.open_cursor('log:', None, None)
+        while cursor.next() == 0:
+            # txnid, rectype, optype, fileid, logrec_key, logrec_value
+            values = cursor.get_value()
+            if not str(values[4]).startswith('user-account-'):
+                continue
+            if values[2] == wiredtiger.WT_LOGOP_ROW_PUT:
+                puts += 1
+            elif values[2] == wiredtiger.WT_LOGOP_ROW_REMOVE:
+                removes += 1
+        cursor.close()
+        self.assertEqual(puts, self.nkeys)
+        self.assertEqual(removes, self.nkeys / 2)
+
+        self.runWt(['printlog'], outfilename='printlog.out')
+
+        self.simulate_crash_restart(".", "RESTART")
+        cursor = self.session.open_cursor(self.uri, None)
+        for i in range(self.nkeys):
+            cursor.set_key(self.key(i))
+            if i % 2 == 0:
+                self.assertEqual(cursor.search(), wiredtiger.WT_NOTFOUND)
+            else:
+                self.assertEqual(cursor.search(), 0)
+                self.assertEqual(cursor.get_value(),
+                    [self.value(i), self.value(i)])
+        cursor.close()
+
+        # The index was recovered too.
+        cursor = self.session.open_cursor('index:test_txn16:w', None)
+        self.assertEqual(sum(1 for k in cursor), self.nkeys / 2)
+        cursor.close()
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,102 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+#
+# test_warmup01.py
+#    Cache warm-up: pages in the cache are read back in when re-opened
+
+import os, time
+import wiredtiger, wttest
+from helper import simple_populate, simple_populate_check
+from wiredtiger import stat
+from wtscenario import check_scenarios
+
+class test_warmup01(wttest.WiredTigerTestCase):
+    nentries = 20000
+
+    scenarios = check_scenarios([
+        ('file', dict(uri='file:test_warmup01')),
+        ('table', dict(uri='table:test_warmup01'))
+    ])
+
+    # Override WiredTigerTestCase, we need statistics and cache warm-up.
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir,
+            'create,cache_size=20MB,cache_warmup=(enabled=true),' +
+            'statistics=(fast),error_prefix="%s: "' % self.shortid())
+        return conn
+
+    # The warm-up threads run in the background, wait for them to read
+    # pages into the cache.
+    def warmup_wait(self):
+        for i in range(100):
+            if self.get_stat(stat.conn.cache_warmup_read) > 0:
+                break
+            time.sleep(0.1)
+        self.assertGreater(self.get_stat(stat.conn.cache_warmup_read), 0)
+
+    # Closing the database lists the pages in the cache, re-opening it reads
+    # them back in.
+    def test_warmup01_close(self):
+        simple_populate(self, self.uri, 'key_format=S', self.nentries)
+        simple_populate_check(self, self.uri, self.nentries)
+        self.reopen_conn()
+        self.assertTrue(os.path.exists('WiredTiger.resident'))
+        self.reopen_conn()
+        self.warmup_wait()
+        simple_populate_check(self, self.uri, self.nentries)
+
+    # Checkpoints list the pages in the cache.
+    def test_warmup01_checkpoint(self):
+        simple_populate(self, self.uri, 'key_format=S', self.nentries)
+        self.session.checkpoint()
+        self.assertTrue(os.path.exists('WiredTiger.resident'))
+        self.assertGreater(self.get_stat(stat.conn.cache_warmup_saved), 0)
+
+    # A list that can't be read is ignored.
+    def test_warmup01_corrupt(self):
+        simple_populate(self, self.uri, 'key_format=S', self.nentries)
+        self.close_conn()
+        with open('WiredTiger.resident', 'a') as f:
+            f.write('garbage\n')
+        with self.expectedStderrPattern('unexpected cache warm-up list'):
+            self.open_conn()
+        simple_populate_check(self, self.uri, self.nentries)
+
+    # Objects in the list that have since been dropped are ignored.
+    def test_warmup01_drop(self):
+        simple_populate(self, self.uri, 'key_format=S', self.nentries)
+        self.close_conn()
+        with open('WiredTiger.resident', 'a') as f:
+            f.write('F file:test_warmup01_dropped\n')
+        self.open_conn()
+        self.warmup_wait()
+        simple_populate_check(self, self.uri, self.nentries)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -311,6 +311,14 @@ class WiredTigerTestCase(unittest.TestCase):
         self.assertEqual(ret, wiredtiger.WT_NOTFOUND)
         bkp_cursor.close()
 
+    # Return a statistic's value: a connection statistic, unless an object's
+    # URI is given.
+    def get_stat(self, field, uri=''):
+        stat_cursor = self.session.open_cursor('statistics:' + uri, None, None)
+        value = stat_cursor[field][2]
+        stat_cursor.close()
+        return value
+
     @contextmanager
     def expectedStdout(self, expect):
         self.captureout.check(self)
@@ -2,11 +2,14 @@
 
 no_scale_per_second_list = [
     'async: maximum work queue length',
+    'block-manager: block cache bytes currently in use',
     'cache: bytes currently in the cache',
+    'cache: bytes currently in the cache on the most used NUMA node',
     'cache: maximum bytes configured',
     'cache: maximum page size at eviction',
     'cache: pages currently held in the cache',
     'cache: percentage overhead',
+    'cache: shared cache pressure (per mille)',
     'cache: tracked bytes belonging to internal pages in the cache',
     'cache: tracked bytes belonging to leaf pages in the cache',
     'cache: tracked bytes belonging to overflow pages in the cache',
@@ -53,6 +56,7 @@ no_scale_per_second_list = [
     'btree: overflow pages',
     'btree: row-store internal pages',
     'btree: row-store leaf pages',
+    'cache: bytes currently in the cache',
     'cache: overflow values cached in memory',
     'LSM: bloom filters in the LSM tree',
     'LSM: chunks in the LSM tree',
@@ -62,10 +66,13 @@ no_scale_per_second_list = [
     'session: open cursor count',
 ]
 no_clear_list = [
+    'block-manager: block cache bytes currently in use',
     'cache: bytes currently in the cache',
+    'cache: bytes currently in the cache on the most used NUMA node',
     'cache: maximum bytes configured',
     'cache: pages currently held in the cache',
     'cache: percentage overhead',
+    'cache: shared cache pressure (per mille)',
     'cache: tracked bytes belonging to internal pages in the cache',
     'cache: tracked bytes belonging to leaf pages in the cache',
     'cache: tracked bytes belonging to overflow pages in the cache',
@@ -91,6 +98,7 @@ no_clear_list = [
     'transaction: transaction range of IDs currently pinned',
     'transaction: transaction range of IDs currently pinned by a checkpoint',
     'btree: btree checkpoint generation',
+    'cache: bytes currently in the cache',
     'session: open cursor count',
 ]
 prefix_list = [